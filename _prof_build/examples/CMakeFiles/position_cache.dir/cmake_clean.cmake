@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/position_cache.dir/position_cache.cpp.o"
+  "CMakeFiles/position_cache.dir/position_cache.cpp.o.d"
+  "position_cache"
+  "position_cache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/position_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
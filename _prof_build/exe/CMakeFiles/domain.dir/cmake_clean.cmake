@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/domain.dir/domain.cpp.o"
+  "CMakeFiles/domain.dir/domain.cpp.o.d"
+  "domain"
+  "domain.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/domain.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Debug".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "loki::parsers" for configuration "Debug"
+set_property(TARGET loki::parsers APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(loki::parsers PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libloki_parsers.a"
+  )
+
+list(APPEND _cmake_import_check_targets loki::parsers )
+list(APPEND _cmake_import_check_files_for_loki::parsers "${_IMPORT_PREFIX}/lib/libloki_parsers.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,77 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ast/ast.cpp" "src/CMakeFiles/parsers.dir/ast/ast.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/ast/ast.cpp.o.d"
+  "/root/repo/src/ast/parser_instantiations.cpp" "src/CMakeFiles/parsers.dir/ast/parser_instantiations.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/ast/parser_instantiations.cpp.o.d"
+  "/root/repo/src/ast/printer.cpp" "src/CMakeFiles/parsers.dir/ast/printer.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/ast/printer.cpp.o.d"
+  "/root/repo/src/ast/profiler.cpp" "src/CMakeFiles/parsers.dir/ast/profiler.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/ast/profiler.cpp.o.d"
+  "/root/repo/src/exceptions.cpp" "src/CMakeFiles/parsers.dir/exceptions.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/exceptions.cpp.o.d"
+  "/root/repo/src/parser.cpp" "src/CMakeFiles/parsers.dir/parser.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/parser.cpp.o.d"
+  "/root/repo/src/pddl/action.cpp" "src/CMakeFiles/parsers.dir/pddl/action.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/action.cpp.o.d"
+  "/root/repo/src/pddl/atom.cpp" "src/CMakeFiles/parsers.dir/pddl/atom.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/atom.cpp.o.d"
+  "/root/repo/src/pddl/atom_index.cpp" "src/CMakeFiles/parsers.dir/pddl/atom_index.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/atom_index.cpp.o.d"
+  "/root/repo/src/pddl/axiom.cpp" "src/CMakeFiles/parsers.dir/pddl/axiom.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/axiom.cpp.o.d"
+  "/root/repo/src/pddl/conditions.cpp" "src/CMakeFiles/parsers.dir/pddl/conditions.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/conditions.cpp.o.d"
+  "/root/repo/src/pddl/diagnostics.cpp" "src/CMakeFiles/parsers.dir/pddl/diagnostics.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/diagnostics.cpp.o.d"
+  "/root/repo/src/pddl/domain.cpp" "src/CMakeFiles/parsers.dir/pddl/domain.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/domain.cpp.o.d"
+  "/root/repo/src/pddl/effects.cpp" "src/CMakeFiles/parsers.dir/pddl/effects.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/effects.cpp.o.d"
+  "/root/repo/src/pddl/equal_to.cpp" "src/CMakeFiles/parsers.dir/pddl/equal_to.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/equal_to.cpp.o.d"
+  "/root/repo/src/pddl/exceptions.cpp" "src/CMakeFiles/parsers.dir/pddl/exceptions.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/exceptions.cpp.o.d"
+  "/root/repo/src/pddl/factories.cpp" "src/CMakeFiles/parsers.dir/pddl/factories.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/factories.cpp.o.d"
+  "/root/repo/src/pddl/formatter.cpp" "src/CMakeFiles/parsers.dir/pddl/formatter.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/formatter.cpp.o.d"
+  "/root/repo/src/pddl/function.cpp" "src/CMakeFiles/parsers.dir/pddl/function.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/function.cpp.o.d"
+  "/root/repo/src/pddl/function_expressions.cpp" "src/CMakeFiles/parsers.dir/pddl/function_expressions.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/function_expressions.cpp.o.d"
+  "/root/repo/src/pddl/function_skeleton.cpp" "src/CMakeFiles/parsers.dir/pddl/function_skeleton.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/function_skeleton.cpp.o.d"
+  "/root/repo/src/pddl/hash.cpp" "src/CMakeFiles/parsers.dir/pddl/hash.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/hash.cpp.o.d"
+  "/root/repo/src/pddl/literal.cpp" "src/CMakeFiles/parsers.dir/pddl/literal.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/literal.cpp.o.d"
+  "/root/repo/src/pddl/merger.cpp" "src/CMakeFiles/parsers.dir/pddl/merger.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/merger.cpp.o.d"
+  "/root/repo/src/pddl/metric.cpp" "src/CMakeFiles/parsers.dir/pddl/metric.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/metric.cpp.o.d"
+  "/root/repo/src/pddl/numeric_fluent.cpp" "src/CMakeFiles/parsers.dir/pddl/numeric_fluent.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/numeric_fluent.cpp.o.d"
+  "/root/repo/src/pddl/object.cpp" "src/CMakeFiles/parsers.dir/pddl/object.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/object.cpp.o.d"
+  "/root/repo/src/pddl/parameter.cpp" "src/CMakeFiles/parsers.dir/pddl/parameter.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parameter.cpp.o.d"
+  "/root/repo/src/pddl/parser.cpp" "src/CMakeFiles/parsers.dir/pddl/parser.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser.cpp.o.d"
+  "/root/repo/src/pddl/parser/common.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/common.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/common.cpp.o.d"
+  "/root/repo/src/pddl/parser/conditions.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/conditions.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/conditions.cpp.o.d"
+  "/root/repo/src/pddl/parser/constants.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/constants.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/constants.cpp.o.d"
+  "/root/repo/src/pddl/parser/effects.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/effects.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/effects.cpp.o.d"
+  "/root/repo/src/pddl/parser/error_handling.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/error_handling.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/error_handling.cpp.o.d"
+  "/root/repo/src/pddl/parser/functions.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/functions.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/functions.cpp.o.d"
+  "/root/repo/src/pddl/parser/goal.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/goal.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/goal.cpp.o.d"
+  "/root/repo/src/pddl/parser/ground_literal.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/ground_literal.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/ground_literal.cpp.o.d"
+  "/root/repo/src/pddl/parser/initial.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/initial.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/initial.cpp.o.d"
+  "/root/repo/src/pddl/parser/literal.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/literal.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/literal.cpp.o.d"
+  "/root/repo/src/pddl/parser/metric.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/metric.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/metric.cpp.o.d"
+  "/root/repo/src/pddl/parser/objects.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/objects.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/objects.cpp.o.d"
+  "/root/repo/src/pddl/parser/parameters.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/parameters.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/parameters.cpp.o.d"
+  "/root/repo/src/pddl/parser/predicates.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/predicates.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/predicates.cpp.o.d"
+  "/root/repo/src/pddl/parser/reference_utils.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/reference_utils.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/reference_utils.cpp.o.d"
+  "/root/repo/src/pddl/parser/requirements.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/requirements.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/requirements.cpp.o.d"
+  "/root/repo/src/pddl/parser/structure.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/structure.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/structure.cpp.o.d"
+  "/root/repo/src/pddl/parser/types.cpp" "src/CMakeFiles/parsers.dir/pddl/parser/types.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/parser/types.cpp.o.d"
+  "/root/repo/src/pddl/predicate.cpp" "src/CMakeFiles/parsers.dir/pddl/predicate.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/predicate.cpp.o.d"
+  "/root/repo/src/pddl/problem.cpp" "src/CMakeFiles/parsers.dir/pddl/problem.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/problem.cpp.o.d"
+  "/root/repo/src/pddl/requirements.cpp" "src/CMakeFiles/parsers.dir/pddl/requirements.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/requirements.cpp.o.d"
+  "/root/repo/src/pddl/scope.cpp" "src/CMakeFiles/parsers.dir/pddl/scope.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/scope.cpp.o.d"
+  "/root/repo/src/pddl/term.cpp" "src/CMakeFiles/parsers.dir/pddl/term.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/term.cpp.o.d"
+  "/root/repo/src/pddl/type.cpp" "src/CMakeFiles/parsers.dir/pddl/type.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/type.cpp.o.d"
+  "/root/repo/src/pddl/variable.cpp" "src/CMakeFiles/parsers.dir/pddl/variable.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/pddl/variable.cpp.o.d"
+  "/root/repo/src/registry.cpp" "src/CMakeFiles/parsers.dir/registry.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/registry.cpp.o.d"
+  "/root/repo/src/suite.cpp" "src/CMakeFiles/parsers.dir/suite.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/suite.cpp.o.d"
+  "/root/repo/src/utils/filesystem.cpp" "src/CMakeFiles/parsers.dir/utils/filesystem.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/utils/filesystem.cpp.o.d"
+  "/root/repo/src/utils/memory.cpp" "src/CMakeFiles/parsers.dir/utils/memory.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/utils/memory.cpp.o.d"
+  "/root/repo/src/utils/structural_index.cpp" "src/CMakeFiles/parsers.dir/utils/structural_index.cpp.o" "gcc" "src/CMakeFiles/parsers.dir/utils/structural_index.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,127 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parsers.dir/ast/ast.cpp.o"
+  "CMakeFiles/parsers.dir/ast/ast.cpp.o.d"
+  "CMakeFiles/parsers.dir/ast/parser_instantiations.cpp.o"
+  "CMakeFiles/parsers.dir/ast/parser_instantiations.cpp.o.d"
+  "CMakeFiles/parsers.dir/ast/printer.cpp.o"
+  "CMakeFiles/parsers.dir/ast/printer.cpp.o.d"
+  "CMakeFiles/parsers.dir/ast/profiler.cpp.o"
+  "CMakeFiles/parsers.dir/ast/profiler.cpp.o.d"
+  "CMakeFiles/parsers.dir/exceptions.cpp.o"
+  "CMakeFiles/parsers.dir/exceptions.cpp.o.d"
+  "CMakeFiles/parsers.dir/parser.cpp.o"
+  "CMakeFiles/parsers.dir/parser.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/action.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/action.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/atom.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/atom.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/atom_index.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/atom_index.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/axiom.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/axiom.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/conditions.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/conditions.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/diagnostics.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/diagnostics.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/domain.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/domain.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/effects.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/effects.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/equal_to.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/equal_to.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/exceptions.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/exceptions.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/factories.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/factories.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/formatter.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/formatter.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/function.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/function.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/function_expressions.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/function_expressions.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/function_skeleton.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/function_skeleton.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/hash.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/hash.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/literal.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/literal.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/merger.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/merger.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/metric.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/metric.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/numeric_fluent.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/numeric_fluent.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/object.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/object.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parameter.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parameter.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/common.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/common.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/conditions.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/conditions.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/constants.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/constants.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/effects.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/effects.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/error_handling.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/error_handling.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/functions.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/functions.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/goal.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/goal.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/ground_literal.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/ground_literal.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/initial.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/initial.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/literal.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/literal.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/metric.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/metric.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/objects.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/objects.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/parameters.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/parameters.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/predicates.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/predicates.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/reference_utils.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/reference_utils.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/requirements.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/requirements.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/structure.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/structure.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/parser/types.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/parser/types.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/predicate.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/predicate.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/problem.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/problem.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/requirements.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/requirements.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/scope.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/scope.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/term.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/term.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/type.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/type.cpp.o.d"
+  "CMakeFiles/parsers.dir/pddl/variable.cpp.o"
+  "CMakeFiles/parsers.dir/pddl/variable.cpp.o.d"
+  "CMakeFiles/parsers.dir/registry.cpp.o"
+  "CMakeFiles/parsers.dir/registry.cpp.o.d"
+  "CMakeFiles/parsers.dir/suite.cpp.o"
+  "CMakeFiles/parsers.dir/suite.cpp.o.d"
+  "CMakeFiles/parsers.dir/utils/filesystem.cpp.o"
+  "CMakeFiles/parsers.dir/utils/filesystem.cpp.o.d"
+  "CMakeFiles/parsers.dir/utils/memory.cpp.o"
+  "CMakeFiles/parsers.dir/utils/memory.cpp.o.d"
+  "CMakeFiles/parsers.dir/utils/structural_index.cpp.o"
+  "CMakeFiles/parsers.dir/utils/structural_index.cpp.o.d"
+  "libloki_parsers.a"
+  "libloki_parsers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parsers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,55 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/unit/parser.cpp" "tests/unit/CMakeFiles/loki_tests.dir/parser.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/parser.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/atomic_formula_skeleton.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/atomic_formula_skeleton.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/atomic_formula_skeleton.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/atomic_function_skeleton_general.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/atomic_function_skeleton_general.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/atomic_function_skeleton_general.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/atomic_function_skeleton_total_cost.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/atomic_function_skeleton_total_cost.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/atomic_function_skeleton_total_cost.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/effect.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/effect.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/effect.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/function_symbol.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/function_symbol.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/function_symbol.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/function_symbol_total_cost.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/function_symbol_total_cost.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/function_symbol_total_cost.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/function_typed_list_of_atom_function_skeletons.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/function_typed_list_of_atom_function_skeletons.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/function_typed_list_of_atom_function_skeletons.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/function_typed_list_of_atom_function_skeletons_recursively.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/function_typed_list_of_atom_function_skeletons_recursively.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/function_typed_list_of_atom_function_skeletons_recursively.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/goal_descriptor.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/goal_descriptor.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/goal_descriptor.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/name.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/name.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/name.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/number.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/number.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/number.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/predicate.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/predicate.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/predicate.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/profiler.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/profiler.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/profiler.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/term.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/term.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/term.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/type.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/type.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/type.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/type_either.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/type_either.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/type_either.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/typed_list_of_names.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_names.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_names.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/typed_list_of_names_recursively.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_names_recursively.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_names_recursively.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/typed_list_of_variables.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_variables.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_variables.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/typed_list_of_variables_recursively.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_variables_recursively.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_variables_recursively.cpp.o.d"
+  "/root/repo/tests/unit/pddl/ast/variable.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/variable.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/ast/variable.cpp.o.d"
+  "/root/repo/tests/unit/pddl/atom_index.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/atom_index.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/atom_index.cpp.o.d"
+  "/root/repo/tests/unit/pddl/factories.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/factories.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/factories.cpp.o.d"
+  "/root/repo/tests/unit/pddl/position.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/position.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/position.cpp.o.d"
+  "/root/repo/tests/unit/pddl/reference.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/reference.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/reference.cpp.o.d"
+  "/root/repo/tests/unit/pddl/scope.cpp" "tests/unit/CMakeFiles/loki_tests.dir/pddl/scope.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/pddl/scope.cpp.o.d"
+  "/root/repo/tests/unit/registry.cpp" "tests/unit/CMakeFiles/loki_tests.dir/registry.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/registry.cpp.o.d"
+  "/root/repo/tests/unit/suite.cpp" "tests/unit/CMakeFiles/loki_tests.dir/suite.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/suite.cpp.o.d"
+  "/root/repo/tests/unit/utils/filesystem.cpp" "tests/unit/CMakeFiles/loki_tests.dir/utils/filesystem.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/utils/filesystem.cpp.o.d"
+  "/root/repo/tests/unit/utils/name_index.cpp" "tests/unit/CMakeFiles/loki_tests.dir/utils/name_index.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/utils/name_index.cpp.o.d"
+  "/root/repo/tests/unit/utils/segmented_vector.cpp" "tests/unit/CMakeFiles/loki_tests.dir/utils/segmented_vector.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/utils/segmented_vector.cpp.o.d"
+  "/root/repo/tests/unit/utils/string_arena.cpp" "tests/unit/CMakeFiles/loki_tests.dir/utils/string_arena.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/utils/string_arena.cpp.o.d"
+  "/root/repo/tests/unit/utils/structural_index.cpp" "tests/unit/CMakeFiles/loki_tests.dir/utils/structural_index.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/utils/structural_index.cpp.o.d"
+  "/root/repo/tests/unit/utils/thread_pool.cpp" "tests/unit/CMakeFiles/loki_tests.dir/utils/thread_pool.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/utils/thread_pool.cpp.o.d"
+  "/root/repo/tests/unit/utils/value_type_factory.cpp" "tests/unit/CMakeFiles/loki_tests.dir/utils/value_type_factory.cpp.o" "gcc" "tests/unit/CMakeFiles/loki_tests.dir/utils/value_type_factory.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_prof_build/src/CMakeFiles/parsers.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
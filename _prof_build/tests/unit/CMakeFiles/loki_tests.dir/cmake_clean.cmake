@@ -0,0 +1,81 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/loki_tests.dir/parser.cpp.o"
+  "CMakeFiles/loki_tests.dir/parser.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/atomic_formula_skeleton.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/atomic_formula_skeleton.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/atomic_function_skeleton_general.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/atomic_function_skeleton_general.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/atomic_function_skeleton_total_cost.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/atomic_function_skeleton_total_cost.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/effect.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/effect.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/function_symbol.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/function_symbol.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/function_symbol_total_cost.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/function_symbol_total_cost.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/function_typed_list_of_atom_function_skeletons.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/function_typed_list_of_atom_function_skeletons.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/function_typed_list_of_atom_function_skeletons_recursively.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/function_typed_list_of_atom_function_skeletons_recursively.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/goal_descriptor.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/goal_descriptor.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/name.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/name.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/number.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/number.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/predicate.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/predicate.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/profiler.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/profiler.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/term.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/term.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/type.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/type.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/type_either.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/type_either.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_names.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_names.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_names_recursively.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_names_recursively.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_variables.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_variables.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_variables_recursively.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/typed_list_of_variables_recursively.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/ast/variable.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/ast/variable.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/atom_index.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/atom_index.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/factories.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/factories.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/position.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/position.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/reference.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/reference.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/pddl/scope.cpp.o"
+  "CMakeFiles/loki_tests.dir/pddl/scope.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/registry.cpp.o"
+  "CMakeFiles/loki_tests.dir/registry.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/suite.cpp.o"
+  "CMakeFiles/loki_tests.dir/suite.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/utils/filesystem.cpp.o"
+  "CMakeFiles/loki_tests.dir/utils/filesystem.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/utils/name_index.cpp.o"
+  "CMakeFiles/loki_tests.dir/utils/name_index.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/utils/segmented_vector.cpp.o"
+  "CMakeFiles/loki_tests.dir/utils/segmented_vector.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/utils/string_arena.cpp.o"
+  "CMakeFiles/loki_tests.dir/utils/string_arena.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/utils/structural_index.cpp.o"
+  "CMakeFiles/loki_tests.dir/utils/structural_index.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/utils/thread_pool.cpp.o"
+  "CMakeFiles/loki_tests.dir/utils/thread_pool.cpp.o.d"
+  "CMakeFiles/loki_tests.dir/utils/value_type_factory.cpp.o"
+  "CMakeFiles/loki_tests.dir/utils/value_type_factory.cpp.o.d"
+  "loki_tests"
+  "loki_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/loki_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit
+# Build directory: /root/repo/_prof_build/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[domain_gtests]=] "loki_tests")
+set_tests_properties([=[domain_gtests]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/CMakeLists.txt;22;add_test;/root/repo/tests/unit/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/multiple_problems.dir/multiple_problems.cpp.o"
+  "CMakeFiles/multiple_problems.dir/multiple_problems.cpp.o.d"
+  "multiple_problems"
+  "multiple_problems.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/multiple_problems.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
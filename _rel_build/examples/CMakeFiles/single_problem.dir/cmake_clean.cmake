@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/single_problem.dir/single_problem.cpp.o"
+  "CMakeFiles/single_problem.dir/single_problem.cpp.o.d"
+  "single_problem"
+  "single_problem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/single_problem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
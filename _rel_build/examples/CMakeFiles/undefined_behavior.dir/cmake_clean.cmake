@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/undefined_behavior.dir/undefined_behavior.cpp.o"
+  "CMakeFiles/undefined_behavior.dir/undefined_behavior.cpp.o.d"
+  "undefined_behavior"
+  "undefined_behavior.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/undefined_behavior.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/problem.dir/problem.cpp.o"
+  "CMakeFiles/problem.dir/problem.cpp.o.d"
+  "problem"
+  "problem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/problem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/profile.dir/profile.cpp.o"
+  "CMakeFiles/profile.dir/profile.cpp.o.d"
+  "profile"
+  "profile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/profile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
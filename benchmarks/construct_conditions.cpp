@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "utils.hpp"
+
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <loki/details/parser.hpp>
+#include <loki/details/pddl/factories.hpp>
+#include <loki/details/utils/memory.hpp>
+
+namespace loki::benchmarks
+{
+
+/// @brief Creates a condition literal for each atom and combines every 4 consecutive condition literals into a conjunction.
+static loki::ConditionList create_conditions(const loki::AtomList& atoms, PDDLFactories& factories)
+{
+    auto conditions = loki::ConditionList();
+    auto conjuncts = loki::ConditionList();
+    for (const auto& atom : atoms)
+    {
+        conjuncts.push_back(factories.get_or_create_condition_literal(factories.get_or_create_literal(false, atom)));
+        if (conjuncts.size() == 4)
+        {
+            conditions.push_back(factories.get_or_create_condition_and(conjuncts));
+            conjuncts.clear();
+        }
+    }
+    return conditions;
+}
+
+/// @brief In this benchmark, we evaluate the performance and the memory consumption of constructing conditions.
+///
+/// The counter `KiB` is the increase of the resident set size while constructing the conditions.
+static void BM_ConstructConditions(benchmark::State& state)
+{
+    const size_t num_atoms = state.range(0);
+    const size_t num_predicates = 100;
+    const size_t num_objects = static_cast<size_t>(sqrt(num_atoms / num_predicates));
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto factories = loki::PDDLFactories();
+        auto atoms = create_atoms(num_objects, num_predicates, factories);
+        const auto [vm_before, rss_before] = process_mem_usage();
+        state.ResumeTiming();
+
+        auto conditions = create_conditions(atoms, factories);
+        benchmark::DoNotOptimize(conditions);
+
+        state.PauseTiming();
+        const auto [vm_after, rss_after] = process_mem_usage();
+        state.counters["KiB"] = rss_after - rss_before;
+        state.ResumeTiming();
+    }
+}
+
+/// @brief In this benchmark, we evaluate the performance and the memory consumption of parsing an ADL domain,
+///        whose conditions and effects use all kinds of alternatives, e.g., quantifiers and conditional effects.
+///
+/// The domain is parsed `num_domains` times and all parsers are kept alive.
+/// The counter `KiB` is the increase of the resident set size per domain.
+static void BM_ParseADLDomain(benchmark::State& state)
+{
+    const size_t num_domains = state.range(0);
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "schedule/domain.pddl");
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto domain_parsers = std::vector<DomainParser>();
+        domain_parsers.reserve(num_domains);
+        const auto [vm_before, rss_before] = process_mem_usage();
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < num_domains; ++i)
+        {
+            domain_parsers.emplace_back(domain_file);
+        }
+
+        state.PauseTiming();
+        const auto [vm_after, rss_after] = process_mem_usage();
+        state.counters["KiB"] = (rss_after - rss_before) / num_domains;
+        domain_parsers.clear();
+        state.ResumeTiming();
+    }
+}
+
+/// @brief Writes a gripper problem with `num_balls` balls whose goal is a conjunction of `num_balls` literals.
+static fs::path write_large_goal_problem(size_t num_balls)
+{
+    const auto problem_file = fs::temp_directory_path() / ("loki_construct_conditions_goal_" + std::to_string(num_balls) + ".pddl");
+
+    auto out = std::ofstream(problem_file);
+    out << "(define (problem large-goal) (:domain gripper-strips)\n(:objects left right";
+    for (size_t i = 0; i < num_balls; ++i)
+    {
+        out << " ball" << i;
+    }
+    out << ")\n(:init (room rooma) (room roomb) (gripper left) (gripper right) (at-robby rooma) (free left) (free right))\n(:goal (and";
+    for (size_t i = 0; i < num_balls; ++i)
+    {
+        out << " (at ball" << i << " roomb)";
+    }
+    out << ")))\n";
+
+    return problem_file;
+}
+
+/// @brief In this benchmark, we evaluate the performance and the memory consumption of parsing a problem with a large goal.
+///
+/// The counter `KiB` is the increase of the resident set size while parsing the problem.
+static void BM_ParseLargeGoal(benchmark::State& state)
+{
+    const size_t num_balls = state.range(0);
+    const auto problem_file = write_large_goal_problem(num_balls);
+    auto domain_parser = DomainParser(fs::path(std::string(DATA_DIR) + "gripper/domain.pddl"));
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        const auto [vm_before, rss_before] = process_mem_usage();
+        state.ResumeTiming();
+
+        auto problem_parser = ProblemParser(problem_file, domain_parser);
+        benchmark::DoNotOptimize(problem_parser.get_problem());
+
+        state.PauseTiming();
+        const auto [vm_after, rss_after] = process_mem_usage();
+        state.counters["KiB"] = rss_after - rss_before;
+        state.ResumeTiming();
+    }
+    fs::remove(problem_file);
+}
+
+}
+
+// Repetitions give the mean and the standard deviation to tell differences from run-to-run noise.
+BENCHMARK(loki::benchmarks::BM_ConstructConditions)->Arg(100000)->Arg(1000000)->Iterations(1)->Repetitions(10);
+BENCHMARK(loki::benchmarks::BM_ParseADLDomain)->Arg(1000)->Iterations(1)->Repetitions(10);
+BENCHMARK(loki::benchmarks::BM_ParseLargeGoal)->Arg(100000)->Iterations(1)->Repetitions(10);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <benchmark/benchmark.h>
+#include <loki/details/utils/filesystem.hpp>
+#include <loki/details/utils/structural_index.hpp>
+#include <string>
+#include <vector>
+
+namespace loki::benchmarks
+{
+
+/// @brief Returns a problem with an initial state of about `num_bytes` bytes of atoms and numeric fluents.
+static std::string create_problem(size_t num_bytes)
+{
+    auto out = std::string();
+    out.reserve(num_bytes + 256);
+    out += "(define (problem large) (:domain transport)\n(:objects";
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        out += " c" + std::to_string(i);
+    }
+    out += ")\n(:init\n";
+    for (size_t i = 0; out.size() < num_bytes; ++i)
+    {
+        const auto from = " c" + std::to_string(i % 1000);
+        const auto to = " c" + std::to_string((i * 7919) % 1000);
+        out += "  (road" + from + to + ") (= (road-length" + from + to + ") " + std::to_string(i % 100) + ")\n";
+    }
+    out += ")\n(:goal (at t1 c0)))\n";
+    return out;
+}
+
+template<typename Texts>
+static void benchmark_index_structure(const Texts& texts, benchmark::State& state)
+{
+    size_t num_bytes = 0;
+    for (const auto& text : texts)
+    {
+        num_bytes += text.size();
+    }
+    // Index once before measuring such that the memory of the index is allocated, see `index_structure`.
+    auto index = StructuralIndex();
+    for (const auto& text : texts)
+    {
+        index_structure(text, index);
+    }
+    for (auto _ : state)
+    {
+        for (const auto& text : texts)
+        {
+            index_structure(text, index);
+            benchmark::DoNotOptimize(index);
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * num_bytes);
+}
+
+/// @brief In this benchmark, we evaluate the throughput of indexing all domain and problem files in the data directory.
+static void BM_IndexStructureData(benchmark::State& state)
+{
+    auto texts = std::vector<std::string>();
+    for (const auto& entry : fs::recursive_directory_iterator(fs::path(DATA_DIR)))
+    {
+        if (entry.is_regular_file())
+        {
+            texts.push_back(read_file(entry.path()));
+        }
+    }
+    benchmark_index_structure(texts, state);
+}
+
+/// @brief In this benchmark, we evaluate the throughput of indexing a problem with the given number of MiB.
+static void BM_IndexStructureProblem(benchmark::State& state)
+{
+    const auto texts = std::vector<std::string> { create_problem(static_cast<size_t>(state.range(0)) << 20) };
+    benchmark_index_structure(texts, state);
+}
+
+}
+
+BENCHMARK(loki::benchmarks::BM_IndexStructureData)->Unit(benchmark::kMicrosecond);
+BENCHMARK(loki::benchmarks::BM_IndexStructureProblem)->Arg(16)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
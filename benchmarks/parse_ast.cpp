@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <loki/details/ast/ast.hpp>
+#include <loki/details/ast/error_reporting.hpp>
+#include <loki/details/ast/parser.hpp>
+#include <loki/details/ast/parser_wrapper.hpp>
+#include <loki/details/utils/filesystem.hpp>
+#include <sstream>
+#include <string>
+
+namespace loki::benchmarks
+{
+
+/// @brief Returns an ADL domain with `num_actions` actions whose preconditions and effects nest all goal descriptors and conditional effects.
+static std::string create_adl_domain(size_t num_actions)
+{
+    auto out = std::stringstream();
+    out << "(define (domain adl)\n"
+        << "(:requirements :adl)\n"
+        << "(:predicates (p ?x) (q ?x) (r ?x) (s ?x ?y))\n";
+    for (size_t i = 0; i < num_actions; ++i)
+    {
+        out << "(:action a" << i << "\n"
+            << " :parameters (?x)\n"
+            << " :precondition (and (p ?x) (not (q ?x)) (or (r ?x) (exists (?y) (s ?x ?y))) (forall (?z) (imply (p ?z) (q ?z))))\n"
+            << " :effect (and (p ?x) (not (q ?x)) (forall (?z) (when (and (p ?z) (not (s ?x ?z))) (and (r ?z) (not (q ?z)))))))\n";
+    }
+    out << ")\n";
+    return out.str();
+}
+
+/// @brief Returns a transport-style problem whose initial state defines `num_numeric_fluents` road lengths and fuel costs.
+static std::string create_numeric_problem(size_t num_numeric_fluents)
+{
+    auto out = std::stringstream();
+    out << "(define (problem numbers) (:domain transport)\n"
+        << "(:init\n"
+        << "(= (total-cost) 0)\n";
+    for (size_t i = 0; i < num_numeric_fluents; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            out << "(= (road-length c" << i << " c" << i + 1 << ") " << (i * 7919) % 1000 << ")\n";
+        }
+        else
+        {
+            out << "(= (fuel-cost c" << i << " c" << i + 1 << ") " << (i * 7919) % 1000 << "." << (i * 104729) % 100 << ")\n";
+        }
+    }
+    out << ")\n"
+        << "(:goal (at t1 c0)))\n";
+    return out.str();
+}
+
+template<typename Node, typename Parser>
+static void benchmark_parse_ast(const std::string& source, const Parser& parser, benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto node = Node();
+        auto x3_error_handler = X3ErrorHandler(source.begin(), source.end(), "");
+        bool success = parse_ast(source, parser, node, x3_error_handler.get_error_handler());
+        if (!success)
+        {
+            state.SkipWithError("Failed to parse.");
+            break;
+        }
+        benchmark::DoNotOptimize(node);
+    }
+
+    state.SetBytesProcessed(state.iterations() * source.size());
+}
+
+/// @brief In this benchmark, we evaluate the performance of parsing the AST of the ADL domain schedule.
+static void BM_ParseScheduleDomainAST(benchmark::State& state)
+{
+    benchmark_parse_ast<ast::Domain>(read_file(fs::path(std::string(DATA_DIR) + "schedule/domain.pddl")), domain(), state);
+}
+
+/// @brief In this benchmark, we evaluate the performance of parsing the AST of an ADL domain with the given number of actions.
+static void BM_ParseADLDomainAST(benchmark::State& state) { benchmark_parse_ast<ast::Domain>(create_adl_domain(state.range(0)), domain(), state); }
+
+/// @brief In this benchmark, we evaluate the performance of parsing the AST of a problem with the given number of numeric fluents.
+static void BM_ParseNumericProblemAST(benchmark::State& state) { benchmark_parse_ast<ast::Problem>(create_numeric_problem(state.range(0)), problem(), state); }
+
+}
+
+BENCHMARK(loki::benchmarks::BM_ParseScheduleDomainAST)->Unit(benchmark::kMicrosecond);
+BENCHMARK(loki::benchmarks::BM_ParseADLDomainAST)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+BENCHMARK(loki::benchmarks::BM_ParseNumericProblemAST)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
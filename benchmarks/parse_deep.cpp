@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <loki/details/parser.hpp>
+
+namespace loki::benchmarks
+{
+
+/// @brief Writes a domain with a single action whose precondition nests `depth` levels of `and`, `not`, and `forall`
+///        and whose effect nests `depth` levels of `and` and `when`.
+static fs::path write_domain(size_t depth)
+{
+    const auto domain_file = fs::temp_directory_path() / ("loki_parse_deep_domain_" + std::to_string(depth) + ".pddl");
+
+    auto out = std::ofstream(domain_file);
+    out << "(define (domain deep)\n"
+        << "(:requirements :adl)\n"
+        << "(:predicates (p ?x) (q ?x))\n"
+        << "(:action a :parameters (?x)\n"
+        << ":precondition ";
+    for (size_t i = 0; i < depth; ++i)
+    {
+        out << "(and (not (forall (?y" << i << ") ";
+    }
+    out << "(p ?x)" << std::string(3 * depth, ')') << "\n"
+        << ":effect ";
+    for (size_t i = 0; i < depth; ++i)
+    {
+        out << "(and (when (p ?x) ";
+    }
+    out << "(q ?x)" << std::string(2 * depth, ')') << "))\n";
+
+    return domain_file;
+}
+
+/// @brief In this benchmark, we evaluate the performance of parsing very deeply nested goal descriptors and effects.
+static void BM_ParseDeeplyNestedFormulas(benchmark::State& state)
+{
+    const size_t depth = state.range(0);
+    const auto domain_file = write_domain(depth);
+
+    for (auto _ : state)
+    {
+        auto domain_parser = DomainParser(domain_file);
+        benchmark::DoNotOptimize(domain_parser.get_domain());
+    }
+
+    state.SetItemsProcessed(state.iterations() * depth);
+}
+
+}
+
+BENCHMARK(loki::benchmarks::BM_ParseDeeplyNestedFormulas)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
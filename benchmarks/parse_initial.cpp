@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <fstream>
+#include <loki/details/parser.hpp>
+
+namespace loki::benchmarks
+{
+
+/// @brief Writes a domain with a binary predicate and a problem whose initial state consists of `num_facts` ground atoms.
+static std::pair<fs::path, fs::path> write_files(size_t num_facts)
+{
+    const auto directory = fs::temp_directory_path();
+    const auto domain_file = directory / "loki_parse_initial_domain.pddl";
+    const auto problem_file = directory / ("loki_parse_initial_p" + std::to_string(num_facts) + ".pddl");
+
+    auto domain_out = std::ofstream(domain_file);
+    domain_out << "(define (domain facts)\n"
+               << "(:requirements :strips :typing)\n"
+               << "(:types node)\n"
+               << "(:predicates (edge ?x ?y - node))\n"
+               << "(:action move :parameters (?x ?y - node) :precondition (edge ?x ?y) :effect (not (edge ?x ?y))))\n";
+
+    const auto num_objects = static_cast<size_t>(std::ceil(std::sqrt(num_facts)));
+    auto problem_out = std::ofstream(problem_file);
+    problem_out << "(define (problem facts-" << num_facts << ")\n(:domain facts)\n(:objects";
+    for (size_t i = 0; i < num_objects; ++i)
+    {
+        problem_out << " n" << i;
+    }
+    problem_out << " - node)\n(:init\n";
+    for (size_t i = 0; i < num_facts; ++i)
+    {
+        problem_out << "(edge n" << i / num_objects << " n" << i % num_objects << ")\n";
+    }
+    problem_out << ")\n(:goal (edge n0 n0)))\n";
+
+    return { domain_file, problem_file };
+}
+
+/// @brief In this benchmark, we evaluate the scaling of parsing the initial state of a problem with the given number of threads.
+///
+/// The first argument is the number of facts and the second argument is the number of threads.
+static void BM_ParseInitial(benchmark::State& state)
+{
+    const size_t num_facts = state.range(0);
+    const size_t num_threads = state.range(1);
+    const auto [domain_file, problem_file] = write_files(num_facts);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto domain_parser = DomainParser(domain_file);
+        state.ResumeTiming();
+
+        auto problem_parser = ProblemParser(problem_file, domain_parser, { .num_threads = num_threads });
+        benchmark::DoNotOptimize(problem_parser.get_problem());
+    }
+
+    state.SetItemsProcessed(state.iterations() * num_facts);
+}
+
+}
+
+BENCHMARK(loki::benchmarks::BM_ParseInitial)
+    ->ArgsProduct({ { 1000000 }, { 1, 2, 4, 8 } })
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Iterations(1);
+
+BENCHMARK_MAIN();
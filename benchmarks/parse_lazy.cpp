@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <loki/details/parser.hpp>
+#include <loki/details/pddl/action.hpp>
+#include <loki/details/pddl/domain.hpp>
+
+namespace loki::benchmarks
+{
+
+/// @brief Writes a domain with `num_actions` actions over ten predicates whose preconditions and effects are large compared to their signatures.
+static fs::path write_domain(size_t num_actions)
+{
+    const auto domain_file = fs::temp_directory_path() / ("loki_parse_lazy_" + std::to_string(num_actions) + ".pddl");
+
+    auto out = std::ofstream(domain_file);
+    out << "(define (domain lazy)\n"
+        << "(:requirements :strips :typing :negative-preconditions :conditional-effects)\n"
+        << "(:types block)\n"
+        << "(:predicates";
+    for (size_t i = 0; i < 10; ++i)
+    {
+        out << " (p" << i << " ?x - block ?y - block)";
+    }
+    out << ")\n";
+    for (size_t i = 0; i < num_actions; ++i)
+    {
+        out << "(:action a" << i << "\n"
+            << " :parameters (?x - block ?y - block ?z - block)\n"
+            << " :precondition (and";
+        for (size_t j = 0; j < 10; ++j)
+        {
+            out << " (p" << (i + j) % 10 << " ?x ?y) (not (p" << (i + j + 1) % 10 << " ?y ?z))";
+        }
+        out << ")\n"
+            << " :effect (and (forall (?w - block) (when (p" << i % 10 << " ?w ?x) (not (p" << (i + 1) % 10 << " ?w ?z))))";
+        for (size_t j = 0; j < 5; ++j)
+        {
+            out << " (p" << (i + j + 2) % 10 << " ?x ?z) (not (p" << (i + j + 3) % 10 << " ?z ?y))";
+        }
+        out << "))\n";
+    }
+    out << ")\n";
+
+    return domain_file;
+}
+
+/// @brief In this benchmark, we evaluate the time to the first query of the domain, here the parameters of an action, if the domain is parsed eagerly.
+static void BM_ParseDomainEagerly(benchmark::State& state)
+{
+    const size_t num_actions = state.range(0);
+    const auto domain_file = write_domain(num_actions);
+
+    for (auto _ : state)
+    {
+        auto domain_parser = DomainParser(domain_file);
+        benchmark::DoNotOptimize(domain_parser.get_domain()->find_action("a0").value()->get_parameters());
+    }
+}
+
+/// @brief In this benchmark, we evaluate the time to the first query of the domain if the domain is parsed lazily.
+static void BM_ParseDomainLazily(benchmark::State& state)
+{
+    const size_t num_actions = state.range(0);
+    const auto domain_file = write_domain(num_actions);
+
+    for (auto _ : state)
+    {
+        auto domain_parser = DomainParser(domain_file, { .lazy = true });
+        benchmark::DoNotOptimize(domain_parser.get_domain()->find_action("a0").value()->get_parameters());
+    }
+}
+
+/// @brief In this benchmark, we evaluate the overhead of parsing the domain lazily and materializing all actions afterwards.
+static void BM_ParseDomainLazilyAndMaterialize(benchmark::State& state)
+{
+    const size_t num_actions = state.range(0);
+    const auto domain_file = write_domain(num_actions);
+
+    for (auto _ : state)
+    {
+        auto domain_parser = DomainParser(domain_file, { .lazy = true });
+        domain_parser.materialize();
+        benchmark::DoNotOptimize(domain_parser.get_domain());
+    }
+}
+
+}
+
+BENCHMARK(loki::benchmarks::BM_ParseDomainEagerly)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(loki::benchmarks::BM_ParseDomainLazily)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(loki::benchmarks::BM_ParseDomainLazilyAndMaterialize)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
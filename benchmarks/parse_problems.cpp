@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <benchmark/benchmark.h>
+#include <loki/details/parser.hpp>
+#include <vector>
+
+namespace loki::benchmarks
+{
+
+static std::vector<fs::path> get_woodworking_problem_files()
+{
+    auto problem_files = std::vector<fs::path>();
+    for (size_t i = 1; i <= 30; ++i)
+    {
+        if (i == 11)
+        {
+            // p11 declares objects of type board without names and does not parse.
+            continue;
+        }
+        const auto number = std::to_string(i);
+        problem_files.push_back(fs::path(std::string(DATA_DIR) + "woodworking-sat08-strips/p" + (i < 10 ? "0" : "") + number + ".pddl"));
+    }
+    return problem_files;
+}
+
+/// @brief In this benchmark, we evaluate the performance of parsing problems one after another.
+static void BM_ParseProblemsSequentially(benchmark::State& state)
+{
+    const auto problem_files = get_woodworking_problem_files();
+
+    for (auto _ : state)
+    {
+        auto domain_parser = DomainParser(fs::path(std::string(DATA_DIR) + "woodworking-sat08-strips/domain.pddl"));
+        for (const auto& problem_file : problem_files)
+        {
+            auto problem_parser = ProblemParser(problem_file, domain_parser);
+            benchmark::DoNotOptimize(problem_parser.get_problem());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * problem_files.size());
+}
+
+/// @brief In this benchmark, we evaluate the scaling of parsing problems with the given number of threads.
+static void BM_ParseProblems(benchmark::State& state)
+{
+    const size_t num_threads = state.range(0);
+    const auto problem_files = get_woodworking_problem_files();
+
+    for (auto _ : state)
+    {
+        auto domain_parser = DomainParser(fs::path(std::string(DATA_DIR) + "woodworking-sat08-strips/domain.pddl"));
+        auto problem_parsers = parse_problems(problem_files, domain_parser, num_threads);
+        benchmark::DoNotOptimize(problem_parsers);
+    }
+
+    state.SetItemsProcessed(state.iterations() * problem_files.size());
+}
+
+/// @brief In this benchmark, we evaluate the end-to-end latency of parsing the domain and the problems asynchronously
+///        with the given number of worker threads.
+static void BM_ParseProblemsAsync(benchmark::State& state)
+{
+    const size_t num_threads = state.range(0);
+    const auto problem_files = get_woodworking_problem_files();
+
+    for (auto _ : state)
+    {
+        auto async_parser = AsyncParser(fs::path(std::string(DATA_DIR) + "woodworking-sat08-strips/domain.pddl"), num_threads);
+        auto futures = std::vector<std::future<ProblemParser>>();
+        for (const auto& problem_file : problem_files)
+        {
+            futures.push_back(async_parser.parse_problem(problem_file));
+        }
+        for (auto& future : futures)
+        {
+            benchmark::DoNotOptimize(future.get());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * problem_files.size());
+}
+
+}
+
+BENCHMARK(loki::benchmarks::BM_ParseProblemsSequentially)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(loki::benchmarks::BM_ParseProblems)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(loki::benchmarks::BM_ParseProblemsAsync)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
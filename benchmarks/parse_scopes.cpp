@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <loki/details/parser.hpp>
+#include <loki/details/pddl/scope.hpp>
+
+namespace loki::benchmarks
+{
+
+/// @brief Writes a domain with `num_actions` actions whose preconditions and effects open nested quantifier scopes.
+static fs::path write_domain(size_t num_actions)
+{
+    const auto domain_file = fs::temp_directory_path() / ("loki_parse_scopes_domain_" + std::to_string(num_actions) + ".pddl");
+
+    auto out = std::ofstream(domain_file);
+    out << "(define (domain scopes)\n"
+        << "(:requirements :adl)\n"
+        << "(:types block table)\n"
+        << "(:constants t0 t1 - table)\n"
+        << "(:predicates (on ?x - block ?y - table) (clear ?x - block) (holding ?x - block) (above ?x ?y - block))\n";
+    for (size_t i = 0; i < num_actions; ++i)
+    {
+        out << "(:action act" << i << "\n"
+            << " :parameters (?a ?b - block ?t - table)\n"
+            << " :precondition (and (clear ?a) (on ?a ?t)\n"
+            << "   (forall (?x - block) (or (= ?x ?a) (exists (?y - block) (and (above ?x ?y) (not (holding ?y))))))\n"
+            << "   (exists (?z - table) (forall (?w - block) (imply (on ?w ?z) (clear ?w)))))\n"
+            << " :effect (and (holding ?a) (not (on ?a ?t))\n"
+            << "   (forall (?x - block) (when (above ?x ?a) (and (clear ?x) (not (above ?x ?a)))))\n"
+            << "   (forall (?x ?y - block) (when (and (above ?x ?y) (clear ?b)) (not (clear ?y))))))\n";
+    }
+    out << ")\n";
+
+    return domain_file;
+}
+
+/// @brief In this benchmark, we evaluate the performance of parsing domains whose actions open many nested scopes.
+static void BM_ParseQuantifiedDomain(benchmark::State& state)
+{
+    const size_t num_actions = state.range(0);
+    const auto domain_file = write_domain(num_actions);
+
+    for (auto _ : state)
+    {
+        auto domain_parser = DomainParser(domain_file);
+        benchmark::DoNotOptimize(domain_parser.get_domain());
+    }
+
+    state.SetItemsProcessed(state.iterations() * num_actions);
+}
+
+/// @brief In this benchmark, we evaluate the scope stack in isolation.
+///        Each item opens the scope of an action with nested quantifiers, binds and looks up its variables, and closes the scopes again.
+static void BM_ScopeStackQuantifiers(benchmark::State& state)
+{
+    const auto source = std::string("(define (domain scopes))");
+    const auto error_handler = PDDLErrorHandler(PDDLErrorHandler::position_cache(source.begin(), source.end()));
+    auto factories = PDDLFactories();
+
+    auto variables = std::vector<Variable>();
+    for (size_t i = 0; i < 8; ++i)
+    {
+        variables.push_back(factories.get_or_create_variable("?v" + std::to_string(i)));
+    }
+    auto scopes = ScopeStack(error_handler);
+    scopes.open_scope();
+    for (size_t i = 0; i < 50; ++i)
+    {
+        scopes.top().insert_predicate("p" + std::to_string(i), nullptr, {});
+    }
+
+    const size_t num_items = 1000;
+    for (auto _ : state)
+    {
+        for (size_t item = 0; item < num_items; ++item)
+        {
+            scopes.open_scope();
+            for (size_t i = 0; i < 4; ++i)
+            {
+                scopes.top().insert_variable(variables[i]->get_name(), variables[i], {});
+            }
+            for (size_t depth = 0; depth < 4; ++depth)
+            {
+                scopes.open_scope();
+                scopes.top().insert_variable(variables[4 + depth]->get_name(), variables[4 + depth], {});
+                for (size_t i = 0; i <= 4 + depth; ++i)
+                {
+                    benchmark::DoNotOptimize(scopes.top().get_variable(variables[i]->get_name()));
+                }
+                benchmark::DoNotOptimize(scopes.top().get_predicate("p" + std::to_string(depth)));
+            }
+            for (size_t depth = 0; depth < 4; ++depth)
+            {
+                scopes.close_scope();
+            }
+            scopes.close_scope();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * num_items);
+}
+
+}
+
+BENCHMARK(loki::benchmarks::BM_ScopeStackQuantifiers)->Unit(benchmark::kMicrosecond);
+BENCHMARK(loki::benchmarks::BM_ParseQuantifiedDomain)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <loki/details/parser.hpp>
+
+namespace loki::benchmarks
+{
+
+/// @brief Writes a domain that declares `num_types` types that form a tree below object in which each type has eight subtypes.
+///        The subtypes of every tenth type additionally have a second base type.
+static fs::path write_domain(size_t num_types)
+{
+    const auto domain_file = fs::temp_directory_path() / ("loki_parse_types_domain_" + std::to_string(num_types) + ".pddl");
+
+    auto out = std::ofstream(domain_file);
+    out << "(define (domain types)\n"
+        << "(:requirements :typing)\n"
+        << "(:types\n"
+        << "  t0 - object\n";
+    for (size_t parent = 0; 8 * parent + 1 < num_types; ++parent)
+    {
+        out << " ";
+        for (size_t child = 8 * parent + 1; child <= 8 * parent + 8 && child < num_types; ++child)
+        {
+            out << " t" << child;
+        }
+        if (parent % 10 == 9)
+        {
+            out << " - (either t" << parent << " t" << parent / 2 << ")\n";
+        }
+        else
+        {
+            out << " - t" << parent << "\n";
+        }
+    }
+    out << ")\n"
+        << "(:predicates (at ?x - t0))\n"
+        << ")\n";
+
+    return domain_file;
+}
+
+/// @brief In this benchmark, we evaluate the performance of parsing domains with large type hierarchies.
+static void BM_ParseTypeHierarchy(benchmark::State& state)
+{
+    const size_t num_types = state.range(0);
+    const auto domain_file = write_domain(num_types);
+
+    for (auto _ : state)
+    {
+        auto domain_parser = DomainParser(domain_file);
+        benchmark::DoNotOptimize(domain_parser.get_domain());
+    }
+
+    state.SetItemsProcessed(state.iterations() * num_types);
+}
+
+}
+
+BENCHMARK(loki::benchmarks::BM_ParseTypeHierarchy)->Arg(1000)->Arg(10000)->Arg(20000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <loki/details/parser.hpp>
+
+namespace loki::benchmarks
+{
+
+/// @brief Writes a domain with `num_actions` actions over ten predicates.
+static fs::path write_domain(size_t num_actions)
+{
+    const auto domain_file = fs::temp_directory_path() / ("loki_reparse_domain_" + std::to_string(num_actions) + ".pddl");
+
+    auto out = std::ofstream(domain_file);
+    out << "(define (domain reparse)\n"
+        << "(:requirements :strips :typing :negative-preconditions)\n"
+        << "(:types block)\n"
+        << "(:predicates";
+    for (size_t i = 0; i < 10; ++i)
+    {
+        out << " (p" << i << " ?x - block ?y - block)";
+    }
+    out << ")\n";
+    for (size_t i = 0; i < num_actions; ++i)
+    {
+        out << "(:action a" << i << "\n"
+            << " :parameters (?x - block ?y - block ?z - block)\n"
+            << " :precondition (and (p" << i % 10 << " ?x ?y) (p" << (i + 1) % 10 << " ?y ?z) (not (p" << (i + 2) % 10 << " ?x ?z)))\n"
+            << " :effect (and (p" << (i + 2) % 10 << " ?x ?z) (not (p" << i % 10 << " ?x ?y))))\n";
+    }
+    out << ")\n";
+
+    return domain_file;
+}
+
+/// @brief In this benchmark, we evaluate the performance of parsing the domain, which is the latency of re-parsing the whole source.
+static void BM_ParseDomain(benchmark::State& state)
+{
+    const size_t num_actions = state.range(0);
+    const auto domain_file = write_domain(num_actions);
+
+    for (auto _ : state)
+    {
+        auto domain_parser = DomainParser(domain_file);
+        benchmark::DoNotOptimize(domain_parser.get_domain());
+    }
+}
+
+/// @brief In this benchmark, we evaluate the latency of re-parsing the domain after alternately inserting and removing a precondition
+///        of the action in the middle of the domain.
+static void BM_ReparseAction(benchmark::State& state)
+{
+    const size_t num_actions = state.range(0);
+    const auto domain_file = write_domain(num_actions);
+    auto domain_parser = DomainParser(domain_file);
+
+    const auto action_position = domain_parser.get_source().find("(:action a" + std::to_string(num_actions / 2) + "\n");
+    const auto position = domain_parser.get_source().find("(and ", action_position) + std::string("(and ").size();
+    const auto text = std::string("(p9 ?z ?x) ");
+    bool is_inserted = false;
+
+    for (auto _ : state)
+    {
+        if (is_inserted)
+        {
+            domain_parser.reparse(position, position + text.size(), "");
+        }
+        else
+        {
+            domain_parser.reparse(position, position, text);
+        }
+        is_inserted = !is_inserted;
+        benchmark::DoNotOptimize(domain_parser.get_domain());
+    }
+}
+
+}
+
+BENCHMARK(loki::benchmarks::BM_ParseDomain)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(loki::benchmarks::BM_ReparseAction)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <benchmark/benchmark.h>
+#include <loki/details/parser.hpp>
+#include <loki/details/suite.hpp>
+#include <memory>
+#include <vector>
+
+namespace loki::benchmarks
+{
+
+/// @brief Returns the benchmarks in the data directory without the problem files that do not parse.
+static std::vector<Benchmark> get_valid_benchmarks()
+{
+    auto benchmarks = discover_benchmarks(fs::path(std::string(DATA_DIR)));
+    for (auto& benchmark : benchmarks)
+    {
+        const auto loaded_benchmark = load_benchmark(benchmark, 1);
+        auto problem_files = std::vector<fs::path>();
+        for (const auto& statistics : loaded_benchmark.problem_statistics)
+        {
+            if (statistics.success)
+            {
+                problem_files.push_back(statistics.file_path);
+            }
+        }
+        benchmark.problem_files = std::move(problem_files);
+    }
+    return benchmarks;
+}
+
+static size_t get_num_bytes(const std::vector<Benchmark>& benchmarks)
+{
+    size_t num_bytes = 0;
+    for (const auto& benchmark : benchmarks)
+    {
+        num_bytes += fs::file_size(benchmark.domain_file);
+        for (const auto& problem_file : benchmark.problem_files)
+        {
+            num_bytes += fs::file_size(problem_file);
+        }
+    }
+    return num_bytes;
+}
+
+/// @brief In this benchmark, we evaluate the performance of parsing all files in the data directory.
+static void BM_ParseAll(benchmark::State& state)
+{
+    const auto benchmarks = get_valid_benchmarks();
+
+    for (auto _ : state)
+    {
+        for (const auto& benchmark : benchmarks)
+        {
+            auto domain_parser = DomainParser(benchmark.domain_file);
+            for (const auto& problem_file : benchmark.problem_files)
+            {
+                auto problem_parser = parse_problem(problem_file, domain_parser);
+                benchmark::DoNotOptimize(problem_parser.get_problem());
+            }
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * get_num_bytes(benchmarks));
+}
+
+/// @brief In this benchmark, we evaluate the performance of validating all files in the data directory.
+///        The domain is parsed once for the problems and validated once more on its own.
+static void BM_ValidateAll(benchmark::State& state)
+{
+    const auto benchmarks = get_valid_benchmarks();
+    auto domain_parsers = std::vector<std::unique_ptr<DomainParser>>();
+    for (const auto& benchmark : benchmarks)
+    {
+        domain_parsers.push_back(std::make_unique<DomainParser>(benchmark.domain_file));
+    }
+
+    auto validator = Validator();
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < benchmarks.size(); ++i)
+        {
+            validator.validate_domain(benchmarks[i].domain_file);
+            for (const auto& problem_file : benchmarks[i].problem_files)
+            {
+                validator.validate_problem(problem_file, *domain_parsers[i]);
+            }
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * get_num_bytes(benchmarks));
+}
+
+}
+
+BENCHMARK(loki::benchmarks::BM_ParseAll)->Unit(benchmark::kMillisecond);
+BENCHMARK(loki::benchmarks::BM_ValidateAll)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -22,11 +22,11 @@
 /// @brief Prints an error message when encourtering an And-Condition.
 struct TestUnsupportedAndConditionVisitor
 {
-    const loki::Position position;
+    const loki::SourcePosition position;
     const loki::PDDLPositionCache& position_cache;
     const loki::PDDLErrorHandler& error_handler;
 
-    TestUnsupportedAndConditionVisitor(const loki::Position position_,
+    TestUnsupportedAndConditionVisitor(const loki::SourcePosition position_,
                                        const loki::PDDLPositionCache& position_cache_,
                                        const loki::PDDLErrorHandler& error_handler_) :
         position(position_),
@@ -42,19 +42,19 @@ struct TestUnsupportedAndConditionVisitor
     }
 
     /// @brief For inner nodes we need to recursively call the visitor
-    void operator()(const loki::ConditionOrImpl& node)
+    void operator()(const loki::ConditionOr& node)
     {
-        for (const auto& child_node : node.get_conditions())
+        for (const auto& child_node : node->get_conditions())
         {
             // We call front() to obtain the first occurence.
-            const auto child_position = position_cache.get<loki::ConditionImpl>(child_node).front();
-            std::visit(TestUnsupportedAndConditionVisitor(child_position, position_cache, error_handler), *child_node);
+            const auto child_position = position_cache.get(child_node).front();
+            loki::visit(TestUnsupportedAndConditionVisitor(child_position, position_cache, error_handler), child_node);
         }
     }
 
     /// @brief For the unsupported And-Condition,
     ///        we print an clang-style error message and throw an exception.
-    void operator()(const loki::ConditionAndImpl&)
+    void operator()(const loki::ConditionAnd&)
     {
         std::cout << error_handler(position, "Your awesome error message.") << std::endl;
         throw std::runtime_error("Unexpected And-Condition.");
@@ -80,8 +80,8 @@ int main()
             continue;
         }
         // We call front() to obtain the first occurence.
-        auto condition_position = position_cache.get<loki::ConditionImpl>(condition.value()).front();
-        std::visit(TestUnsupportedAndConditionVisitor(condition_position, position_cache, error_handler), *condition.value());
+        auto condition_position = position_cache.get(condition.value()).front();
+        loki::visit(TestUnsupportedAndConditionVisitor(condition_position, position_cache, error_handler), condition.value());
     }
 
     return 0;
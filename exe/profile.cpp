@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <iostream>
+#include <loki/loki.hpp>
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout << "Usage: profile <domain:str> [<problem:str>]" << std::endl;
+        return 1;
+    }
+    if (!loki::is_parser_profiling_enabled())
+    {
+        std::cout << "Loki was compiled without parser profiling. Reconfigure with -DLOKI_ENABLE_PARSER_PROFILING=ON." << std::endl;
+        return 1;
+    }
+    const auto domain_file = std::string { argv[1] };
+
+    // 1. Parse the domain
+    auto domain_parser = loki::DomainParser(domain_file);
+    std::cout << "Domain " << domain_file << std::endl;
+    loki::print_parser_profiles(std::cout, loki::get_parser_profiles());
+
+    // 2. Parse the problem
+    if (argc >= 3)
+    {
+        const auto problem_file = std::string { argv[2] };
+        loki::reset_parser_profiles();
+        const auto problem_parser = loki::ProblemParser(problem_file, domain_parser);
+        std::cout << std::endl << "Problem " << problem_file << std::endl;
+        loki::print_parser_profiles(std::cout, loki::get_parser_profiles());
+    }
+
+    return 0;
+}
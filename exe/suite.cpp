@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <iostream>
+#include <loki/details/suite.hpp>
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout << "Usage: suite <directory:str> [num_threads:int]" << std::endl;
+        return 1;
+    }
+    const auto directory = std::string { argv[1] };
+    const auto num_threads = (argc > 2) ? std::stoul(argv[2]) : 0UL;
+
+    // Print one JSON object per line and file.
+    for (const auto& benchmark : loki::discover_benchmarks(directory))
+    {
+        const auto loaded_benchmark = loki::load_benchmark(benchmark, num_threads);
+        std::cout << loaded_benchmark.domain_statistics << std::endl;
+        for (const auto& statistics : loaded_benchmark.problem_statistics)
+        {
+            std::cout << statistics << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -595,6 +595,9 @@ struct FunctionExpressionHead : x3::position_tagged
 };
 
 /* Goal Descriptors */
+
+// Nodes that nest goal descriptors or effects hand their children to a queue in their destructors and copy constructors
+// that is drained iteratively, such that destroying and copying deeply nested formulas does not overflow the stack, see ast.cpp.
 struct GoalDescriptor :
     x3::position_tagged,
     x3::variant<x3::forward_ast<GoalDescriptorAtom>,
@@ -624,34 +627,76 @@ struct GoalDescriptorLiteral : x3::position_tagged
 struct GoalDescriptorAnd : x3::position_tagged
 {
     std::vector<GoalDescriptor> goal_descriptors;
+
+    GoalDescriptorAnd() = default;
+    GoalDescriptorAnd(const GoalDescriptorAnd& other);
+    GoalDescriptorAnd& operator=(const GoalDescriptorAnd& other);
+    GoalDescriptorAnd(GoalDescriptorAnd&& other) = default;
+    GoalDescriptorAnd& operator=(GoalDescriptorAnd&& other) = default;
+    ~GoalDescriptorAnd();
 };
 
 struct GoalDescriptorOr : x3::position_tagged
 {
     std::vector<GoalDescriptor> goal_descriptors;
+
+    GoalDescriptorOr() = default;
+    GoalDescriptorOr(const GoalDescriptorOr& other);
+    GoalDescriptorOr& operator=(const GoalDescriptorOr& other);
+    GoalDescriptorOr(GoalDescriptorOr&& other) = default;
+    GoalDescriptorOr& operator=(GoalDescriptorOr&& other) = default;
+    ~GoalDescriptorOr();
 };
 
 struct GoalDescriptorNot : x3::position_tagged
 {
     GoalDescriptor goal_descriptor;
+
+    GoalDescriptorNot() = default;
+    GoalDescriptorNot(const GoalDescriptorNot& other);
+    GoalDescriptorNot& operator=(const GoalDescriptorNot& other);
+    GoalDescriptorNot(GoalDescriptorNot&& other) = default;
+    GoalDescriptorNot& operator=(GoalDescriptorNot&& other) = default;
+    ~GoalDescriptorNot();
 };
 
 struct GoalDescriptorImply : x3::position_tagged
 {
     GoalDescriptor goal_descriptor_left;
     GoalDescriptor goal_descriptor_right;
+
+    GoalDescriptorImply() = default;
+    GoalDescriptorImply(const GoalDescriptorImply& other);
+    GoalDescriptorImply& operator=(const GoalDescriptorImply& other);
+    GoalDescriptorImply(GoalDescriptorImply&& other) = default;
+    GoalDescriptorImply& operator=(GoalDescriptorImply&& other) = default;
+    ~GoalDescriptorImply();
 };
 
 struct GoalDescriptorExists : x3::position_tagged
 {
     TypedListOfVariables typed_list_of_variables;
     GoalDescriptor goal_descriptor;
+
+    GoalDescriptorExists() = default;
+    GoalDescriptorExists(const GoalDescriptorExists& other);
+    GoalDescriptorExists& operator=(const GoalDescriptorExists& other);
+    GoalDescriptorExists(GoalDescriptorExists&& other) = default;
+    GoalDescriptorExists& operator=(GoalDescriptorExists&& other) = default;
+    ~GoalDescriptorExists();
 };
 
 struct GoalDescriptorForall : x3::position_tagged
 {
     TypedListOfVariables typed_list_of_variables;
     GoalDescriptor goal_descriptor;
+
+    GoalDescriptorForall() = default;
+    GoalDescriptorForall(const GoalDescriptorForall& other);
+    GoalDescriptorForall& operator=(const GoalDescriptorForall& other);
+    GoalDescriptorForall(GoalDescriptorForall&& other) = default;
+    GoalDescriptorForall& operator=(GoalDescriptorForall&& other) = default;
+    ~GoalDescriptorForall();
 };
 
 struct GoalDescriptorFunctionComparison : x3::position_tagged
@@ -775,6 +820,13 @@ struct PreconditionGoalDescriptorSimple : x3::position_tagged
 struct PreconditionGoalDescriptorAnd : x3::position_tagged
 {
     std::vector<PreconditionGoalDescriptor> precondition_goal_descriptors;
+
+    PreconditionGoalDescriptorAnd() = default;
+    PreconditionGoalDescriptorAnd(const PreconditionGoalDescriptorAnd& other);
+    PreconditionGoalDescriptorAnd& operator=(const PreconditionGoalDescriptorAnd& other);
+    PreconditionGoalDescriptorAnd(PreconditionGoalDescriptorAnd&& other) = default;
+    PreconditionGoalDescriptorAnd& operator=(PreconditionGoalDescriptorAnd&& other) = default;
+    ~PreconditionGoalDescriptorAnd();
 };
 
 struct PreconditionGoalDescriptorPreference : x3::position_tagged
@@ -787,6 +839,13 @@ struct PreconditionGoalDescriptorForall : x3::position_tagged
 {
     TypedListOfVariables typed_list_of_variables;
     PreconditionGoalDescriptor precondition_goal_descriptor;
+
+    PreconditionGoalDescriptorForall() = default;
+    PreconditionGoalDescriptorForall(const PreconditionGoalDescriptorForall& other);
+    PreconditionGoalDescriptorForall& operator=(const PreconditionGoalDescriptorForall& other);
+    PreconditionGoalDescriptorForall(PreconditionGoalDescriptorForall&& other) = default;
+    PreconditionGoalDescriptorForall& operator=(PreconditionGoalDescriptorForall&& other) = default;
+    ~PreconditionGoalDescriptorForall();
 };
 
 /* <assign-op> */
@@ -833,6 +892,13 @@ struct Effect : x3::position_tagged, x3::variant<x3::forward_ast<EffectProductio
 {
     using base_type::base_type;
     using base_type::operator=;
+
+    Effect() = default;
+    Effect(const Effect& other);
+    Effect& operator=(const Effect& other);
+    Effect(Effect&& other) = default;
+    Effect& operator=(Effect&& other) = default;
+    ~Effect();
 };
 
 struct EffectProductionLiteral : x3::position_tagged
@@ -864,12 +930,26 @@ struct EffectConditionalForall : x3::position_tagged
 {
     TypedListOfVariables typed_list_of_variables;
     Effect effect;
+
+    EffectConditionalForall() = default;
+    EffectConditionalForall(const EffectConditionalForall& other);
+    EffectConditionalForall& operator=(const EffectConditionalForall& other);
+    EffectConditionalForall(EffectConditionalForall&& other) = default;
+    EffectConditionalForall& operator=(EffectConditionalForall&& other) = default;
+    ~EffectConditionalForall();
 };
 
 struct EffectConditionalWhen : x3::position_tagged
 {
     GoalDescriptor goal_descriptor;
     Effect effect;
+
+    EffectConditionalWhen() = default;
+    EffectConditionalWhen(const EffectConditionalWhen& other);
+    EffectConditionalWhen& operator=(const EffectConditionalWhen& other);
+    EffectConditionalWhen(EffectConditionalWhen&& other) = default;
+    EffectConditionalWhen& operator=(EffectConditionalWhen&& other) = default;
+    ~EffectConditionalWhen();
 };
 
 struct EffectConditional : x3::position_tagged, x3::variant<EffectConditionalForall, EffectConditionalWhen>
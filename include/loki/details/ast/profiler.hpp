@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LOKI_INCLUDE_LOKI_AST_PROFILER_HPP_
+#define LOKI_INCLUDE_LOKI_AST_PROFILER_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace loki
+{
+
+/// @brief `RuleProfile` holds the statistics that the grammar profiler collected for one rule.
+///
+///        A backtrack is a call that did not match, i.e., the caller continues with the next alternative.
+///        An exception is a call that was left by an exception, e.g., an expectation failure.
+///        The self time excludes the time spent in nested rules.
+struct RuleProfile
+{
+    // The identifier of the rule in the grammar, e.g., "domain_keyword" for the keyword `domain`.
+    std::string name;
+    size_t num_invocations;
+    size_t num_successes;
+    size_t num_backtracks;
+    size_t num_exceptions;
+    std::chrono::nanoseconds total_time;
+    std::chrono::nanoseconds self_time;
+};
+
+/// @brief Returns true if the library was compiled with LOKI_ENABLE_PARSER_PROFILING.
+///        Otherwise, the rules are not instrumented and no profiles are collected.
+extern bool is_parser_profiling_enabled();
+
+/// @brief Returns the profiles of all rules that were invoked since the last reset, sorted by decreasing self time.
+///        The profiles accumulate over all parses of all threads.
+extern std::vector<RuleProfile> get_parser_profiles();
+
+/// @brief Resets the statistics of all rules.
+///        Must not be called while parsing.
+extern void reset_parser_profiles();
+
+/// @brief Prints a table of the profiles sorted by decreasing self time.
+extern void print_parser_profiles(std::ostream& out, const std::vector<RuleProfile>& profiles);
+
+}
+
+#endif
@@ -46,6 +46,18 @@ public:
     explicit NotImplementedError(const std::string& message);
 };
 
+class FrozenError : public std::runtime_error
+{
+public:
+    explicit FrozenError(const std::string& message);
+};
+
+class DecompressionError : public std::runtime_error
+{
+public:
+    explicit DecompressionError(const std::string& path_to_file, const std::string& message);
+};
+
 }
 
 #endif
\ No newline at end of file
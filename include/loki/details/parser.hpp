@@ -21,17 +21,70 @@
 #include "loki/details/pddl/context.hpp"
 #include "loki/details/pddl/declarations.hpp"
 #include "loki/details/utils/filesystem.hpp"
+#include "loki/details/utils/thread_pool.hpp"
+
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace loki
 {
 
+/// @brief The options of `DomainParser`.
+struct DomainParserOptions
+{
+    /// @brief Throw an error instead of printing a warning, e.g., for unused predicates.
+    bool strict = false;
+    /// @brief Do not print progress and warnings.
+    bool quiet = true;
+    /// @brief Store only the first occurrence of each PDDL object in the position cache.
+    bool first_occurrence_only = false;
+    /// @brief If not 1, then the actions and axioms are parsed concurrently on `num_threads` worker threads,
+    ///        or one worker per hardware thread if `num_threads` is 0. The order of the actions and axioms stays the order in the file.
+    size_t num_threads = 1;
+    /// @brief If true and `strict` is false, then only the names and the parameters of the actions are parsed, one after another,
+    ///        and the condition and the effect of each action are parsed on its first access, or by `DomainParser::materialize`.
+    ///        Semantic errors in the conditions and effects are thrown on access, unused parameters are kept,
+    ///        and unused predicates and function skeletons are not reported. Axioms are parsed eagerly
+    ///        since their parameters include the free variables of their conditions.
+    bool lazy = false;
+};
+
+/// @brief The options of `ProblemParser`.
+struct ProblemParserOptions
+{
+    /// @brief Throw an error instead of printing a warning.
+    bool strict = false;
+    /// @brief Do not print progress and warnings.
+    bool quiet = true;
+    /// @brief Store only the first occurrence of each PDDL object in the position cache.
+    bool first_occurrence_only = false;
+    /// @brief If not 1, then the initial elements are parsed concurrently in chunks on `num_threads` worker threads,
+    ///        or one worker per hardware thread if `num_threads` is 0. The order of the initial literals stays the order in the file.
+    size_t num_threads = 1;
+};
+
 class DomainParser
 {
 private:
+    /// @brief The location of a structure, i.e., an action or an axiom, in the source.
+    struct StructureLocation
+    {
+        // The byte range of the structure in the source
+        size_t first;
+        size_t last;
+        bool is_action;
+    };
+
     fs::path m_filepath;
     // We need to keep the source in memory for error reporting.
     std::string m_source;
 
+    // The options, where `lazy` is false if `strict` is true.
+    DomainParserOptions m_options;
+
     PDDLFactories m_factories;
 
     // The matched positions in the input PDDL file.
@@ -42,25 +95,104 @@ private:
     // Parsed result
     Domain m_domain;
 
+    // For re-parsing single structures after an edit: the locations of the structures in the order of the file,
+    // the end of the sections before the structures, and the position of the domain.
+    std::vector<StructureLocation> m_structures;
+    size_t m_sections_last;
+    SourcePosition m_domain_position;
+
+    // Parses the conditions and effects of the lazy actions on first access, or nullptr if the domain is parsed eagerly.
+    struct LazyActions;
+    std::unique_ptr<LazyActions> m_lazy_actions;
+
     friend class ProblemParser;
+    friend class DomainRegistry;
+    friend class Validator;
+
+    DomainParser(const fs::path& file_path, std::string source, const DomainParserOptions& options);
+
+    /// @brief Parse the `source` into the factories. If parsing fails, then the parser is left unchanged.
+    void parse(std::string source);
+
+    /// @brief Re-parse the structure that encloses the byte range [first, last) of the source that is replaced by `text`.
+    ///        Returns false without modifying the parser if the edit is not enclosed by a structure
+    ///        or if the edited structure does not parse into a single structure.
+    bool reparse_structure(size_t first, size_t last, const std::string& text);
 
 public:
-    DomainParser(const fs::path& file_path, bool strict = false, bool quiet = true);
+    /// @brief Parse the domain file with the given `options`, e.g., `DomainParser(file_path, { .num_threads = 4 })`.
+    explicit DomainParser(const fs::path& file_path, const DomainParserOptions& options = DomainParserOptions());
+    /// @brief Parse the domain file with the options `{ .strict = strict, .quiet = quiet }`.
+    DomainParser(const fs::path& file_path, bool strict, bool quiet = true);
     DomainParser(const DomainParser& other) = delete;
     DomainParser& operator=(const DomainParser& other) = delete;
-    DomainParser(DomainParser&& other) = default;
-    DomainParser& operator=(DomainParser&& other) = default;
+    DomainParser(DomainParser&& other);
+    DomainParser& operator=(DomainParser&& other);
+    ~DomainParser();
 
     /// @brief Get factories to create additional PDDL objects.
     PDDLFactories& get_factories();
+    const PDDLFactories& get_factories() const;
 
     /// @brief Get position caches to be able to reference back to the input PDDL file.
     const PDDLPositionCache& get_position_cache() const;
 
     /// @brief Get the parsed domain.
     const Domain& get_domain() const;
+
+    /// @brief Get the normalized source of the domain file, see `read_file`, to which the byte offsets of `reparse` refer.
+    const std::string& get_source() const;
+
+    /// @brief Replace the bytes in [first, last) of the source by the `text`, which is normalized like the source, and re-parse the domain.
+    ///
+    ///        If the edit lies within a single action or axiom, or the whitespace around it, then only this structure is re-parsed,
+    ///        and the domain is recreated with the other actions and axioms as they are.
+    ///        Otherwise, e.g., after an edit of the sections before the structures, the whole source is re-parsed.
+    ///        In both cases, the PDDL objects are created in the existing factories, hence, unchanged actions and axioms are reused.
+    ///        If the edited source does not parse, then the exception is thrown and the parser is left unchanged.
+    ///
+    ///        The previous domain and its PDDL objects stay valid. Problems that were parsed against this domain parser
+    ///        refer to the previous domain and must be parsed again. The factories must not be frozen.
+    ///        Unused predicates and function skeletons are only reported when the whole source is re-parsed,
+    ///        hence, strict domain parsers always re-parse the whole source.
+    ///        Lazy actions are materialized before the source is re-parsed since they refer to the matched positions of the previous source,
+    ///        and a single re-parsed structure is parsed eagerly.
+    void reparse(size_t first, size_t last, std::string_view text);
+
+    /// @brief Parse the conditions and effects of the lazy actions of the domain that were not accessed before.
+    ///        The lazy actions create PDDL objects in the factories on first access, hence, the domain is materialized
+    ///        before problems are parsed into factories that extend its factories, and by `freeze`.
+    ///        Afterwards, the matched positions of the parser are released, which a domain without lazy actions does right after parsing.
+    ///        Concurrent calls return after all lazy actions were materialized.
+    void materialize() const;
+
+    /// @brief Materialize the lazy actions and reject the creation of further PDDL objects in the factories such that the domain and its factories
+    ///        can be read concurrently. Problems can still be parsed with `parse_problem`, `parse_problems` or `AsyncParser`
+    ///        since they create PDDL objects in factories of their own. If `shrink_to_fit` is true, then unused memory is released.
+    void freeze(bool shrink_to_fit = false);
 };
 
+class ProblemParser;
+
+/// @brief Parse the problem file against the domain of the `domain_parser` into its own `PDDLFactories` that extend the factories of the domain.
+///        Hence, the `domain_parser` is not modified, except that its lazy actions are materialized first,
+///        and can be shared by concurrent calls, e.g., after it was frozen.
+extern ProblemParser parse_problem(const fs::path& file_path, const DomainParser& domain_parser, const ProblemParserOptions& options = ProblemParserOptions());
+
+/// @brief Parse the problem files against the domain of the `domain_parser` on `num_threads` worker threads.
+///        If `num_threads` is 0 then one worker per hardware thread is used.
+///
+///        Each problem is parsed into its own `PDDLFactories` that extend the factories of the domain.
+///        Hence, the indices of the PDDL objects of a problem continue the indices of the domain
+///        and depend neither on the number of threads nor on the other problem files.
+///        The `domain_parser` must not be modified until the parsing is finished.
+///        If parsing a problem file fails, then the first exception in order of the files is rethrown.
+///        The initial elements of each problem are parsed sequentially, i.e., `options.num_threads` is ignored.
+extern std::vector<ProblemParser> parse_problems(const std::vector<fs::path>& file_paths,
+                                                 const DomainParser& domain_parser,
+                                                 size_t num_threads = 0,
+                                                 const ProblemParserOptions& options = ProblemParserOptions());
+
 class ProblemParser
 {
 private:
@@ -68,6 +200,10 @@ private:
     // We need to keep the source in memory for error reporting.
     std::string m_source;
 
+    // The factories of the problem if they are not shared with the domain.
+    std::unique_ptr<PDDLFactories> m_own_factories;
+    PDDLFactories* m_factories;
+
     // The matched positions in the input PDDL file.
     std::unique_ptr<PDDLPositionCache> m_position_cache;
 
@@ -76,20 +212,123 @@ private:
     // Parsed result
     Problem m_problem;
 
+    struct ProblemAST;
+
+    static std::unique_ptr<ProblemAST> parse_problem_ast(const fs::path& file_path, bool quiet);
+
+    ProblemParser(std::unique_ptr<ProblemAST> problem_ast,
+                  const fs::path& file_path,
+                  const DomainParser& domain_parser,
+                  std::unique_ptr<PDDLFactories> own_factories,
+                  const ProblemParserOptions& options);
+
+    void parse(const DomainParser& domain_parser, ProblemAST& problem_ast, const ProblemParserOptions& options);
+
+    friend ProblemParser parse_problem(const fs::path& file_path, const DomainParser& domain_parser, const ProblemParserOptions& options);
+
+    friend class AsyncParser;
+
 public:
-    ProblemParser(const fs::path& file_path, DomainParser& domain_parser, bool strict = false, bool quiet = true);
+    /// @brief Parse the problem file with the given `options` into the factories of the `domain_parser`.
+    ProblemParser(const fs::path& file_path, DomainParser& domain_parser, const ProblemParserOptions& options = ProblemParserOptions());
+    /// @brief Parse the problem file with the options `{ .strict = strict, .quiet = quiet }` into the factories of the `domain_parser`.
+    ProblemParser(const fs::path& file_path, DomainParser& domain_parser, bool strict, bool quiet = true);
     ProblemParser(const ProblemParser& other) = delete;
     ProblemParser& operator=(const ProblemParser& other) = delete;
     ProblemParser(ProblemParser&& other) = default;
     ProblemParser& operator=(ProblemParser&& other) = default;
 
+    /// @brief Get factories to create additional PDDL objects.
+    ///        These are the factories of the domain, unless the problem was parsed with `parse_problem` or `parse_problems`.
+    PDDLFactories& get_factories();
+
     /// @brief Get position caches to be able to reference back to the input PDDL file.
     const PDDLPositionCache& get_position_cache() const;
 
     /// @brief Get the parsed problem.
     const Problem& get_problem() const;
+
+    /// @brief Reject the creation of further PDDL objects in the factories such that the problem and its factories
+    ///        can be read concurrently. If `shrink_to_fit` is true, then unused memory is released.
+    void freeze(bool shrink_to_fit = false);
+};
+
+/// @brief `AsyncParser` parses a domain file and problem files in the background and returns futures to the results.
+///
+///        Problem files are read and syntactically parsed one after another on an I/O thread,
+///        which does not depend on the domain. Hence, the I/O of the next problem file overlaps with the semantic parse
+///        of the domain and of previous problem files on the worker threads. The semantic parse of a problem waits for the domain.
+///        Each problem is parsed into its own `PDDLFactories` that extend the factories of the domain, as in `parse_problems`.
+///        Exceptions are rethrown by the `get` function of the respective future.
+///        The problems refer to the domain, hence, a copy of the domain future must be kept while the problems are used.
+///        The destructor waits until all scheduled files are parsed.
+class AsyncParser
+{
+private:
+    ProblemParserOptions m_problem_options;
+
+    ThreadPool m_io_thread;
+    ThreadPool m_workers;
+
+    std::shared_future<std::shared_ptr<const DomainParser>> m_domain;
+
+public:
+    /// @brief Schedules parsing the domain file on `num_threads` worker threads, or one per hardware thread if `num_threads` is 0.
+    ///        The problems are parsed with the `problem_options`, where the initial elements are parsed sequentially, i.e., `problem_options.num_threads` is ignored.
+    ///        Lazy actions of the domain are materialized before the first problem is parsed.
+    explicit AsyncParser(const fs::path& domain_file_path,
+                         size_t num_threads = 0,
+                         const DomainParserOptions& domain_options = DomainParserOptions(),
+                         const ProblemParserOptions& problem_options = ProblemParserOptions());
+
+    /// @brief Get the future to the parsed domain.
+    const std::shared_future<std::shared_ptr<const DomainParser>>& get_domain() const;
+
+    /// @brief Schedules parsing the problem file and returns a future to the parsed problem.
+    std::future<ProblemParser> parse_problem(const fs::path& problem_file_path);
+};
+
+/// @brief `Validator` runs the syntactic and semantic checks of `DomainParser` and `ProblemParser` without keeping the results,
+///        e.g., to check many files quickly. Errors are thrown as by the parsers.
+///
+///        The PDDL objects of a file are created in factories that are cleared before the next file,
+///        which reuses their memory as well as the buffer for the content of the file.
+///        Only the first occurrence of each PDDL object is stored in the position cache.
+///        A `Validator` must not be used from multiple threads concurrently.
+class Validator
+{
+private:
+    DomainParserOptions m_domain_options;
+    ProblemParserOptions m_problem_options;
+
+    // Buffers that are reused between files.
+    std::string m_source;
+    PDDLFactories m_domain_factories;
+    std::unique_ptr<PDDLFactories> m_problem_factories;
+
+    void validate_domain(const fs::path& file_path, DiagnosticSink* diagnostics);
+    void validate_problem(const fs::path& file_path, const DomainParser& domain_parser, DiagnosticSink* diagnostics);
+
+public:
+    /// @brief Validate domains with the `domain_options` and problems with the `problem_options`.
+    ///        The structures of a domain and the initial elements of a problem are parsed with `num_threads` threads
+    ///        with the same diagnostics as sequential parsing. The options `quiet`, `first_occurrence_only` and `lazy` are ignored.
+    explicit Validator(const DomainParserOptions& domain_options = DomainParserOptions(), const ProblemParserOptions& problem_options = ProblemParserOptions());
+
+    void validate_domain(const fs::path& file_path);
+
+    /// @brief Validate the problem file against the domain of the `domain_parser`, which is not modified.
+    void validate_problem(const fs::path& file_path, const DomainParser& domain_parser);
+
+    /// @brief Validate the domain file and record all errors and warnings in `diagnostics` instead of throwing on the first error.
+    ///        After a semantic error, the offending structure is skipped and parsing continues until the sink is full.
+    ///        A syntax error stops the validation and is recorded as a single diagnostic.
+    void diagnose_domain(const fs::path& file_path, DiagnosticSink& diagnostics);
+
+    /// @brief Validate the problem file against the domain of the `domain_parser` like `diagnose_domain`.
+    void diagnose_problem(const fs::path& file_path, const DomainParser& domain_parser, DiagnosticSink& diagnostics);
 };
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -20,33 +20,68 @@
 
 #include "loki/details/pddl/declarations.hpp"
 
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <tuple>
 
 namespace loki
 {
+
+/// @brief `LazyActionBody` parses the condition and the effect of an action on first access, see `DomainParser`.
+///        The parsing is serialized with the `mutex` that is shared by the actions of a domain since it creates PDDL objects in its factories.
+class LazyActionBody
+{
+public:
+    using ParseFunction = std::function<std::tuple<std::optional<Condition>, std::optional<Effect>>(const ActionImpl& action)>;
+
+private:
+    ParseFunction m_parse;
+    std::mutex& m_mutex;
+    std::atomic_bool m_is_materialized;
+
+public:
+    LazyActionBody(ParseFunction parse, std::mutex& mutex);
+
+    /// @brief Parses the condition and the effect of the `action` unless they were parsed before.
+    ///        If parsing throws, then the exception is propagated and parsing is repeated on the next access.
+    void materialize(const ActionImpl& action);
+
+    bool is_materialized() const;
+};
+
 class ActionImpl
 {
 private:
     size_t m_index;
-    std::string m_name;
+    std::string_view m_name;
     // Indicate the original subseteq of variables before adding parameters during translations
     size_t m_original_arity;
     ParameterList m_parameters;
-    std::optional<Condition> m_condition;
-    std::optional<Effect> m_effect;
+    mutable std::optional<Condition> m_condition;
+    mutable std::optional<Effect> m_effect;
+    // Parses the condition and the effect on first access if the action was parsed lazily.
+    std::unique_ptr<LazyActionBody> m_lazy_body;
 
     ActionImpl(size_t index,
-               std::string name,
+               std::string_view name,
                size_t original_arity,
                ParameterList parameters,
                std::optional<Condition> condition,
-               std::optional<Effect> effect);
+               std::optional<Effect> effect,
+               std::unique_ptr<LazyActionBody> lazy_body = nullptr);
 
     // Give access to the constructor.
     template<typename HolderType, typename Hash, typename EqualTo>
     friend class UniqueFactory;
 
+    // Give access to the condition and the effect.
+    friend class LazyActionBody;
+
 public:
     // moveable but not copyable
     ActionImpl(const ActionImpl& other) = delete;
@@ -55,11 +90,19 @@ public:
     ActionImpl& operator=(ActionImpl&& other) = default;
 
     size_t get_index() const;
-    const std::string& get_name() const;
+    std::string_view get_name() const;
     size_t get_original_arity() const;
     const ParameterList& get_parameters() const;
+    /// @brief Get the condition and the effect, which are parsed on first access if the action was parsed lazily.
     const std::optional<Condition>& get_condition() const;
     const std::optional<Effect>& get_effect() const;
+
+    /// @brief Returns true if the condition and the effect are parsed on first access.
+    ///        Lazy actions are unique, i.e., they are equal to no other action, since their bodies are unknown when they are created.
+    bool is_lazy() const;
+
+    /// @brief Parses the condition and the effect if the action is lazy and they were not accessed before.
+    void materialize() const;
 };
 
 extern std::ostream& operator<<(std::ostream& out, const ActionImpl& element);
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOKI_INCLUDE_LOKI_PDDL_ATOM_INDEX_HPP_
+#define LOKI_INCLUDE_LOKI_PDDL_ATOM_INDEX_HPP_
+
+#include "loki/details/pddl/declarations.hpp"
+
+#include <span>
+#include <vector>
+
+namespace loki
+{
+
+/// @brief `AtomIndex` is an immutable index over a set of ground atoms.
+///
+///        The atoms are grouped by predicate and stored contiguously
+///        such that all atoms of a predicate form a single range.
+///        Membership is tested in constant time with a bitset
+///        that is keyed on the dense atom index.
+class AtomIndex
+{
+private:
+    // The atoms sorted by predicate index first and atom index second.
+    AtomList m_atoms;
+    // The atoms of predicate with index i are in range [m_offsets[i], m_offsets[i+1]).
+    std::vector<size_t> m_offsets;
+    // The bit at position i is set if the atom with index i is contained.
+    std::vector<bool> m_contained;
+
+public:
+    AtomIndex();
+    explicit AtomIndex(const AtomList& atoms);
+
+    /// @brief Returns true iff the atom is contained.
+    bool contains(const Atom& atom) const;
+
+    /// @brief Returns the contiguous range of contained atoms of the given predicate.
+    std::span<const Atom> get_atoms(const Predicate& predicate) const;
+
+    /// @brief Returns all contained atoms grouped by predicate.
+    const AtomList& get_atoms() const;
+
+    size_t size() const;
+};
+
+}
+
+#endif
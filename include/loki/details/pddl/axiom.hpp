@@ -21,6 +21,7 @@
 #include "loki/details/pddl/declarations.hpp"
 
 #include <string>
+#include <string_view>
 
 namespace loki
 {
@@ -28,12 +29,12 @@ class AxiomImpl
 {
 private:
     size_t m_index;
-    std::string m_derived_predicate_name;
+    std::string_view m_derived_predicate_name;
     ParameterList m_parameters;
     Condition m_condition;
     size_t m_num_parameters_to_ground_head;
 
-    AxiomImpl(size_t index, std::string derived_predicate_name, ParameterList parameters, Condition condition, size_t num_parameters_to_ground_head);
+    AxiomImpl(size_t index, std::string_view derived_predicate_name, ParameterList parameters, Condition condition, size_t num_parameters_to_ground_head);
 
     // Give access to the constructor.
     template<typename HolderType, typename Hash, typename EqualTo>
@@ -47,7 +48,7 @@ public:
     AxiomImpl& operator=(AxiomImpl&& other) = default;
 
     size_t get_index() const;
-    const std::string& get_derived_predicate_name() const;
+    std::string_view get_derived_predicate_name() const;
     const ParameterList& get_parameters() const;
     const Condition& get_condition() const;
     size_t get_num_parameters_to_ground_head() const;
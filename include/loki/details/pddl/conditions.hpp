@@ -206,7 +206,7 @@ extern std::ostream& operator<<(std::ostream& out, const ConditionNotImpl& eleme
 extern std::ostream& operator<<(std::ostream& out, const ConditionImplyImpl& element);
 extern std::ostream& operator<<(std::ostream& out, const ConditionExistsImpl& element);
 extern std::ostream& operator<<(std::ostream& out, const ConditionForallImpl& element);
-extern std::ostream& operator<<(std::ostream& out, const ConditionImpl& element);
+extern std::ostream& operator<<(std::ostream& out, const Condition& element);
 
 }
 
@@ -18,6 +18,7 @@
 #ifndef LOKI_INCLUDE_LOKI_PDDL_CONTEXT_HPP_
 #define LOKI_INCLUDE_LOKI_PDDL_CONTEXT_HPP_
 
+#include "loki/details/pddl/diagnostics.hpp"
 #include "loki/details/pddl/factories.hpp"
 #include "loki/details/pddl/position.hpp"
 #include "loki/details/pddl/reference.hpp"
@@ -44,8 +45,15 @@ struct Context
     ReferencedPDDLObjects references;
     // For convenience, to avoid an additional parameter during semantic parsing
     Requirements requirements;
+    // For collecting errors and warnings instead of throwing on the first error, if not nullptr
+    DiagnosticSink* diagnostics;
 
-    Context(PDDLFactories& factories_, PDDLPositionCache& positions_, ScopeStack& scopes_, bool strict_ = false, bool quiet_ = true) :
+    Context(PDDLFactories& factories_,
+            PDDLPositionCache& positions_,
+            ScopeStack& scopes_,
+            bool strict_ = false,
+            bool quiet_ = true,
+            DiagnosticSink* diagnostics_ = nullptr) :
         factories(factories_),
         positions(positions_),
         scopes(scopes_),
@@ -53,7 +61,8 @@ struct Context
         quiet(quiet_),
         allow_free_variables(false),
         references(ReferencedPDDLObjects()),
-        requirements(nullptr)
+        requirements(nullptr),
+        diagnostics(diagnostics_)
     {
     }
 };
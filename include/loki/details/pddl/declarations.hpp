@@ -18,6 +18,8 @@
 #ifndef LOKI_INCLUDE_LOKI_PDDL_DECLARATIONS_HPP_
 #define LOKI_INCLUDE_LOKI_PDDL_DECLARATIONS_HPP_
 
+#include "loki/details/utils/tagged_pointer.hpp"
+
 #include <cstddef>
 #include <unordered_map>
 #include <unordered_set>
@@ -100,9 +102,9 @@ using ConditionImply = const ConditionImplyImpl*;
 class ConditionExistsImpl;
 using ConditionExists = const ConditionExistsImpl*;
 class ConditionForallImpl;
-using ConditionImpl =
-    std::variant<ConditionLiteralImpl, ConditionAndImpl, ConditionOrImpl, ConditionNotImpl, ConditionImplyImpl, ConditionExistsImpl, ConditionForallImpl>;
-using Condition = const ConditionImpl*;
+using ConditionForall = const ConditionForallImpl*;
+// Each alternative is stored by its own factory, the tagged pointer is a handle of a single word that is passed by value.
+using Condition = TaggedPointer<ConditionLiteral, ConditionAnd, ConditionOr, ConditionNot, ConditionImply, ConditionExists, ConditionForall>;
 using ConditionList = std::vector<Condition>;
 
 class EffectLiteralImpl;
@@ -115,8 +117,7 @@ class EffectConditionalForallImpl;
 using EffectConditionalForall = const EffectConditionalForallImpl*;
 class EffectConditionalWhenImpl;
 using EffectConditionalWhen = const EffectConditionalWhenImpl*;
-using EffectImpl = std::variant<EffectLiteralImpl, EffectAndImpl, EffectNumericImpl, EffectConditionalForallImpl, EffectConditionalWhenImpl>;
-using Effect = const EffectImpl*;
+using Effect = TaggedPointer<EffectLiteral, EffectAnd, EffectNumeric, EffectConditionalForall, EffectConditionalWhen>;
 using EffectList = std::vector<Effect>;
 
 class FunctionExpressionNumberImpl;
@@ -129,12 +130,11 @@ class FunctionExpressionMinusImpl;
 using FunctionExpressionMinus = const FunctionExpressionMinusImpl*;
 class FunctionExpressionFunctionImpl;
 using FunctionExpressionFunction = const FunctionExpressionFunctionImpl*;
-using FunctionExpressionImpl = std::variant<FunctionExpressionNumberImpl,
-                                            FunctionExpressionBinaryOperatorImpl,
-                                            FunctionExpressionMultiOperatorImpl,
-                                            FunctionExpressionMinusImpl,
-                                            FunctionExpressionFunctionImpl>;
-using FunctionExpression = const FunctionExpressionImpl*;
+using FunctionExpression = TaggedPointer<FunctionExpressionNumber,
+                                         FunctionExpressionBinaryOperator,
+                                         FunctionExpressionMultiOperator,
+                                         FunctionExpressionMinus,
+                                         FunctionExpressionFunction>;
 using FunctionExpressionList = std::vector<FunctionExpression>;
 
 class FunctionSkeletonImpl;
@@ -153,6 +153,8 @@ class ActionImpl;
 using Action = const ActionImpl*;
 using ActionList = std::vector<Action>;
 
+class LazyActionBody;
+
 class AxiomImpl;
 using Axiom = const AxiomImpl*;
 using AxiomList = std::vector<Axiom>;
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LOKI_INCLUDE_LOKI_PDDL_DIAGNOSTICS_HPP_
+#define LOKI_INCLUDE_LOKI_PDDL_DIAGNOSTICS_HPP_
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace loki
+{
+
+enum class DiagnosticSeverityEnum
+{
+    ERROR,
+    WARNING,
+};
+
+extern const std::string& to_string(DiagnosticSeverityEnum severity);
+
+/// @brief `Diagnostic` is an error or warning that was found during semantic parsing.
+///        The line and column are 1-based and are 0 if the position is unknown.
+struct Diagnostic
+{
+    DiagnosticSeverityEnum severity;
+    size_t line;
+    size_t column;
+    // The message of the error handler including the offending line.
+    std::string message;
+};
+
+/// @brief `DiagnosticSink` collects the diagnostics of a parse instead of throwing on the first error.
+///
+///        Parsing continues after an error by skipping the offending structure,
+///        e.g., the literal, action, or initial element that contains it.
+///        The parse stops at the first diagnostic that exceeds `max_num_diagnostics`, which is dropped.
+///
+///        Skipping a structure and stopping the parse still unwind the stack with an internal signal
+///        because the semantic parsers return the constructed structure and have no error result.
+///        The unwinding happens once per skipped structure and once at the limit, i.e., at most
+///        `max_num_diagnostics + 1` times per parse, and never when the input has no errors.
+class DiagnosticSink
+{
+private:
+    size_t m_max_num_diagnostics;
+
+    std::vector<Diagnostic> m_diagnostics;
+    size_t m_num_errors;
+    bool m_truncated;
+
+public:
+    explicit DiagnosticSink(size_t max_num_diagnostics = 100);
+
+    /// @brief Records the diagnostic. Returns false if it was dropped because the sink is full.
+    bool add(Diagnostic diagnostic);
+
+    /// @brief Removes all diagnostics.
+    void clear();
+
+    bool is_full() const;
+    bool has_errors() const;
+    /// @brief Returns true if a diagnostic was dropped, i.e., the parse stopped early.
+    bool is_truncated() const;
+
+    size_t get_max_num_diagnostics() const;
+    const std::vector<Diagnostic>& get_diagnostics() const;
+    size_t get_num_errors() const;
+    size_t get_num_warnings() const;
+};
+
+extern std::ostream& operator<<(std::ostream& out, const Diagnostic& diagnostic);
+
+}
+
+#endif
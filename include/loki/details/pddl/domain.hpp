@@ -20,9 +20,11 @@
 
 #include "loki/details/pddl/declarations.hpp"
 #include "loki/details/utils/filesystem.hpp"
+#include "loki/details/utils/name_index.hpp"
 
 #include <optional>
 #include <string>
+#include <string_view>
 
 namespace loki
 {
@@ -41,6 +43,13 @@ private:
     ActionList m_actions;
     AxiomList m_axioms;
 
+    // Derived name indexes for efficient lookup by name.
+    NameIndex<Type> m_types_by_name;
+    NameIndex<Object> m_constants_by_name;
+    NameIndex<Predicate> m_predicates_by_name;
+    NameIndex<FunctionSkeleton> m_functions_by_name;
+    NameIndex<Action> m_actions_by_name;
+
     DomainImpl(size_t index,
                std::optional<fs::path> filepath,
                std::string name,
@@ -73,6 +82,13 @@ public:
     const FunctionSkeletonList& get_functions() const;
     const ActionList& get_actions() const;
     const AxiomList& get_axioms() const;
+
+    /// @brief Find an element by name in constant expected time.
+    std::optional<Type> find_type(std::string_view name) const;
+    std::optional<Object> find_constant(std::string_view name) const;
+    std::optional<Predicate> find_predicate(std::string_view name) const;
+    std::optional<FunctionSkeleton> find_function_skeleton(std::string_view name) const;
+    std::optional<Action> find_action(std::string_view name) const;
 };
 
 extern std::ostream& operator<<(std::ostream& out, const DomainImpl& element);
@@ -62,6 +62,26 @@ struct UniquePDDLEqualTo<std::variant<Ts...>>
     }
 };
 
+/// Spezialization for TaggedPointer, whose alternatives are compared through the specialization of their pointer type.
+template<typename... Ts>
+struct UniquePDDLEqualTo<TaggedPointer<Ts...>>
+{
+    bool operator()(const TaggedPointer<Ts...>& l, const TaggedPointer<Ts...>& r) const
+    {
+        if (l.index() != r.index())
+        {
+            return false;  // Different types held
+        }
+        return visit(
+            [&r](const auto& lhs)
+            {
+                using ArgType = std::decay_t<decltype(lhs)>;
+                return UniquePDDLEqualTo<ArgType>()(lhs, r.template get_unchecked<ArgType>());
+            },
+            l);
+    }
+};
+
 /**
  * Specializations for PDDL
  */
@@ -85,51 +105,45 @@ struct UniquePDDLEqualTo<const AxiomImpl*>
 };
 
 template<>
-struct UniquePDDLEqualTo<const ConditionLiteralImpl&>
+struct UniquePDDLEqualTo<const ConditionLiteralImpl*>
 {
-    bool operator()(const ConditionLiteralImpl& l, const ConditionLiteralImpl& r) const;
+    bool operator()(const ConditionLiteralImpl* l, const ConditionLiteralImpl* r) const;
 };
 
 template<>
-struct UniquePDDLEqualTo<const ConditionAndImpl&>
+struct UniquePDDLEqualTo<const ConditionAndImpl*>
 {
-    bool operator()(const ConditionAndImpl& l, const ConditionAndImpl& r) const;
+    bool operator()(const ConditionAndImpl* l, const ConditionAndImpl* r) const;
 };
 
 template<>
-struct UniquePDDLEqualTo<const ConditionOrImpl&>
+struct UniquePDDLEqualTo<const ConditionOrImpl*>
 {
-    bool operator()(const ConditionOrImpl& l, const ConditionOrImpl& r) const;
+    bool operator()(const ConditionOrImpl* l, const ConditionOrImpl* r) const;
 };
 
 template<>
-struct UniquePDDLEqualTo<const ConditionNotImpl&>
+struct UniquePDDLEqualTo<const ConditionNotImpl*>
 {
-    bool operator()(const ConditionNotImpl& l, const ConditionNotImpl& r) const;
+    bool operator()(const ConditionNotImpl* l, const ConditionNotImpl* r) const;
 };
 
 template<>
-struct UniquePDDLEqualTo<const ConditionImplyImpl&>
+struct UniquePDDLEqualTo<const ConditionImplyImpl*>
 {
-    bool operator()(const ConditionImplyImpl& l, const ConditionImplyImpl& r) const;
+    bool operator()(const ConditionImplyImpl* l, const ConditionImplyImpl* r) const;
 };
 
 template<>
-struct UniquePDDLEqualTo<const ConditionExistsImpl&>
+struct UniquePDDLEqualTo<const ConditionExistsImpl*>
 {
-    bool operator()(const ConditionExistsImpl& l, const ConditionExistsImpl& r) const;
+    bool operator()(const ConditionExistsImpl* l, const ConditionExistsImpl* r) const;
 };
 
 template<>
-struct UniquePDDLEqualTo<const ConditionForallImpl&>
+struct UniquePDDLEqualTo<const ConditionForallImpl*>
 {
-    bool operator()(const ConditionForallImpl& l, const ConditionForallImpl& r) const;
-};
-
-template<>
-struct UniquePDDLEqualTo<const ConditionImpl*>
-{
-    bool operator()(const ConditionImpl* l, const ConditionImpl* r) const;
+    bool operator()(const ConditionForallImpl* l, const ConditionForallImpl* r) const;
 };
 
 template<>
@@ -139,75 +153,63 @@ struct UniquePDDLEqualTo<const DomainImpl*>
 };
 
 template<>
-struct UniquePDDLEqualTo<const EffectLiteralImpl&>
-{
-    bool operator()(const EffectLiteralImpl& l, const EffectLiteralImpl& r) const;
-};
-
-template<>
-struct UniquePDDLEqualTo<const EffectAndImpl&>
-{
-    bool operator()(const EffectAndImpl& l, const EffectAndImpl& r) const;
-};
-
-template<>
-struct UniquePDDLEqualTo<const EffectNumericImpl&>
+struct UniquePDDLEqualTo<const EffectLiteralImpl*>
 {
-    bool operator()(const EffectNumericImpl& l, const EffectNumericImpl& r) const;
+    bool operator()(const EffectLiteralImpl* l, const EffectLiteralImpl* r) const;
 };
 
 template<>
-struct UniquePDDLEqualTo<const EffectConditionalForallImpl&>
+struct UniquePDDLEqualTo<const EffectAndImpl*>
 {
-    bool operator()(const EffectConditionalForallImpl& l, const EffectConditionalForallImpl& r) const;
+    bool operator()(const EffectAndImpl* l, const EffectAndImpl* r) const;
 };
 
 template<>
-struct UniquePDDLEqualTo<const EffectConditionalWhenImpl&>
+struct UniquePDDLEqualTo<const EffectNumericImpl*>
 {
-    bool operator()(const EffectConditionalWhenImpl& l, const EffectConditionalWhenImpl& r) const;
+    bool operator()(const EffectNumericImpl* l, const EffectNumericImpl* r) const;
 };
 
 template<>
-struct UniquePDDLEqualTo<const EffectImpl*>
+struct UniquePDDLEqualTo<const EffectConditionalForallImpl*>
 {
-    bool operator()(const EffectImpl* l, const EffectImpl* r) const;
+    bool operator()(const EffectConditionalForallImpl* l, const EffectConditionalForallImpl* r) const;
 };
 
 template<>
-struct UniquePDDLEqualTo<const FunctionExpressionNumberImpl&>
+struct UniquePDDLEqualTo<const EffectConditionalWhenImpl*>
 {
-    bool operator()(const FunctionExpressionNumberImpl& l, const FunctionExpressionNumberImpl& r) const;
+    bool operator()(const EffectConditionalWhenImpl* l, const EffectConditionalWhenImpl* r) const;
 };
 
 template<>
-struct UniquePDDLEqualTo<const FunctionExpressionBinaryOperatorImpl&>
+struct UniquePDDLEqualTo<const FunctionExpressionNumberImpl*>
 {
-    bool operator()(const FunctionExpressionBinaryOperatorImpl& l, const FunctionExpressionBinaryOperatorImpl& r) const;
+    bool operator()(const FunctionExpressionNumberImpl* l, const FunctionExpressionNumberImpl* r) const;
 };
 
 template<>
-struct UniquePDDLEqualTo<const FunctionExpressionMultiOperatorImpl&>
+struct UniquePDDLEqualTo<const FunctionExpressionBinaryOperatorImpl*>
 {
-    bool operator()(const FunctionExpressionMultiOperatorImpl& l, const FunctionExpressionMultiOperatorImpl& r) const;
+    bool operator()(const FunctionExpressionBinaryOperatorImpl* l, const FunctionExpressionBinaryOperatorImpl* r) const;
 };
 
 template<>
-struct UniquePDDLEqualTo<const FunctionExpressionMinusImpl&>
+struct UniquePDDLEqualTo<const FunctionExpressionMultiOperatorImpl*>
 {
-    bool operator()(const FunctionExpressionMinusImpl& l, const FunctionExpressionMinusImpl& r) const;
+    bool operator()(const FunctionExpressionMultiOperatorImpl* l, const FunctionExpressionMultiOperatorImpl* r) const;
 };
 
 template<>
-struct UniquePDDLEqualTo<const FunctionExpressionFunctionImpl&>
+struct UniquePDDLEqualTo<const FunctionExpressionMinusImpl*>
 {
-    bool operator()(const FunctionExpressionFunctionImpl& l, const FunctionExpressionFunctionImpl& r) const;
+    bool operator()(const FunctionExpressionMinusImpl* l, const FunctionExpressionMinusImpl* r) const;
 };
 
 template<>
-struct UniquePDDLEqualTo<const FunctionExpressionImpl*>
+struct UniquePDDLEqualTo<const FunctionExpressionFunctionImpl*>
 {
-    bool operator()(const FunctionExpressionImpl* l, const FunctionExpressionImpl* r) const;
+    bool operator()(const FunctionExpressionFunctionImpl* l, const FunctionExpressionFunctionImpl* r) const;
 };
 
 template<>
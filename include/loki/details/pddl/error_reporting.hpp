@@ -21,8 +21,14 @@
 #include "loki/details/utils/filesystem.hpp"
 
 #include <boost/spirit/home/x3/support/utility/error_reporting.hpp>
+#include <cassert>
+#include <cstdint>
+#include <limits>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 // Clang-style error handling utilities
 
@@ -35,6 +41,18 @@ namespace loki
 {
 using position_tagged = boost::spirit::x3::position_tagged;
 
+/// @brief The byte offsets [first, last) of a matched range in the input.
+///        Unlike a `position_tagged`, it does not refer to the matched positions of the parser, which are released after parsing.
+struct SourcePosition
+{
+    uint32_t first;
+    uint32_t last;
+
+    friend bool operator==(const SourcePosition& l, const SourcePosition& r) = default;
+};
+
+using SourcePositionList = std::vector<SourcePosition>;
+
 template<typename Iterator>
 class PDDLErrorHandlerImpl
 {
@@ -42,17 +60,58 @@ public:
     typedef Iterator iterator_type;
     using position_cache = boost::spirit::x3::position_cache<std::vector<Iterator>>;
 
-    PDDLErrorHandlerImpl(position_cache pos_cache, fs::path file = "", int tabs = 4) : pos_cache(pos_cache), file(file), tabs(tabs) {}
+    PDDLErrorHandlerImpl(const position_cache& pos_cache, fs::path file = "", int tabs = 4) :
+        positions(pos_cache.get_positions()),
+        first_(pos_cache.first()),
+        last_(pos_cache.last()),
+        file(file),
+        tabs(tabs)
+    {
+        if (std::distance(first_, last_) >= static_cast<std::ptrdiff_t>(std::numeric_limits<uint32_t>::max()))
+        {
+            throw std::length_error("PDDLErrorHandler: the input exceeds the 32-bit range of source positions.");
+        }
+    }
 
     std::string operator()(Iterator err_pos, std::string const& error_message) const;
     std::string operator()(Iterator err_first, Iterator err_last, std::string const& error_message) const;
-    std::string operator()(position_tagged pos, std::string const& message) const
+    std::string operator()(SourcePosition pos, std::string const& message) const
     {
-        auto where = pos_cache.position_of(pos);
+        auto where = position_of(pos);
         return (*this)(where.begin(), where.end(), message);
     }
+    std::string operator()(position_tagged pos, std::string const& message) const { return (*this)(get_source_position(pos), message); }
 
-    boost::iterator_range<Iterator> position_of(position_tagged pos) const { return pos_cache.position_of(pos); }
+    boost::iterator_range<Iterator> position_of(SourcePosition pos) const { return { first_ + pos.first, first_ + pos.last }; }
+    boost::iterator_range<Iterator> position_of(position_tagged pos) const { return position_of(get_source_position(pos)); }
+
+    /// @brief Returns the byte offsets of a matched position, which requires that the matched positions were not released.
+    SourcePosition get_source_position(position_tagged pos) const
+    {
+        return { static_cast<uint32_t>(std::distance(first_, positions.at(pos.id_first))),
+                 static_cast<uint32_t>(std::distance(first_, positions.at(pos.id_last))) };
+    }
+
+    /// @brief Releases the matched positions after parsing. Source positions remain valid.
+    void release_positions() { std::vector<Iterator>().swap(positions); }
+
+    /// @brief Moves the input to [first, last), e.g., a copy of the input with an edit,
+    ///        which requires that the matched positions were released. Source positions are not adjusted to the edit.
+    void set_input(Iterator first, Iterator last)
+    {
+        assert(positions.empty());
+        first_ = first;
+        last_ = last;
+    }
+
+    /// @brief Returns the 1-based line and column of the first character at the position.
+    std::pair<std::size_t, std::size_t> get_line_and_column(SourcePosition pos) const
+    {
+        auto where = position_of(pos);
+        const auto line_start = get_line_start(first_, where.begin());
+        return { position(where.begin()), static_cast<std::size_t>(std::distance(line_start, where.begin())) + 1 };
+    }
+    std::pair<std::size_t, std::size_t> get_line_and_column(position_tagged pos) const { return get_line_and_column(get_source_position(pos)); }
 
 private:
     std::string print_file_line(std::size_t line) const;
@@ -61,7 +120,11 @@ private:
     Iterator get_line_start(Iterator first, Iterator pos) const;
     std::size_t position(Iterator i) const;
 
-    position_cache pos_cache;
+    // The matched positions in pairs of the first and the last position of a matched range, as in the x3 position cache,
+    // until they are released after parsing.
+    std::vector<Iterator> positions;
+    Iterator first_;
+    Iterator last_;
     std::string file;
     int tabs;
 };
@@ -138,7 +201,7 @@ std::size_t PDDLErrorHandlerImpl<Iterator>::position(Iterator i) const
     std::size_t line { 1 };
     typename std::iterator_traits<Iterator>::value_type prev { 0 };
 
-    for (Iterator pos = pos_cache.first(); pos != i; ++pos)
+    for (Iterator pos = first_; pos != i; ++pos)
     {
         auto c = *pos;
         switch (c)
@@ -162,15 +225,12 @@ std::size_t PDDLErrorHandlerImpl<Iterator>::position(Iterator i) const
 template<typename Iterator>
 std::string PDDLErrorHandlerImpl<Iterator>::operator()(Iterator err_pos, std::string const& error_message) const
 {
-    Iterator first = pos_cache.first();
-    Iterator last = pos_cache.last();
-
     std::ostringstream err_out;
     err_out << print_file_line(position(err_pos));
     err_out << error_message << std::endl;
 
-    Iterator start = get_line_start(first, err_pos);
-    err_out << print_line(start, last);
+    Iterator start = get_line_start(first_, err_pos);
+    err_out << print_line(start, last_);
     err_out << print_indicator(start, err_pos, '_');
     err_out << "^_" << std::endl;
     return err_out.str();
@@ -179,15 +239,12 @@ std::string PDDLErrorHandlerImpl<Iterator>::operator()(Iterator err_pos, std::st
 template<typename Iterator>
 std::string PDDLErrorHandlerImpl<Iterator>::operator()(Iterator err_first, Iterator err_last, std::string const& error_message) const
 {
-    Iterator first = pos_cache.first();
-    Iterator last = pos_cache.last();
-
     std::ostringstream err_out;
     err_out << print_file_line(position(err_first));
     err_out << error_message << std::endl;
 
-    Iterator start = get_line_start(first, err_first);
-    err_out << print_line(start, last);
+    Iterator start = get_line_start(first_, err_first);
+    err_out << print_line(start, last_);
     err_out << print_indicator(start, err_first, ' ');
     err_out << print_indicator(start, err_last, '~');
     err_out << " <<-- Here" << std::endl;
@@ -23,6 +23,8 @@
 #include "loki/details/pddl/requirements.hpp"
 
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace loki
 {
@@ -52,6 +54,13 @@ public:
     MultiDefinitionTypeError(const std::string& name, const std::string& error_handler_output);
 };
 
+class CyclicTypeHierarchyError : public SemanticParserError
+{
+public:
+    /// @brief The `cycle` lists the types such that each type is a subtype of the next one and the last type is a subtype of the first one.
+    CyclicTypeHierarchyError(const std::vector<std::string>& cycle, const std::string& error_handler_output);
+};
+
 /* Predicate */
 class UnusedPredicateError : public SemanticParserError
 {
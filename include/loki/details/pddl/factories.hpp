@@ -42,6 +42,7 @@
 #include "loki/details/pddl/term.hpp"
 #include "loki/details/pddl/type.hpp"
 #include "loki/details/pddl/variable.hpp"
+#include "loki/details/utils/string_arena.hpp"
 #include "loki/details/utils/unique_factory.hpp"
 #include "loki/details/utils/variadic_container.hpp"
 
@@ -57,13 +58,37 @@ using AtomFactory = UniqueFactory<AtomImpl, UniquePDDLHasher<const AtomImpl*>, U
 using LiteralFactory = UniqueFactory<LiteralImpl, UniquePDDLHasher<const LiteralImpl*>, UniquePDDLEqualTo<const LiteralImpl*>>;
 using ParameterFactory = UniqueFactory<ParameterImpl, UniquePDDLHasher<const ParameterImpl*>, UniquePDDLEqualTo<const ParameterImpl*>>;
 using PredicateFactory = UniqueFactory<PredicateImpl, UniquePDDLHasher<const PredicateImpl*>, UniquePDDLEqualTo<const PredicateImpl*>>;
-using FunctionExpressionFactory =
-    UniqueFactory<FunctionExpressionImpl, UniquePDDLHasher<const FunctionExpressionImpl*>, UniquePDDLEqualTo<const FunctionExpressionImpl*>>;
+using FunctionExpressionNumberFactory =
+    UniqueFactory<FunctionExpressionNumberImpl, UniquePDDLHasher<const FunctionExpressionNumberImpl*>, UniquePDDLEqualTo<const FunctionExpressionNumberImpl*>>;
+using FunctionExpressionBinaryOperatorFactory = UniqueFactory<FunctionExpressionBinaryOperatorImpl,
+                                                              UniquePDDLHasher<const FunctionExpressionBinaryOperatorImpl*>,
+                                                              UniquePDDLEqualTo<const FunctionExpressionBinaryOperatorImpl*>>;
+using FunctionExpressionMultiOperatorFactory = UniqueFactory<FunctionExpressionMultiOperatorImpl,
+                                                             UniquePDDLHasher<const FunctionExpressionMultiOperatorImpl*>,
+                                                             UniquePDDLEqualTo<const FunctionExpressionMultiOperatorImpl*>>;
+using FunctionExpressionMinusFactory =
+    UniqueFactory<FunctionExpressionMinusImpl, UniquePDDLHasher<const FunctionExpressionMinusImpl*>, UniquePDDLEqualTo<const FunctionExpressionMinusImpl*>>;
+using FunctionExpressionFunctionFactory = UniqueFactory<FunctionExpressionFunctionImpl,
+                                                        UniquePDDLHasher<const FunctionExpressionFunctionImpl*>,
+                                                        UniquePDDLEqualTo<const FunctionExpressionFunctionImpl*>>;
 using FunctionFactory = UniqueFactory<FunctionImpl, UniquePDDLHasher<const FunctionImpl*>, UniquePDDLEqualTo<const FunctionImpl*>>;
 using FunctionSkeletonFactory =
     UniqueFactory<FunctionSkeletonImpl, UniquePDDLHasher<const FunctionSkeletonImpl*>, UniquePDDLEqualTo<const FunctionSkeletonImpl*>>;
-using ConditionFactory = UniqueFactory<ConditionImpl, UniquePDDLHasher<const ConditionImpl*>, UniquePDDLEqualTo<const ConditionImpl*>>;
-using EffectFactory = UniqueFactory<EffectImpl, UniquePDDLHasher<const EffectImpl*>, UniquePDDLEqualTo<const EffectImpl*>>;
+using ConditionLiteralFactory =
+    UniqueFactory<ConditionLiteralImpl, UniquePDDLHasher<const ConditionLiteralImpl*>, UniquePDDLEqualTo<const ConditionLiteralImpl*>>;
+using ConditionAndFactory = UniqueFactory<ConditionAndImpl, UniquePDDLHasher<const ConditionAndImpl*>, UniquePDDLEqualTo<const ConditionAndImpl*>>;
+using ConditionOrFactory = UniqueFactory<ConditionOrImpl, UniquePDDLHasher<const ConditionOrImpl*>, UniquePDDLEqualTo<const ConditionOrImpl*>>;
+using ConditionNotFactory = UniqueFactory<ConditionNotImpl, UniquePDDLHasher<const ConditionNotImpl*>, UniquePDDLEqualTo<const ConditionNotImpl*>>;
+using ConditionImplyFactory = UniqueFactory<ConditionImplyImpl, UniquePDDLHasher<const ConditionImplyImpl*>, UniquePDDLEqualTo<const ConditionImplyImpl*>>;
+using ConditionExistsFactory = UniqueFactory<ConditionExistsImpl, UniquePDDLHasher<const ConditionExistsImpl*>, UniquePDDLEqualTo<const ConditionExistsImpl*>>;
+using ConditionForallFactory = UniqueFactory<ConditionForallImpl, UniquePDDLHasher<const ConditionForallImpl*>, UniquePDDLEqualTo<const ConditionForallImpl*>>;
+using EffectLiteralFactory = UniqueFactory<EffectLiteralImpl, UniquePDDLHasher<const EffectLiteralImpl*>, UniquePDDLEqualTo<const EffectLiteralImpl*>>;
+using EffectAndFactory = UniqueFactory<EffectAndImpl, UniquePDDLHasher<const EffectAndImpl*>, UniquePDDLEqualTo<const EffectAndImpl*>>;
+using EffectNumericFactory = UniqueFactory<EffectNumericImpl, UniquePDDLHasher<const EffectNumericImpl*>, UniquePDDLEqualTo<const EffectNumericImpl*>>;
+using EffectConditionalForallFactory =
+    UniqueFactory<EffectConditionalForallImpl, UniquePDDLHasher<const EffectConditionalForallImpl*>, UniquePDDLEqualTo<const EffectConditionalForallImpl*>>;
+using EffectConditionalWhenFactory =
+    UniqueFactory<EffectConditionalWhenImpl, UniquePDDLHasher<const EffectConditionalWhenImpl*>, UniquePDDLEqualTo<const EffectConditionalWhenImpl*>>;
 using ActionFactory = UniqueFactory<ActionImpl, UniquePDDLHasher<const ActionImpl*>, UniquePDDLEqualTo<const ActionImpl*>>;
 using AxiomFactory = UniqueFactory<AxiomImpl, UniquePDDLHasher<const AxiomImpl*>, UniquePDDLEqualTo<const AxiomImpl*>>;
 using OptimizationMetricFactory =
@@ -81,11 +106,25 @@ using VariadicPDDLConstructorFactory = VariadicContainer<RequirementsFactory,
                                                          LiteralFactory,
                                                          ParameterFactory,
                                                          PredicateFactory,
-                                                         FunctionExpressionFactory,
+                                                         FunctionExpressionNumberFactory,
+                                                         FunctionExpressionBinaryOperatorFactory,
+                                                         FunctionExpressionMultiOperatorFactory,
+                                                         FunctionExpressionMinusFactory,
+                                                         FunctionExpressionFunctionFactory,
                                                          FunctionFactory,
                                                          FunctionSkeletonFactory,
-                                                         ConditionFactory,
-                                                         EffectFactory,
+                                                         ConditionLiteralFactory,
+                                                         ConditionAndFactory,
+                                                         ConditionOrFactory,
+                                                         ConditionNotFactory,
+                                                         ConditionImplyFactory,
+                                                         ConditionExistsFactory,
+                                                         ConditionForallFactory,
+                                                         EffectLiteralFactory,
+                                                         EffectAndFactory,
+                                                         EffectNumericFactory,
+                                                         EffectConditionalForallFactory,
+                                                         EffectConditionalWhenFactory,
                                                          ActionFactory,
                                                          AxiomFactory,
                                                          OptimizationMetricFactory,
@@ -94,13 +133,40 @@ using VariadicPDDLConstructorFactory = VariadicContainer<RequirementsFactory,
                                                          ProblemFactory>;
 
 /// @brief Collection of factories for the unique creation of PDDL objects.
+///
+///        Factories are not thread-safe while PDDL objects are created.
+///        After `freeze` was called, no PDDL objects can be created anymore and all const member functions,
+///        the `get_or_create` functions for existing PDDL objects and the created PDDL objects themselves
+///        can be used concurrently from any number of threads without synchronization.
 class PDDLFactories
 {
 private:
     VariadicPDDLConstructorFactory m_factories;
 
+    // Contiguous storage for the names of PDDL objects.
+    StringArena m_names;
+
+    // Existing PDDL objects are looked up in the parent before they are created in these factories.
+    const PDDLFactories* m_parent;
+
+    bool m_frozen;
+
+    std::string_view get_or_create_name(std::string_view name);
+
+    /// @brief Returns the PDDL object in the closest parent that is equal to the `element`, or nullptr.
+    template<typename Factory, typename HolderType>
+    const HolderType* find_in_parent(const HolderType& element) const;
+
+    template<typename Factory, typename SubType, typename... Args>
+    auto get_or_create_impl(Args&&... args);
+
 public:
     PDDLFactories();
+    /// @brief Create factories that extend the `parent` factories. PDDL objects that exist in the parent are reused
+    ///        and new PDDL objects continue the indexing of the parent. The parent must outlive these factories
+    ///        and must not be modified while these factories exist. Multiple factories can share the same parent
+    ///        and can be used concurrently from different threads.
+    explicit PDDLFactories(const PDDLFactories* parent);
     PDDLFactories(const PDDLFactories& other) = delete;
     PDDLFactories& operator=(const PDDLFactories& other) = delete;
     PDDLFactories(PDDLFactories&& other);
@@ -108,15 +174,15 @@ public:
 
     Requirements get_or_create_requirements(RequirementEnumSet requirement_set);
 
-    Type get_or_create_type(std::string name, TypeList bases);
+    Type get_or_create_type(std::string_view name, TypeList bases);
 
-    Variable get_or_create_variable(std::string name);
+    Variable get_or_create_variable(std::string_view name);
 
     Term get_or_create_term_variable(Variable variable);
 
     Term get_or_create_term_object(Object object);
 
-    Object get_or_create_object(std::string name, TypeList types);
+    Object get_or_create_object(std::string_view name, TypeList types);
 
     Atom get_or_create_atom(Predicate predicate, TermList terms);
 
@@ -124,7 +190,7 @@ public:
 
     Parameter get_or_create_parameter(Variable variable, TypeList types);
 
-    Predicate get_or_create_predicate(std::string name, ParameterList parameters);
+    Predicate get_or_create_predicate(std::string_view name, ParameterList parameters);
 
     FunctionExpression get_or_create_function_expression_number(double number);
 
@@ -140,7 +206,7 @@ public:
 
     Function get_or_create_function(FunctionSkeleton function_skeleton, TermList terms);
 
-    FunctionSkeleton get_or_create_function_skeleton(std::string name, ParameterList parameters, Type type);
+    FunctionSkeleton get_or_create_function_skeleton(std::string_view name, ParameterList parameters, Type type);
 
     Condition get_or_create_condition_literal(Literal literal);
 
@@ -167,9 +233,13 @@ public:
     Effect get_or_create_effect_conditional_when(Condition condition, Effect effect);
 
     Action
-    get_or_create_action(std::string name, size_t original_arity, ParameterList parameters, std::optional<Condition> condition, std::optional<Effect> effect);
+    get_or_create_action(std::string_view name, size_t original_arity, ParameterList parameters, std::optional<Condition> condition, std::optional<Effect> effect);
 
-    Axiom get_or_create_axiom(std::string derived_predicate_name, ParameterList parameters, Condition condition, size_t num_parameters_to_ground_head);
+    /// @brief Create an action whose condition and effect are parsed on first access by the `lazy_body`.
+    ///        Lazy actions are not shared, i.e., each call creates a new action.
+    Action create_lazy_action(std::string_view name, ParameterList parameters, std::unique_ptr<LazyActionBody> lazy_body);
+
+    Axiom get_or_create_axiom(std::string_view derived_predicate_name, ParameterList parameters, Condition condition, size_t num_parameters_to_ground_head);
 
     OptimizationMetric get_or_create_optimization_metric(OptimizationMetricEnum metric, FunctionExpression function_expression);
 
@@ -196,6 +266,49 @@ public:
                                   std::optional<Condition> goal_condition,
                                   std::optional<OptimizationMetric> optimization_metric,
                                   AxiomList axioms);
+
+    /// @brief Get the factory of the given type, e.g., to test whether a PDDL object was created in it.
+    template<typename Factory>
+    const Factory& get_factory() const
+    {
+        return m_factories.get<Factory>();
+    }
+
+    /// @brief Get the index of the first PDDL object of type T that is created in these factories.
+    ///        PDDL objects with smaller indices belong to the parent factories.
+    template<typename T>
+    size_t get_index_offset() const
+    {
+        return get_factory<UniqueFactory<T, UniquePDDLHasher<const T*>, UniquePDDLEqualTo<const T*>>>().get_index_offset();
+    }
+
+    /// @brief Get the index of the next PDDL object of type T that is created in these factories.
+    template<typename T>
+    size_t get_next_index() const
+    {
+        const auto& factory = get_factory<UniqueFactory<T, UniquePDDLHasher<const T*>, UniquePDDLEqualTo<const T*>>>();
+        return factory.get_index_offset() + factory.size();
+    }
+
+    /// @brief Get the storage of the names of PDDL objects.
+    const StringArena& get_names() const;
+
+    /// @brief Get the factories that are extended by these factories, or nullptr.
+    const PDDLFactories* get_parent() const;
+
+    /// @brief Reject the creation of further PDDL objects. Afterwards, `get_or_create` returns existing PDDL objects
+    ///        without modifying the factories and throws a `FrozenError` for PDDL objects that do not exist.
+    ///        If `shrink_to_fit` is true, then unused memory is released. The PDDL objects are never moved.
+    const PDDLFactories& freeze(bool shrink_to_fit = false);
+
+    bool is_frozen() const;
+
+    /// @brief Destroy all PDDL objects of these factories but keep their allocated memory to be reused, e.g., for the next file.
+    ///        The indexing continues the current state of the parent factories. Throws a `FrozenError` if the factories are frozen.
+    void clear();
+
+    /// @brief Returns an estimate of the number of bytes allocated by these factories, excluding the parent factories.
+    size_t get_estimated_memory_usage() const;
 };
 
 // Here is a good place to define the `PDDLPositionCache` alias since we have all includes available.
@@ -208,11 +321,25 @@ using PDDLPositionCache = PositionCache<RequirementsImpl,
                                         LiteralImpl,
                                         ParameterImpl,
                                         PredicateImpl,
-                                        FunctionExpressionImpl,
+                                        FunctionExpressionNumberImpl,
+                                        FunctionExpressionBinaryOperatorImpl,
+                                        FunctionExpressionMultiOperatorImpl,
+                                        FunctionExpressionMinusImpl,
+                                        FunctionExpressionFunctionImpl,
                                         FunctionImpl,
                                         FunctionSkeletonImpl,
-                                        ConditionImpl,
-                                        EffectImpl,
+                                        ConditionLiteralImpl,
+                                        ConditionAndImpl,
+                                        ConditionOrImpl,
+                                        ConditionNotImpl,
+                                        ConditionImplyImpl,
+                                        ConditionExistsImpl,
+                                        ConditionForallImpl,
+                                        EffectLiteralImpl,
+                                        EffectAndImpl,
+                                        EffectNumericImpl,
+                                        EffectConditionalForallImpl,
+                                        EffectConditionalWhenImpl,
                                         ActionImpl,
                                         AxiomImpl,
                                         OptimizationMetricImpl,
@@ -179,7 +179,7 @@ extern std::ostream& operator<<(std::ostream& out, const FunctionExpressionBinar
 extern std::ostream& operator<<(std::ostream& out, const FunctionExpressionMultiOperatorImpl& element);
 extern std::ostream& operator<<(std::ostream& out, const FunctionExpressionMinusImpl& element);
 extern std::ostream& operator<<(std::ostream& out, const FunctionExpressionFunctionImpl& element);
-extern std::ostream& operator<<(std::ostream& out, const FunctionExpressionImpl& element);
+extern std::ostream& operator<<(std::ostream& out, const FunctionExpression& element);
 
 }
 
@@ -21,6 +21,7 @@
 #include "loki/details/pddl/declarations.hpp"
 
 #include <string>
+#include <string_view>
 
 namespace loki
 {
@@ -28,11 +29,11 @@ class FunctionSkeletonImpl
 {
 private:
     size_t m_index;
-    std::string m_name;
+    std::string_view m_name;
     ParameterList m_parameters;
     Type m_type;
 
-    FunctionSkeletonImpl(size_t index, std::string name, ParameterList parameters, Type type);
+    FunctionSkeletonImpl(size_t index, std::string_view name, ParameterList parameters, Type type);
 
     // Give access to the constructor.
     template<typename HolderType, typename Hash, typename EqualTo>
@@ -46,7 +47,7 @@ public:
     FunctionSkeletonImpl& operator=(FunctionSkeletonImpl&& other) = default;
 
     size_t get_index() const;
-    const std::string& get_name() const;
+    std::string_view get_name() const;
     const ParameterList& get_parameters() const;
     const Type& get_type() const;
 };
@@ -24,6 +24,7 @@
 #include <cstdint>
 #include <functional>
 #include <ranges>
+#include <string_view>
 #include <utility>
 #include <variant>
 
@@ -74,16 +75,62 @@ struct UniquePDDLHasher<ForwardRange>
     }
 };
 
+/// Spezialization for std::string_view, used for names stored in the `StringArena` of the factories.
+template<>
+struct UniquePDDLHasher<std::string_view>
+{
+    size_t operator()(const std::string_view& name) const { return std::hash<std::string_view>()(name); }
+};
+
 /// Spezialization for std::variant.
 template<typename... Ts>
 struct UniquePDDLHasher<std::variant<Ts...>>
 {
     size_t operator()(const std::variant<Ts...>& variant) const
     {
-        return std::visit([](const auto& arg) { return UniquePDDLHasher<decltype(arg)>()(arg); }, variant);
+        return std::visit(
+            [](const auto& arg)
+            {
+                // Variants over pointers are hashed through the specialization of the pointer type.
+                using ArgType = std::decay_t<decltype(arg)>;
+                if constexpr (std::is_pointer_v<ArgType>)
+                {
+                    return UniquePDDLHasher<ArgType>()(arg);
+                }
+                else
+                {
+                    return UniquePDDLHasher<decltype(arg)>()(arg);
+                }
+            },
+            variant);
     }
 };
 
+/// Spezialization for TaggedPointer, which is hashed through the specialization of the pointer type of the alternative.
+template<typename... Ts>
+struct UniquePDDLHasher<TaggedPointer<Ts...>>
+{
+    size_t operator()(const TaggedPointer<Ts...>& pointer) const
+    {
+        return visit([](const auto& arg) { return UniquePDDLHasher<std::decay_t<decltype(arg)>>()(arg); }, pointer);
+    }
+};
+
+/// Spezialization for conditions and effects, which are nested in conditions, effects, actions, and axioms.
+/// Since nested conditions and effects are unique, it suffices to hash their addresses instead of hashing them recursively,
+/// which would take time and stack space proportional to the depth of the nesting.
+template<>
+struct UniquePDDLHasher<Condition>
+{
+    size_t operator()(const Condition& condition) const;
+};
+
+template<>
+struct UniquePDDLHasher<Effect>
+{
+    size_t operator()(const Effect& effect) const;
+};
+
 /**
  * Specializations for PDDL
  */
@@ -107,51 +154,45 @@ struct UniquePDDLHasher<const AxiomImpl*>
 };
 
 template<>
-struct UniquePDDLHasher<const ConditionLiteralImpl&>
-{
-    size_t operator()(const ConditionLiteralImpl& e) const;
-};
-
-template<>
-struct UniquePDDLHasher<const ConditionAndImpl&>
+struct UniquePDDLHasher<const ConditionLiteralImpl*>
 {
-    size_t operator()(const ConditionAndImpl& e) const;
+    size_t operator()(const ConditionLiteralImpl* e) const;
 };
 
 template<>
-struct UniquePDDLHasher<const ConditionOrImpl&>
+struct UniquePDDLHasher<const ConditionAndImpl*>
 {
-    size_t operator()(const ConditionOrImpl& e) const;
+    size_t operator()(const ConditionAndImpl* e) const;
 };
 
 template<>
-struct UniquePDDLHasher<const ConditionNotImpl&>
+struct UniquePDDLHasher<const ConditionOrImpl*>
 {
-    size_t operator()(const ConditionNotImpl& e) const;
+    size_t operator()(const ConditionOrImpl* e) const;
 };
 
 template<>
-struct UniquePDDLHasher<const ConditionImplyImpl&>
+struct UniquePDDLHasher<const ConditionNotImpl*>
 {
-    size_t operator()(const ConditionImplyImpl& e) const;
+    size_t operator()(const ConditionNotImpl* e) const;
 };
 
 template<>
-struct UniquePDDLHasher<const ConditionExistsImpl&>
+struct UniquePDDLHasher<const ConditionImplyImpl*>
 {
-    size_t operator()(const ConditionExistsImpl& e) const;
+    size_t operator()(const ConditionImplyImpl* e) const;
 };
 
 template<>
-struct UniquePDDLHasher<const ConditionForallImpl&>
+struct UniquePDDLHasher<const ConditionExistsImpl*>
 {
-    size_t operator()(const ConditionForallImpl& e) const;
+    size_t operator()(const ConditionExistsImpl* e) const;
 };
 
 template<>
-struct UniquePDDLHasher<const ConditionImpl*>
+struct UniquePDDLHasher<const ConditionForallImpl*>
 {
-    size_t operator()(const ConditionImpl* e) const;
+    size_t operator()(const ConditionForallImpl* e) const;
 };
 
 template<>
@@ -161,75 +202,63 @@ struct UniquePDDLHasher<const DomainImpl*>
 };
 
 template<>
-struct UniquePDDLHasher<const EffectLiteralImpl&>
-{
-    size_t operator()(const EffectLiteralImpl& e) const;
-};
-
-template<>
-struct UniquePDDLHasher<const EffectAndImpl&>
-{
-    size_t operator()(const EffectAndImpl& e) const;
-};
-
-template<>
-struct UniquePDDLHasher<const EffectNumericImpl&>
+struct UniquePDDLHasher<const EffectLiteralImpl*>
 {
-    size_t operator()(const EffectNumericImpl& e) const;
+    size_t operator()(const EffectLiteralImpl* e) const;
 };
 
 template<>
-struct UniquePDDLHasher<const EffectConditionalForallImpl&>
+struct UniquePDDLHasher<const EffectAndImpl*>
 {
-    size_t operator()(const EffectConditionalForallImpl& e) const;
+    size_t operator()(const EffectAndImpl* e) const;
 };
 
 template<>
-struct UniquePDDLHasher<const EffectConditionalWhenImpl&>
+struct UniquePDDLHasher<const EffectNumericImpl*>
 {
-    size_t operator()(const EffectConditionalWhenImpl& e) const;
+    size_t operator()(const EffectNumericImpl* e) const;
 };
 
 template<>
-struct UniquePDDLHasher<const EffectImpl*>
+struct UniquePDDLHasher<const EffectConditionalForallImpl*>
 {
-    size_t operator()(const EffectImpl* e) const;
+    size_t operator()(const EffectConditionalForallImpl* e) const;
 };
 
 template<>
-struct UniquePDDLHasher<const FunctionExpressionNumberImpl&>
+struct UniquePDDLHasher<const EffectConditionalWhenImpl*>
 {
-    size_t operator()(const FunctionExpressionNumberImpl& e) const;
+    size_t operator()(const EffectConditionalWhenImpl* e) const;
 };
 
 template<>
-struct UniquePDDLHasher<const FunctionExpressionBinaryOperatorImpl&>
+struct UniquePDDLHasher<const FunctionExpressionNumberImpl*>
 {
-    size_t operator()(const FunctionExpressionBinaryOperatorImpl& e) const;
+    size_t operator()(const FunctionExpressionNumberImpl* e) const;
 };
 
 template<>
-struct UniquePDDLHasher<const FunctionExpressionMultiOperatorImpl&>
+struct UniquePDDLHasher<const FunctionExpressionBinaryOperatorImpl*>
 {
-    size_t operator()(const FunctionExpressionMultiOperatorImpl& e) const;
+    size_t operator()(const FunctionExpressionBinaryOperatorImpl* e) const;
 };
 
 template<>
-struct UniquePDDLHasher<const FunctionExpressionMinusImpl&>
+struct UniquePDDLHasher<const FunctionExpressionMultiOperatorImpl*>
 {
-    size_t operator()(const FunctionExpressionMinusImpl& e) const;
+    size_t operator()(const FunctionExpressionMultiOperatorImpl* e) const;
 };
 
 template<>
-struct UniquePDDLHasher<const FunctionExpressionFunctionImpl&>
+struct UniquePDDLHasher<const FunctionExpressionMinusImpl*>
 {
-    size_t operator()(const FunctionExpressionFunctionImpl& e) const;
+    size_t operator()(const FunctionExpressionMinusImpl* e) const;
 };
 
 template<>
-struct UniquePDDLHasher<const FunctionExpressionImpl*>
+struct UniquePDDLHasher<const FunctionExpressionFunctionImpl*>
 {
-    size_t operator()(const FunctionExpressionImpl* e) const;
+    size_t operator()(const FunctionExpressionFunctionImpl* e) const;
 };
 
 template<>
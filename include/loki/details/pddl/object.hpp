@@ -21,6 +21,7 @@
 #include "loki/details/pddl/declarations.hpp"
 
 #include <string>
+#include <string_view>
 
 namespace loki
 {
@@ -28,10 +29,10 @@ class ObjectImpl
 {
 private:
     size_t m_index;
-    std::string m_name;
+    std::string_view m_name;
     TypeList m_types;
 
-    ObjectImpl(size_t index, std::string name, TypeList types = {});
+    ObjectImpl(size_t index, std::string_view name, TypeList types = {});
 
     // Give access to the constructor.
     template<typename HolderType, typename Hash, typename EqualTo>
@@ -45,7 +46,7 @@ public:
     ObjectImpl& operator=(ObjectImpl&& other) = default;
 
     size_t get_index() const;
-    const std::string& get_name() const;
+    std::string_view get_name() const;
     const TypeList& get_bases() const;
 };
 
@@ -22,11 +22,28 @@
 #include "loki/details/pddl/context.hpp"
 #include "loki/details/pddl/declarations.hpp"
 
+#include <functional>
+#include <memory>
+
 namespace loki
 {
 
-extern Domain parse(const fs::path& filepath, const ast::Domain& domain_node, Context& context);
-extern Problem parse(const fs::path& filepath, const ast::Problem& problem_node, Context& context, const Domain& domain);
+/// @brief Creates the lazy body that parses the condition and the effect of the action `node` on first access.
+using LazyActionBodyFunction = std::function<std::unique_ptr<LazyActionBody>(const ast::Action& node)>;
+
+/// @brief Parse the domain. If `num_threads` is not 1 then actions and axioms are parsed concurrently on `num_threads` worker threads,
+///        or one worker per hardware thread if `num_threads` is 0, after the types, constants, predicates and functions were parsed.
+///        If `lazy_action_body` is not empty, then only the names and the parameters of the actions are parsed, one after another,
+///        and their conditions and effects are parsed on first access by the lazy bodies that it creates.
+///        Unused predicates and function skeletons are not reported in this case.
+extern Domain parse(const fs::path& filepath,
+                    const ast::Domain& domain_node,
+                    Context& context,
+                    size_t num_threads = 1,
+                    const LazyActionBodyFunction& lazy_action_body = LazyActionBodyFunction());
+/// @brief Parse the problem. If `num_threads` is not 1 then the initial elements are parsed concurrently in contiguous chunks
+///        on `num_threads` worker threads, or one worker per hardware thread if `num_threads` is 0.
+extern Problem parse(const fs::path& filepath, const ast::Problem& problem_node, Context& context, const Domain& domain, size_t num_threads = 1);
 
 }
 
@@ -23,32 +23,159 @@
 #include "loki/details/pddl/error_reporting.hpp"
 #include "loki/details/utils/filesystem.hpp"
 
-#include <unordered_map>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <variant>
+#include <vector>
 
 namespace loki
 {
+/// @brief Stores the occurrences of PDDL objects of type T in flat arrays
+///        that are indexed by the dense index of the PDDL object minus the index offset.
+///
+///        A position is stored as the byte offsets of the occurrence in the input such that it does not depend on the matched positions of the parser.
+///        The occurrences of a PDDL object form a singly linked list
+///        within a single flat array such that no allocation per PDDL object is needed.
+///        Optionally, only the first occurrence of each PDDL object is stored, directly in the slot of the PDDL object.
+///        The index offset is the index of the first PDDL object that is created after the storage, e.g., the number of PDDL objects
+///        of a domain for the position storage of a problem. The few occurrences of PDDL objects with smaller indices are stored in a map.
 template<typename T>
-using PositionMapType = std::unordered_map<PDDLElement<T>, PositionList>;
+class PositionStorage
+{
+private:
+    static constexpr uint32_t NO_ENTRY = std::numeric_limits<uint32_t>::max();
+
+    struct Entry
+    {
+        SourcePosition position;
+        uint32_t next;
+    };
+
+    // The first and last entry of the occurrences of a PDDL object,
+    // or the byte offsets of its first occurrence if only the first occurrence is stored. The slot is empty if first is NO_ENTRY.
+    struct Slot
+    {
+        uint32_t first = NO_ENTRY;
+        uint32_t last = NO_ENTRY;
+    };
+
+    bool m_first_occurrence_only;
+    size_t m_index_offset;
+
+    // The slot of the PDDL object with index i is at position i - m_index_offset.
+    std::vector<Slot> m_slots;
+    // The slots of PDDL objects with an index smaller than the index offset.
+    std::map<size_t, Slot> m_offset_slots;
+
+    std::vector<Entry> m_entries;
+    size_t m_size;
+
+    Slot& get_or_create_slot(size_t index);
+
+    const Slot* get_slot(size_t index) const;
+
+public:
+    explicit PositionStorage(bool first_occurrence_only = false, size_t index_offset = 0);
+
+    /// @brief Sets the index offset, which requires that no occurrence is stored.
+    void set_index_offset(size_t index_offset);
+
+    size_t get_index_offset() const;
+
+    void push_back(size_t index, const SourcePosition& position);
+
+    SourcePositionList get(size_t index) const;
+
+    /// @brief Calls `callback(index, position)` for each stored occurrence,
+    ///        ordered by index and, for each index, in the order of insertion.
+    template<typename Callback>
+    void for_each(Callback&& callback) const;
+
+    /// @brief Removes the occurrences whose position satisfies the `predicate`.
+    template<typename Predicate>
+    void erase_if(Predicate&& predicate);
+
+    /// @brief Replaces the position of each occurrence by `function(position)`, e.g., to shift the positions after an edit of the input.
+    template<typename Function>
+    void transform(Function&& function);
 
-/// @brief Stores all occurrences of a PDDL object in the input file for each PDDL type T.
+    size_t size() const;
+
+    void shrink_to_fit();
+};
+
+/// @brief Stores occurrences of PDDL objects in the input file for each PDDL type T.
 template<typename... Ts>
 class PositionCache
 {
 private:
-    std::tuple<PositionMapType<Ts>...> m_positions;
+    std::tuple<PositionStorage<Ts>...> m_positions;
 
-    PDDLErrorHandler m_error_handler;
+    std::shared_ptr<const PDDLErrorHandler> m_error_handler;
+    // The error handler if this position cache created it, or nullptr if it is shared.
+    PDDLErrorHandler* m_own_error_handler;
 
 public:
-    PositionCache(const X3ErrorHandler& error_handler, const fs::path& file, int tabs = 4);
+    /// @brief If `first_occurrence_only` is true then only the first occurrence of each PDDL object is stored.
+    PositionCache(const X3ErrorHandler& error_handler, const fs::path& file, int tabs = 4, bool first_occurrence_only = false);
+    /// @brief Create a position cache that shares an existing `error_handler`, e.g., to collect positions in a separate thread.
+    explicit PositionCache(std::shared_ptr<const PDDLErrorHandler> error_handler, bool first_occurrence_only = false);
 
+    /// @brief Stores the byte offsets of the matched `position`, which requires that the error handler did not release the matched positions.
     template<typename T>
     void push_back(const PDDLElement<T>& element, const Position& position);
 
     template<typename T>
-    PositionList get(const PDDLElement<T>& element) const;
+    void push_back(const PDDLElement<T>& element, const SourcePosition& position);
+
+    template<typename T>
+    SourcePositionList get(const PDDLElement<T>& element) const;
+
+    /// @brief Dispatches to the storage of the alternative held by the tagged pointer,
+    ///        e.g., a `Condition` that holds a `ConditionAnd`.
+    template<typename... Vs, typename P>
+    void push_back(const TaggedPointer<Vs...>& element, const P& position);
+
+    template<typename... Vs>
+    SourcePositionList get(const TaggedPointer<Vs...>& element) const;
+
+    /// @brief Sets the index offset of the storage of each type T to the index of the next PDDL object of type T that is created
+    ///        in the `factories`, e.g., before parsing a problem, such that the storages do not allocate slots for the PDDL objects of the domain.
+    ///        No occurrence must be stored yet.
+    template<typename Factories>
+    void set_index_offsets(const Factories& factories);
+
+    /// @brief Get the storage of the occurrences of PDDL objects of type T.
+    template<typename T>
+    PositionStorage<T>& get_storage();
+
+    template<typename T>
+    const PositionStorage<T>& get_storage() const;
+
+    /// @brief Removes the occurrences whose position satisfies the `predicate` from the storages of all types.
+    template<typename Predicate>
+    void erase_if(Predicate&& predicate);
+
+    /// @brief Replaces the position of each occurrence by `function(position)` in the storages of all types.
+    template<typename Function>
+    void transform(Function&& function);
+
+    /// @brief Appends the occurrences that are stored in `other`, e.g., after a part of the input was parsed into a separate position cache.
+    void append(const PositionCache& other);
 
     const PDDLErrorHandler& get_error_handler() const;
+
+    /// @brief Get the error handler that this position cache created, e.g., to update it after an edit of the input.
+    ///        Scopes that refer to it report errors in the updated input.
+    ///        Throws std::logic_error if the error handler is shared.
+    PDDLErrorHandler& get_mutable_error_handler();
+
+    const std::shared_ptr<const PDDLErrorHandler>& get_shared_error_handler() const;
+
+    /// @brief Releases unused memory of the storages.
+    void shrink_to_fit();
 };
 
 }
@@ -15,12 +15,278 @@
  * along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <stdexcept>
+#include <variant>
+
 namespace loki
 {
 
+/// @brief Returns the index of a PDDL object, also if it is a variant over PDDL objects.
+template<typename T>
+size_t get_position_index(const T& element)
+{
+    return element.get_index();
+}
+
 template<typename... Ts>
-PositionCache<Ts...>::PositionCache(const X3ErrorHandler& error_handler, const fs::path& file, int tabs) :
-    m_error_handler(PDDLErrorHandler(error_handler.get_error_handler().get_position_cache(), file, tabs))
+size_t get_position_index(const std::variant<Ts...>& element)
+{
+    return std::visit([](const auto& arg) { return arg.get_index(); }, element);
+}
+
+/* PositionStorage */
+
+template<typename T>
+PositionStorage<T>::PositionStorage(bool first_occurrence_only, size_t index_offset) :
+    m_first_occurrence_only(first_occurrence_only),
+    m_index_offset(index_offset),
+    m_size(0)
+{
+}
+
+template<typename T>
+typename PositionStorage<T>::Slot& PositionStorage<T>::get_or_create_slot(size_t index)
+{
+    if (index < m_index_offset)
+    {
+        return m_offset_slots[index];
+    }
+    const auto pos = index - m_index_offset;
+    if (pos >= m_slots.size())
+    {
+        m_slots.resize(pos + 1);
+    }
+    return m_slots[pos];
+}
+
+template<typename T>
+const typename PositionStorage<T>::Slot* PositionStorage<T>::get_slot(size_t index) const
+{
+    if (index < m_index_offset)
+    {
+        const auto it = m_offset_slots.find(index);
+        return (it != m_offset_slots.end()) ? &it->second : nullptr;
+    }
+    const auto pos = index - m_index_offset;
+    return (pos < m_slots.size()) ? &m_slots[pos] : nullptr;
+}
+
+template<typename T>
+void PositionStorage<T>::set_index_offset(size_t index_offset)
+{
+    if (m_size > 0)
+    {
+        throw std::logic_error("PositionStorage::set_index_offset: occurrences are already stored.");
+    }
+    m_slots.clear();
+    m_offset_slots.clear();
+    m_index_offset = index_offset;
+}
+
+template<typename T>
+size_t PositionStorage<T>::get_index_offset() const
+{
+    return m_index_offset;
+}
+
+template<typename T>
+void PositionStorage<T>::push_back(size_t index, const SourcePosition& position)
+{
+    auto& slot = get_or_create_slot(index);
+    if (m_first_occurrence_only)
+    {
+        if (slot.first == NO_ENTRY)
+        {
+            slot = Slot { position.first, position.last };
+            ++m_size;
+        }
+        return;
+    }
+
+    // The entries are linked by 32-bit positions and NO_ENTRY marks the end of a list.
+    if (m_entries.size() >= NO_ENTRY)
+    {
+        throw std::length_error("PositionStorage::push_back: the number of occurrences exceeds the 32-bit range.");
+    }
+    const auto entry = static_cast<uint32_t>(m_entries.size());
+    if (slot.first == NO_ENTRY)
+    {
+        slot.first = entry;
+    }
+    else
+    {
+        m_entries[slot.last].next = entry;
+    }
+    slot.last = entry;
+    m_entries.push_back(Entry { position, NO_ENTRY });
+    ++m_size;
+}
+
+template<typename T>
+SourcePositionList PositionStorage<T>::get(size_t index) const
+{
+    auto positions = SourcePositionList();
+    if (const auto slot = get_slot(index))
+    {
+        if (m_first_occurrence_only)
+        {
+            if (slot->first != NO_ENTRY)
+            {
+                positions.push_back(SourcePosition { slot->first, slot->last });
+            }
+            return positions;
+        }
+        for (auto entry = slot->first; entry != NO_ENTRY; entry = m_entries[entry].next)
+        {
+            positions.push_back(m_entries[entry].position);
+        }
+    }
+    return positions;
+}
+
+template<typename T>
+template<typename Callback>
+void PositionStorage<T>::for_each(Callback&& callback) const
+{
+    const auto visit_slot = [this, &callback](size_t index, const Slot& slot)
+    {
+        if (m_first_occurrence_only)
+        {
+            if (slot.first != NO_ENTRY)
+            {
+                callback(index, SourcePosition { slot.first, slot.last });
+            }
+            return;
+        }
+        for (auto entry = slot.first; entry != NO_ENTRY; entry = m_entries[entry].next)
+        {
+            callback(index, m_entries[entry].position);
+        }
+    };
+    for (const auto& [index, slot] : m_offset_slots)
+    {
+        visit_slot(index, slot);
+    }
+    for (size_t pos = 0; pos < m_slots.size(); ++pos)
+    {
+        visit_slot(m_index_offset + pos, m_slots[pos]);
+    }
+}
+
+template<typename T>
+template<typename Predicate>
+void PositionStorage<T>::erase_if(Predicate&& predicate)
+{
+    auto entries = std::vector<Entry>();
+    entries.reserve(m_entries.size());
+    const auto erase_from_slot = [this, &entries, &predicate](Slot& slot)
+    {
+        if (m_first_occurrence_only)
+        {
+            if (slot.first != NO_ENTRY && predicate(SourcePosition { slot.first, slot.last }))
+            {
+                slot = Slot();
+                --m_size;
+            }
+            return;
+        }
+        auto entry = slot.first;
+        slot = Slot();
+        for (; entry != NO_ENTRY; entry = m_entries[entry].next)
+        {
+            if (predicate(m_entries[entry].position))
+            {
+                continue;
+            }
+            const auto kept_entry = static_cast<uint32_t>(entries.size());
+            if (slot.first == NO_ENTRY)
+            {
+                slot.first = kept_entry;
+            }
+            else
+            {
+                entries[slot.last].next = kept_entry;
+            }
+            slot.last = kept_entry;
+            entries.push_back(Entry { m_entries[entry].position, NO_ENTRY });
+        }
+    };
+    for (auto& [index, slot] : m_offset_slots)
+    {
+        erase_from_slot(slot);
+    }
+    for (auto& slot : m_slots)
+    {
+        erase_from_slot(slot);
+    }
+    if (!m_first_occurrence_only)
+    {
+        m_entries = std::move(entries);
+        m_size = m_entries.size();
+    }
+}
+
+template<typename T>
+template<typename Function>
+void PositionStorage<T>::transform(Function&& function)
+{
+    if (m_first_occurrence_only)
+    {
+        const auto transform_slot = [&function](Slot& slot)
+        {
+            if (slot.first != NO_ENTRY)
+            {
+                const auto position = function(SourcePosition { slot.first, slot.last });
+                slot = Slot { position.first, position.last };
+            }
+        };
+        for (auto& [index, slot] : m_offset_slots)
+        {
+            transform_slot(slot);
+        }
+        for (auto& slot : m_slots)
+        {
+            transform_slot(slot);
+        }
+        return;
+    }
+    for (auto& entry : m_entries)
+    {
+        entry.position = function(entry.position);
+    }
+}
+
+template<typename T>
+size_t PositionStorage<T>::size() const
+{
+    return m_size;
+}
+
+template<typename T>
+void PositionStorage<T>::shrink_to_fit()
+{
+    m_slots.shrink_to_fit();
+    m_entries.shrink_to_fit();
+}
+
+/* PositionCache */
+
+template<typename... Ts>
+PositionCache<Ts...>::PositionCache(const X3ErrorHandler& error_handler, const fs::path& file, int tabs, bool first_occurrence_only) :
+    m_positions(PositionStorage<Ts>(first_occurrence_only)...),
+    m_error_handler(nullptr),
+    m_own_error_handler(nullptr)
+{
+    auto own_error_handler = std::make_shared<PDDLErrorHandler>(error_handler.get_error_handler().get_position_cache(), file, tabs);
+    m_own_error_handler = own_error_handler.get();
+    m_error_handler = std::move(own_error_handler);
+}
+
+template<typename... Ts>
+PositionCache<Ts...>::PositionCache(std::shared_ptr<const PDDLErrorHandler> error_handler, bool first_occurrence_only) :
+    m_positions(PositionStorage<Ts>(first_occurrence_only)...),
+    m_error_handler(std::move(error_handler)),
+    m_own_error_handler(nullptr)
 {
 }
 
@@ -28,27 +294,108 @@ template<typename... Ts>
 template<typename T>
 void PositionCache<Ts...>::push_back(const PDDLElement<T>& element, const Position& position)
 {
-    auto& t_positions = std::get<PositionMapType<T>>(m_positions);
-    t_positions[element].push_back(position);
+    push_back(element, m_error_handler->get_source_position(position));
 }
 
 template<typename... Ts>
 template<typename T>
-PositionList PositionCache<Ts...>::get(const PDDLElement<T>& element) const
+void PositionCache<Ts...>::push_back(const PDDLElement<T>& element, const SourcePosition& position)
 {
-    auto& t_positions = std::get<PositionMapType<T>>(m_positions);
-    auto it = t_positions.find(element);
-    if (it != t_positions.end())
-    {
-        return it->second;
-    }
-    return {};
+    auto& t_positions = std::get<PositionStorage<T>>(m_positions);
+    t_positions.push_back(get_position_index(*element), position);
+}
+
+template<typename... Ts>
+template<typename T>
+SourcePositionList PositionCache<Ts...>::get(const PDDLElement<T>& element) const
+{
+    const auto& t_positions = std::get<PositionStorage<T>>(m_positions);
+    return t_positions.get(get_position_index(*element));
+}
+
+template<typename... Ts>
+template<typename... Vs, typename P>
+void PositionCache<Ts...>::push_back(const TaggedPointer<Vs...>& element, const P& position)
+{
+    visit([this, &position](const auto& arg) { this->push_back(arg, position); }, element);
+}
+
+template<typename... Ts>
+template<typename... Vs>
+SourcePositionList PositionCache<Ts...>::get(const TaggedPointer<Vs...>& element) const
+{
+    return visit([this](const auto& arg) { return this->get(arg); }, element);
+}
+
+template<typename... Ts>
+template<typename Factories>
+void PositionCache<Ts...>::set_index_offsets(const Factories& factories)
+{
+    (std::get<PositionStorage<Ts>>(m_positions).set_index_offset(factories.template get_next_index<Ts>()), ...);
+}
+
+template<typename... Ts>
+template<typename T>
+PositionStorage<T>& PositionCache<Ts...>::get_storage()
+{
+    return std::get<PositionStorage<T>>(m_positions);
+}
+
+template<typename... Ts>
+template<typename T>
+const PositionStorage<T>& PositionCache<Ts...>::get_storage() const
+{
+    return std::get<PositionStorage<T>>(m_positions);
+}
+
+template<typename... Ts>
+template<typename Predicate>
+void PositionCache<Ts...>::erase_if(Predicate&& predicate)
+{
+    std::apply([&predicate](auto&... storages) { (storages.erase_if(predicate), ...); }, m_positions);
+}
+
+template<typename... Ts>
+template<typename Function>
+void PositionCache<Ts...>::transform(Function&& function)
+{
+    std::apply([&function](auto&... storages) { (storages.transform(function), ...); }, m_positions);
+}
+
+template<typename... Ts>
+void PositionCache<Ts...>::append(const PositionCache& other)
+{
+    (std::get<PositionStorage<Ts>>(other.m_positions)
+         .for_each([this](size_t index, const SourcePosition& position) { std::get<PositionStorage<Ts>>(m_positions).push_back(index, position); }),
+     ...);
 }
 
 template<typename... Ts>
 const PDDLErrorHandler& PositionCache<Ts...>::get_error_handler() const
+{
+    return *m_error_handler;
+}
+
+template<typename... Ts>
+const std::shared_ptr<const PDDLErrorHandler>& PositionCache<Ts...>::get_shared_error_handler() const
 {
     return m_error_handler;
 }
 
+template<typename... Ts>
+PDDLErrorHandler& PositionCache<Ts...>::get_mutable_error_handler()
+{
+    if (m_own_error_handler == nullptr)
+    {
+        throw std::logic_error("PositionCache::get_mutable_error_handler: the error handler is shared.");
+    }
+    return *m_own_error_handler;
+}
+
+template<typename... Ts>
+void PositionCache<Ts...>::shrink_to_fit()
+{
+    std::apply([](auto&... storages) { (storages.shrink_to_fit(), ...); }, m_positions);
+}
+
 }
@@ -21,6 +21,7 @@
 #include "loki/details/pddl/declarations.hpp"
 
 #include <string>
+#include <string_view>
 
 namespace loki
 {
@@ -30,10 +31,10 @@ class PredicateImpl
 {
 private:
     size_t m_index;
-    std::string m_name;
+    std::string_view m_name;
     ParameterList m_parameters;
 
-    PredicateImpl(size_t index, std::string name, ParameterList parameters);
+    PredicateImpl(size_t index, std::string_view name, ParameterList parameters);
 
     // Give access to the constructor.
     template<typename HolderType, typename Hash, typename EqualTo>
@@ -47,7 +48,7 @@ public:
     PredicateImpl& operator=(PredicateImpl&& other) = default;
 
     size_t get_index() const;
-    const std::string& get_name() const;
+    std::string_view get_name() const;
     const ParameterList& get_parameters() const;
 };
 
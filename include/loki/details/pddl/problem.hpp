@@ -18,11 +18,14 @@
 #ifndef LOKI_INCLUDE_LOKI_PDDL_PROBLEM_HPP_
 #define LOKI_INCLUDE_LOKI_PDDL_PROBLEM_HPP_
 
+#include "loki/details/pddl/atom_index.hpp"
 #include "loki/details/pddl/declarations.hpp"
 #include "loki/details/utils/filesystem.hpp"
+#include "loki/details/utils/name_index.hpp"
 
 #include <optional>
 #include <string>
+#include <string_view>
 
 namespace loki
 {
@@ -42,6 +45,16 @@ private:
     std::optional<OptimizationMetric> m_optimization_metric;
     AxiomList m_axioms;
 
+    // Derived from the initial literals for efficient access.
+    LiteralList m_positive_initial_literals;
+    LiteralList m_negative_initial_literals;
+    AtomIndex m_positive_initial_atoms;
+    AtomIndex m_negative_initial_atoms;
+
+    // Derived name indexes for efficient lookup by name.
+    NameIndex<Object> m_objects_by_name;
+    NameIndex<Predicate> m_derived_predicates_by_name;
+
     ProblemImpl(size_t index,
                 std::optional<fs::path> filepath,
                 Domain domain,
@@ -78,6 +91,20 @@ public:
     const std::optional<Condition>& get_goal_condition() const;
     const std::optional<OptimizationMetric>& get_optimization_metric() const;
     const AxiomList& get_axioms() const;
+
+    /// @brief Get the initial literals partitioned by sign.
+    const LiteralList& get_positive_initial_literals() const;
+    const LiteralList& get_negative_initial_literals() const;
+
+    /// @brief Get the atoms of the positive/negative initial literals, grouped by predicate
+    ///        and with constant time membership tests.
+    const AtomIndex& get_positive_initial_atoms() const;
+    const AtomIndex& get_negative_initial_atoms() const;
+
+    /// @brief Find an element by name in constant expected time.
+    ///        Objects are searched among the problem objects first and among the domain constants second.
+    std::optional<Object> find_object(std::string_view name) const;
+    std::optional<Predicate> find_derived_predicate(std::string_view name) const;
 };
 
 extern std::ostream& operator<<(std::ostream& out, const ProblemImpl& element);
@@ -26,13 +26,15 @@
 #include "loki/details/pddl/requirements.hpp"
 #include "loki/details/pddl/variable.hpp"
 
+#include <algorithm>
 #include <boost/spirit/home/x3/support/ast/position_tagged.hpp>
 #include <cassert>
 #include <deque>
 #include <memory>
 #include <optional>
 #include <tuple>
-#include <unordered_set>
+#include <type_traits>
+#include <vector>
 
 namespace loki
 {
@@ -44,11 +46,26 @@ namespace loki
 ///           variables that are referenced.
 ///        3. Verify that all variables are untracked, meaning
 ///           that they were referenced at least once.
+///
+///        The references of each type are stored in a bitset indexed by the index of the PDDL object,
+///        or the value of the enum, which grows on demand.
+///        Hence, all tracked PDDL objects of a type must stem from the same chain of factories,
+///        where child factories continue the indexing of their parents.
 template<typename... Ts>
 class References
 {
 private:
-    std::tuple<std::unordered_set<Ts>...> references;
+    /// @brief The bit of a reference of type T is set if the reference is tracked.
+    template<typename T>
+    struct ReferenceBitset
+    {
+        std::vector<bool> bits;
+    };
+
+    std::tuple<ReferenceBitset<Ts>...> references;
+
+    template<typename T>
+    static size_t get_reference_index(T reference);
 
 public:
     /// @brief Returns a pointer if it exists.
@@ -62,6 +79,10 @@ public:
     /// @brief Erases a pointer of Type T
     template<typename T>
     void untrack(T reference);
+
+    /// @brief Untracks all pointers that are not tracked in `other`,
+    ///        e.g., to combine references that were untracked in copies of these references.
+    void intersect(const References& other);
 };
 
 using ReferencedPDDLObjects = References<Object, Predicate, FunctionSkeleton, Variable, RequirementEnum>;
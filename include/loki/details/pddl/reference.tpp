@@ -18,28 +18,69 @@
 namespace loki
 {
 
+template<typename... Ts>
+template<typename T>
+size_t References<Ts...>::get_reference_index(T reference)
+{
+    if constexpr (std::is_enum_v<T>)
+    {
+        return static_cast<size_t>(reference);
+    }
+    else
+    {
+        return reference->get_index();
+    }
+}
+
 template<typename... Ts>
 template<typename T>
 bool References<Ts...>::exists(T reference) const
 {
-    const auto& t_references = std::get<std::unordered_set<T>>(references);
-    return t_references.count(reference);
+    const auto& t_references = std::get<ReferenceBitset<T>>(references).bits;
+    const auto index = get_reference_index(reference);
+    return index < t_references.size() && t_references[index];
 }
 
 template<typename... Ts>
 template<typename T>
 void References<Ts...>::track(T reference)
 {
-    auto& t_references = std::get<std::unordered_set<T>>(references);
-    t_references.insert(reference);
+    auto& t_references = std::get<ReferenceBitset<T>>(references).bits;
+    const auto index = get_reference_index(reference);
+    if (index >= t_references.size())
+    {
+        t_references.resize(std::max(index + 1, 2 * t_references.size()), false);
+    }
+    t_references[index] = true;
 }
 
 template<typename... Ts>
 template<typename T>
 void References<Ts...>::untrack(T reference)
 {
-    auto& t_references = std::get<std::unordered_set<T>>(references);
-    t_references.erase(reference);
+    auto& t_references = std::get<ReferenceBitset<T>>(references).bits;
+    const auto index = get_reference_index(reference);
+    if (index < t_references.size())
+    {
+        t_references[index] = false;
+    }
+}
+
+template<typename... Ts>
+void References<Ts...>::intersect(const References& other)
+{
+    const auto intersect_references = [](auto& t_references, const auto& t_other_references)
+    {
+        if (t_references.bits.size() > t_other_references.bits.size())
+        {
+            t_references.bits.resize(t_other_references.bits.size());
+        }
+        for (size_t i = 0; i < t_references.bits.size(); ++i)
+        {
+            t_references.bits[i] = t_references.bits[i] && t_other_references.bits[i];
+        }
+    };
+    (intersect_references(std::get<ReferenceBitset<Ts>>(references), std::get<ReferenceBitset<Ts>>(other.references)), ...);
 }
 
 }
@@ -30,10 +30,13 @@
 #include <boost/spirit/home/x3/support/ast/position_tagged.hpp>
 #include <cassert>
 #include <deque>
-#include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace loki
 {
@@ -43,31 +46,34 @@ namespace loki
 ///        The position points to the matched location
 ///        in the input stream and is used for error reporting.
 template<typename T>
-using BindingValueType = std::pair<T, std::optional<Position>>;
+using BindingValueType = std::pair<T, std::optional<SourcePosition>>;
 
 /// @brief Encapsulates the result of search for a binding with the corresponding ErrorHandler.
 template<typename T>
-using BindingSearchResult = std::tuple<T, std::optional<Position>, const PDDLErrorHandler&>;
+using BindingSearchResult = std::tuple<T, std::optional<SourcePosition>, const PDDLErrorHandler&>;
 
-/// @brief Datastructure to store bindings of a type T.
-template<typename T>
-using Bindings = std::unordered_map<std::string, BindingValueType<T>>;
+/// @brief Transparent hash to look up bindings by std::string_view without constructing a std::string.
+struct BindingNameHash
+{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view name) const { return std::hash<std::string_view>()(name); }
+};
 
-/// @brief Wraps bindings in a scope with reference to a parent scope.
+class ScopeStack;
+
+/// @brief A handle to a scope of a `ScopeStack`.
+///        The bindings are stored in the flat symbol table of the `ScopeStack`
+///        and inserting bindings is only allowed into the topmost scope.
+///        Scopes are pooled by the `ScopeStack` and reused when a scope of the same depth is opened again.
 class Scope
 {
 private:
-    const PDDLErrorHandler& m_error_handler;
-    const Scope* m_parent_scope;
-
-    Bindings<Type> m_types;
-    Bindings<Object> m_objects;
-    Bindings<FunctionSkeleton> m_function_skeletons;
-    Bindings<Variable> m_variables;
-    Bindings<Predicate> m_predicates;
+    ScopeStack& m_scope_stack;
+    size_t m_depth;
 
 public:
-    Scope(const PDDLErrorHandler& error_handler, const Scope* parent_scope = nullptr);
+    Scope(ScopeStack& scope_stack, size_t depth);
 
     // delete copy and move to avoid dangling references.
     Scope(const Scope& other) = delete;
@@ -76,18 +82,18 @@ public:
     Scope& operator=(Scope&& other) = delete;
 
     /// @brief Return a binding if it exists.
-    std::optional<BindingSearchResult<Type>> get_type(const std::string& name) const;
-    std::optional<BindingSearchResult<Object>> get_object(const std::string& name) const;
-    std::optional<BindingSearchResult<FunctionSkeleton>> get_function_skeleton(const std::string& name) const;
-    std::optional<BindingSearchResult<Variable>> get_variable(const std::string& name) const;
-    std::optional<BindingSearchResult<Predicate>> get_predicate(const std::string& name) const;
+    std::optional<BindingSearchResult<Type>> get_type(std::string_view name) const;
+    std::optional<BindingSearchResult<Object>> get_object(std::string_view name) const;
+    std::optional<BindingSearchResult<FunctionSkeleton>> get_function_skeleton(std::string_view name) const;
+    std::optional<BindingSearchResult<Variable>> get_variable(std::string_view name) const;
+    std::optional<BindingSearchResult<Predicate>> get_predicate(std::string_view name) const;
 
     /// @brief Insert a binding.
-    void insert_type(const std::string& name, const Type& type, const std::optional<Position>& position);
-    void insert_object(const std::string& name, const Object& object, const std::optional<Position>& position);
-    void insert_function_skeleton(const std::string& name, const FunctionSkeleton& function_skeleton, const std::optional<Position>& position);
-    void insert_variable(const std::string& name, const Variable& variable, const std::optional<Position>& position);
-    void insert_predicate(const std::string& name, const Predicate& predicate, const std::optional<Position>& position);
+    void insert_type(std::string_view name, const Type& type, const std::optional<Position>& position);
+    void insert_object(std::string_view name, const Object& object, const std::optional<Position>& position);
+    void insert_function_skeleton(std::string_view name, const FunctionSkeleton& function_skeleton, const std::optional<Position>& position);
+    void insert_variable(std::string_view name, const Variable& variable, const std::optional<Position>& position);
+    void insert_predicate(std::string_view name, const Predicate& predicate, const std::optional<Position>& position);
 
     /// @brief Get the error handler to print an error message.
     const PDDLErrorHandler& get_error_handler() const;
@@ -107,13 +113,62 @@ public:
 ///
 ///        During problem file parsing, we get access to bindings from the domain through additional composition as follows:
 ///        [ (Domain Scope Global) ], [ (Problem Scope Global), (Problem Scope Child 1), (Problem Scope Child 2), ... ]
+///
+///        The bindings of all scopes of a ScopeStack are stored in a flat symbol table.
+///        Each name is interned once and its id maps to the innermost binding of each kind,
+///        which links to the binding that it shadows.
+///        An undo log records the inserted bindings such that closing a scope takes time linear in the number of bindings that it added.
+///        A lookup hashes the name once per ScopeStack instead of once per scope.
 class ScopeStack
 {
 private:
+    /// @brief A binding in the symbol table that links to the binding of the same name that it shadows.
+    template<typename T>
+    struct SymbolTableEntry
+    {
+        BindingValueType<T> binding;
+        // The depth of the scope that contains the binding.
+        size_t depth;
+        size_t shadowed;
+    };
+
+    /// @brief The bindings of a type T in the order of insertion and the innermost binding of each name id.
+    template<typename T>
+    struct SymbolTable
+    {
+        using ElementType = T;
+
+        std::vector<SymbolTableEntry<T>> entries;
+        std::vector<size_t> innermost;
+    };
+
     const PDDLErrorHandler& m_error_handler;
     const ScopeStack* m_parent;
 
-    std::deque<std::unique_ptr<Scope>> m_stack;
+    std::unordered_map<std::string, size_t, BindingNameHash, std::equal_to<>> m_name_ids;
+    std::tuple<SymbolTable<Type>, SymbolTable<Object>, SymbolTable<FunctionSkeleton>, SymbolTable<Variable>, SymbolTable<Predicate>> m_symbol_tables;
+
+    // The function that removes each inserted binding and the name id of the binding, in the order of insertion.
+    // Name ids stay assigned after their bindings are removed such that reopened scopes reuse them.
+    std::vector<std::pair<void (ScopeStack::*)(size_t), size_t>> m_undo_log;
+    // The size of the undo log when each open scope was opened.
+    std::vector<size_t> m_undo_log_marks;
+
+    // The pool of scopes. Scope i is the scope at depth i and stays alive when it is closed.
+    std::deque<Scope> m_scopes;
+
+    /// @brief Returns the innermost binding visible from the scope at the given depth, falling back to the parent ScopeStack.
+    template<typename T>
+    std::optional<BindingSearchResult<T>> get(std::string_view name, size_t depth) const;
+
+    template<typename T>
+    void insert(std::string_view name, const T& element, const std::optional<Position>& position);
+
+    /// @brief Removes the innermost binding of type T of the name id.
+    template<typename T>
+    void undo(size_t name_id);
+
+    friend class Scope;
 
 public:
     ScopeStack(const PDDLErrorHandler& error_handler, const ScopeStack* parent = nullptr);
@@ -127,15 +182,15 @@ public:
     /// @brief Inserts a new scope on the top of the stack.
     void open_scope();
 
-    /// @brief Deletes the topmost scope from the stack.
+    /// @brief Removes the topmost scope and its bindings from the stack.
     void close_scope();
 
     /// @brief Return a binding if it exists.
     Scope& top();
     const Scope& top() const;
 
-    // For testing purposes only.
-    const std::deque<std::unique_ptr<Scope>>& get_stack() const;
+    /// @brief Returns the number of open scopes.
+    size_t size() const;
 };
 
 }
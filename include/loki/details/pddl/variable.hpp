@@ -21,6 +21,7 @@
 #include "loki/details/pddl/declarations.hpp"
 
 #include <string>
+#include <string_view>
 
 namespace loki
 {
@@ -28,9 +29,9 @@ class VariableImpl
 {
 private:
     size_t m_index;
-    std::string m_name;
+    std::string_view m_name;
 
-    VariableImpl(size_t index, std::string name);
+    VariableImpl(size_t index, std::string_view name);
 
     // Give access to the constructor.
     template<typename HolderType, typename Hash, typename EqualTo>
@@ -44,10 +45,10 @@ public:
     VariableImpl& operator=(VariableImpl&& other) = default;
 
     size_t get_index() const;
-    const std::string& get_name() const;
+    std::string_view get_name() const;
 };
 
-extern VariableSet collect_free_variables(const loki::ConditionImpl& condition);
+extern VariableSet collect_free_variables(const loki::Condition& condition);
 
 extern std::ostream& operator<<(std::ostream& out, const VariableImpl& element);
 
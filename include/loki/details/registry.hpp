@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOKI_INCLUDE_LOKI_REGISTRY_HPP_
+#define LOKI_INCLUDE_LOKI_REGISTRY_HPP_
+
+#include "loki/details/parser.hpp"
+#include "loki/details/utils/filesystem.hpp"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace loki
+{
+
+/// @brief `DomainRegistry` caches parsed domains by the hash of their normalized text, i.e., the text after comments were stripped,
+///        characters were converted to lower case and each sequence of whitespace was collapsed into a single space.
+///
+///        Domain files with the same normalized text share a single frozen `DomainParser`, even if their paths differ.
+///        Problems are parsed against a shared domain with `parse_problem`, which creates PDDL objects in factories of their own.
+///        The shared `DomainParser` must be kept alive while problems that were parsed against it are used.
+///
+///        If the estimated memory usage of the cached domains exceeds the memory budget,
+///        then the least recently used domains are evicted. The most recently used domain is never evicted.
+///        Evicted domains remain valid as long as they are shared. All member functions are thread-safe.
+class DomainRegistry
+{
+private:
+    struct Entry
+    {
+        size_t hash;
+        // The normalized text to rule out hash collisions.
+        std::string text;
+        std::shared_ptr<const DomainParser> domain_parser;
+        size_t memory_usage;
+    };
+
+    size_t m_memory_budget;
+    DomainParserOptions m_options;
+
+    mutable std::mutex m_mutex;
+    // The cached domains ordered from the most recently used to the least recently used.
+    std::list<Entry> m_entries;
+    std::unordered_map<size_t, std::list<Entry>::iterator> m_entry_by_hash;
+    size_t m_memory_usage;
+
+    size_t m_num_hits;
+    size_t m_num_misses;
+
+    void evict();
+
+public:
+    /// @brief Create an empty registry that caches domains up to an estimated memory usage of `memory_budget` bytes.
+    ///        The domains are parsed with the `options`.
+    explicit DomainRegistry(size_t memory_budget, const DomainParserOptions& options = DomainParserOptions());
+    DomainRegistry(const DomainRegistry& other) = delete;
+    DomainRegistry& operator=(const DomainRegistry& other) = delete;
+    DomainRegistry(DomainRegistry&& other) = delete;
+    DomainRegistry& operator=(DomainRegistry&& other) = delete;
+
+    /// @brief Return the cached domain with the same normalized text as the domain file, or parse, freeze and cache the domain file.
+    std::shared_ptr<const DomainParser> get_or_parse(const fs::path& domain_file_path);
+
+    /// @brief Get the number of cached domains.
+    size_t size() const;
+
+    /// @brief Get the estimated memory usage of the cached domains in bytes.
+    size_t get_memory_usage() const;
+
+    size_t get_num_hits() const;
+
+    size_t get_num_misses() const;
+};
+
+}
+
+#endif
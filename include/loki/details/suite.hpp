@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOKI_INCLUDE_LOKI_SUITE_HPP_
+#define LOKI_INCLUDE_LOKI_SUITE_HPP_
+
+#include "loki/details/parser.hpp"
+#include "loki/details/utils/filesystem.hpp"
+
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace loki
+{
+
+/// @brief `Benchmark` is a domain file together with the problem files of the domain.
+struct Benchmark
+{
+    fs::path domain_file;
+    std::vector<fs::path> problem_files;
+};
+
+/// @brief Discover the benchmarks in the directory and its subdirectories, e.g., a checkout of the IPC instances.
+///
+///        Each directory that contains a file `domain.pddl` is a benchmark
+///        whose problem files are the other `.pddl` files in the directory whose name does not contain `domain`.
+///        The benchmarks and their problem files are sorted by path.
+extern std::vector<Benchmark> discover_benchmarks(const fs::path& directory);
+
+/// @brief `ParseStatistics` are the measurements of parsing a single PDDL file.
+struct ParseStatistics
+{
+    fs::path file_path;
+    bool success;
+    // The message of the exception if parsing failed.
+    std::string error;
+    // The wall time to read and parse the file.
+    double seconds;
+    size_t num_bytes;
+    // The number of atoms that were created in the factories of the file.
+    size_t num_atoms;
+    // The peak resident set size of the process in KB after parsing the file.
+    double peak_resident_set;
+
+    double megabytes_per_second() const;
+    double atoms_per_second() const;
+};
+
+/// @brief `LoadedBenchmark` holds the parsers of a benchmark together with the statistics of each file.
+///        A parser is empty if parsing its file failed, and all problem parsers are empty if parsing the domain failed.
+struct LoadedBenchmark
+{
+    std::unique_ptr<DomainParser> domain_parser;
+    std::vector<std::optional<ProblemParser>> problem_parsers;
+
+    ParseStatistics domain_statistics;
+    std::vector<ParseStatistics> problem_statistics;
+};
+
+/// @brief Parse the domain of the benchmark once with the `domain_options` and its problems with `parse_problem` and the `problem_options`
+///        on `num_threads` worker threads, or one worker per hardware thread if `num_threads` is 0.
+///        The domain is frozen before the problems are parsed.
+///        Errors are recorded in the statistics of the respective file instead of being thrown.
+extern LoadedBenchmark load_benchmark(const Benchmark& benchmark,
+                                      size_t num_threads = 0,
+                                      const DomainParserOptions& domain_options = DomainParserOptions(),
+                                      const ProblemParserOptions& problem_options = ProblemParserOptions());
+
+/// @brief Write the statistics as a single line JSON object.
+extern std::ostream& operator<<(std::ostream& out, const ParseStatistics& statistics);
+
+}
+
+#endif
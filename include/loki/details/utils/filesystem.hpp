@@ -35,11 +35,25 @@ namespace fs = boost::filesystem;
 #endif
 #endif
 
+#include <string>
+#include <string_view>
+
 namespace loki
 {
 
+/// @brief Read the file and normalize its text, i.e., strip comments, replace tabs with four spaces and convert characters to lower case.
+///        Files that are compressed with gzip or xz are detected by their magic bytes and decompressed in chunks
+///        that are normalized one after another. Hence, neither the decompressed file is written to disk nor is a second copy of the text kept in memory.
+///        Throws a `DecompressionError` if a compressed file is corrupt and a `NotImplementedError` if Loki was built without support for its format.
 extern std::string read_file(const fs::path& file_path);
 
+/// @brief Read the file into `result` as above, reusing the memory that `result` already allocated, e.g., for the previous file.
+extern void read_file(const fs::path& file_path, std::string& result);
+
+/// @brief Normalize the `text` like the content of a file in `read_file`, e.g., text that is inserted into a normalized file.
+///        A comment in the `text` ends at the next line break or at the end of the `text`.
+extern std::string normalize_text(std::string_view text);
+
 }
 
 #endif
\ No newline at end of file
@@ -33,6 +33,9 @@ namespace loki
 
 extern std::tuple<double, double> process_mem_usage();
 
+/// @brief Returns the peak resident set size of the process in KB, or 0.0 on failure.
+extern double process_peak_mem_usage();
+
 }
 
 #endif
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOKI_INCLUDE_LOKI_UTILS_NAME_INDEX_HPP_
+#define LOKI_INCLUDE_LOKI_UTILS_NAME_INDEX_HPP_
+
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace loki
+{
+
+/// @brief `NameIndex` is an immutable open addressing hash table
+///        that maps the name of an element to the element.
+///
+///        The table is built once and stores the elements in a single flat array
+///        with linear probing and a load factor of at most 0.5.
+///        The names are not copied, they are obtained through `get_name()` of the element.
+///        If multiple elements have the same name, then the first one is found.
+/// @tparam T is a pointer type to an element with a `get_name()` member function.
+template<typename T>
+class NameIndex
+{
+private:
+    struct Slot
+    {
+        size_t hash;
+        T element;
+    };
+
+    std::vector<Slot> m_slots;
+    size_t m_mask;
+
+    static size_t compute_hash(std::string_view name) { return std::hash<std::string_view>()(name); }
+
+public:
+    NameIndex() : m_slots(), m_mask(0) {}
+
+    template<typename Collection>
+    explicit NameIndex(const Collection& elements) : m_slots(), m_mask(0)
+    {
+        if (elements.empty())
+        {
+            return;
+        }
+        m_slots.resize(std::bit_ceil(2 * elements.size()), Slot { 0, nullptr });
+        m_mask = m_slots.size() - 1;
+
+        for (const auto& element : elements)
+        {
+            const auto hash = compute_hash(element->get_name());
+            for (size_t pos = hash & m_mask;; pos = (pos + 1) & m_mask)
+            {
+                auto& slot = m_slots[pos];
+                if (slot.element == nullptr)
+                {
+                    slot = Slot { hash, element };
+                    break;
+                }
+                if (slot.hash == hash && std::string_view(slot.element->get_name()) == std::string_view(element->get_name()))
+                {
+                    // Keep the first element with the given name.
+                    break;
+                }
+            }
+        }
+    }
+
+    /// @brief Returns the element with the given name if it exists.
+    std::optional<T> find(std::string_view name) const
+    {
+        if (m_slots.empty())
+        {
+            return std::nullopt;
+        }
+        const auto hash = compute_hash(name);
+        for (size_t pos = hash & m_mask;; pos = (pos + 1) & m_mask)
+        {
+            const auto& slot = m_slots[pos];
+            if (slot.element == nullptr)
+            {
+                return std::nullopt;
+            }
+            if (slot.hash == hash && std::string_view(slot.element->get_name()) == name)
+            {
+                return slot.element;
+            }
+        }
+    }
+};
+
+}
+
+#endif
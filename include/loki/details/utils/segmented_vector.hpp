@@ -124,6 +124,21 @@ public:
         --m_size;
     }
 
+    /// @brief Destroys all elements but keeps the largest segment, i.e., the last one, to reuse its memory.
+    void clear()
+    {
+        m_accessor.clear();
+        m_size = 0;
+        m_capacity = 0;
+        if (!m_segments.empty())
+        {
+            std::swap(m_segments.front(), m_segments.back());
+            m_segments.resize(1);
+            m_segments.front().clear();
+            m_capacity = m_segments.front().capacity();
+        }
+    }
+
     /**
      * Accessors
      */
@@ -177,6 +192,14 @@ public:
     size_t size() const { return m_size; }
 
     size_t capacity() const { return m_capacity; }
+
+    /// @brief Releases unused memory of the bookkeeping. The elements are not moved, hence, references remain valid.
+    ///        The unused capacity of the last segment is kept since releasing it would require moving its elements.
+    void shrink_to_fit()
+    {
+        m_segments.shrink_to_fit();
+        m_accessor.shrink_to_fit();
+    }
 };
 
 }
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOKI_INCLUDE_LOKI_UTILS_STRING_ARENA_HPP_
+#define LOKI_INCLUDE_LOKI_UTILS_STRING_ARENA_HPP_
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace loki
+{
+
+/// @brief `StringArena` stores unique strings contiguously in large blocks
+///        and hands out `std::string_view`s that remain valid for the lifetime of the arena,
+///        also when the arena is moved.
+///
+///        Since each string is stored only once, two views obtained from the same arena
+///        are equal if and only if they point to the same memory.
+class StringArena
+{
+private:
+    size_t m_block_size;
+
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+    // The number of free chars in the last block.
+    size_t m_remaining;
+    char* m_next;
+
+    // We use an unordered_set to test for uniqueness.
+    std::unordered_set<std::string_view> m_uniqueness_set;
+
+    size_t m_num_bytes;
+
+    std::string_view allocate(std::string_view str)
+    {
+        if (str.size() > m_remaining)
+        {
+            // Strings longer than the block size get a block of their own.
+            const auto block_size = std::max(m_block_size, str.size());
+            m_blocks.push_back(std::make_unique<char[]>(block_size));
+            m_next = m_blocks.back().get();
+            m_remaining = block_size;
+        }
+        std::memcpy(m_next, str.data(), str.size());
+        const auto result = std::string_view(m_next, str.size());
+        m_next += str.size();
+        m_remaining -= str.size();
+        m_num_bytes += str.size();
+        return result;
+    }
+
+public:
+    explicit StringArena(size_t block_size = 16 * 1024) :
+        m_block_size(block_size),
+        m_blocks(),
+        m_remaining(0),
+        m_next(nullptr),
+        m_uniqueness_set(),
+        m_num_bytes(0)
+    {
+    }
+    StringArena(const StringArena& other) = delete;
+    StringArena& operator=(const StringArena& other) = delete;
+    StringArena(StringArena&& other) = default;
+    StringArena& operator=(StringArena&& other) = default;
+
+    /// @brief Returns a view on the stored copy of the given string and stores it before if it does not exist.
+    std::string_view get_or_create(std::string_view str)
+    {
+        const auto it = m_uniqueness_set.find(str);
+        if (it != m_uniqueness_set.end())
+        {
+            return *it;
+        }
+        const auto result = allocate(str);
+        m_uniqueness_set.insert(result);
+        return result;
+    }
+
+    /// @brief Returns a view on the stored copy of the given string, or std::nullopt if it does not exist. Does not modify the arena.
+    std::optional<std::string_view> find(std::string_view str) const
+    {
+        const auto it = m_uniqueness_set.find(str);
+        return (it != m_uniqueness_set.end()) ? std::optional<std::string_view>(*it) : std::nullopt;
+    }
+
+    /// @brief Removes all strings but keeps the first block to reuse its memory. Previously returned views become invalid.
+    void clear()
+    {
+        m_uniqueness_set.clear();
+        m_num_bytes = 0;
+        m_remaining = 0;
+        m_next = nullptr;
+        if (!m_blocks.empty() && m_block_size > 0)
+        {
+            m_blocks.resize(1);
+            m_next = m_blocks.front().get();
+            m_remaining = m_block_size;
+        }
+    }
+
+    /// @brief Returns the number of stored strings.
+    size_t size() const { return m_uniqueness_set.size(); }
+
+    /// @brief Returns the total number of chars of the stored strings.
+    size_t num_bytes() const { return m_num_bytes; }
+};
+
+}
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOKI_INCLUDE_LOKI_UTILS_STRUCTURAL_INDEX_HPP_
+#define LOKI_INCLUDE_LOKI_UTILS_STRUCTURAL_INDEX_HPP_
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace loki
+{
+
+/// @brief `StructuralIndex` contains the byte offsets of the structural characters of a normalized text, see `read_file`.
+///
+///        The text is classified in blocks of 64 bytes with SIMD instructions, similar to the first stage of simdjson.
+///        The offsets allow parsers to jump between parenthesized forms without scanning the bytes in between.
+struct StructuralIndex
+{
+    /// @brief A parenthesized form of the text that starts with a keyword, e.g., `(:action ...)`.
+    struct Section
+    {
+        std::string_view keyword;
+        // The offsets of the opening parenthesis and one past the closing parenthesis.
+        size_t first;
+        size_t last;
+    };
+
+    // The offsets of all '(' and ')' in increasing order.
+    std::vector<uint32_t> parentheses;
+    // The offsets of the first characters of all tokens, i.e., maximal sequences of characters other than whitespace and parentheses.
+    std::vector<uint32_t> token_starts;
+    // The offsets of the tokens that start with ':' and follow an opening parenthesis, possibly separated by whitespace, e.g., `:init`.
+    std::vector<uint32_t> keywords;
+
+    /// @brief Returns the index into `parentheses` of the parenthesis that closes the one at index `i`,
+    ///        or `parentheses.size()` if it is not closed. The parenthesis at index `i` must be opening.
+    size_t find_closing_parenthesis(std::string_view text, size_t i) const;
+
+    /// @brief Returns the sections that are nested directly in the outermost form, e.g., `(:init ...)` in `(define ...)`.
+    ///        A section that is not closed ends at the end of the text.
+    std::vector<Section> get_sections(std::string_view text) const;
+};
+
+/// @brief Build the `StructuralIndex` of the normalized `text`.
+///        Uses AVX2 or SSE2 if the CPU supports them. Throws a `std::length_error` if the `text` has 2^32 or more bytes.
+extern StructuralIndex index_structure(std::string_view text);
+
+/// @brief Build the `StructuralIndex` of the normalized `text` into `result`, reusing the memory that `result` already allocated, e.g., for the previous text.
+///        The index is larger than the text, hence, reusing its memory saves the time of allocating it, which exceeds the time of indexing.
+extern void index_structure(std::string_view text, StructuralIndex& result);
+
+}
+
+#endif
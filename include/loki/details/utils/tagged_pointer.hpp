@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOKI_INCLUDE_LOKI_UTILS_TAGGED_POINTER_HPP_
+#define LOKI_INCLUDE_LOKI_UTILS_TAGGED_POINTER_HPP_
+
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace loki
+{
+
+/// @brief `TaggedPointer` holds one of the pointers `Ts...` in a single word, like a `std::variant<Ts...>` of pointers,
+///        by storing the index of the alternative in the low bits of the address, which are zero due to the alignment of the pointees.
+///
+/// The alternatives are accessed with `visit`, `get`, `get_if`, and `holds_alternative`, which mirror the functions for `std::variant`.
+template<typename... Ts>
+requires(std::is_pointer_v<Ts> && ...)
+class TaggedPointer
+{
+private:
+    static_assert(sizeof...(Ts) > 0 && sizeof...(Ts) <= 8, "The index of the alternative must fit into the three low bits of the address.");
+
+    static constexpr std::uintptr_t s_tag_mask = 7;
+
+    std::uintptr_t m_data;
+
+    template<typename T, size_t I = 0>
+    static constexpr size_t get_index_of()
+    {
+        static_assert(I < sizeof...(Ts), "T is not an alternative of the TaggedPointer.");
+        if constexpr (std::is_same_v<T, std::tuple_element_t<I, std::tuple<Ts...>>>)
+        {
+            return I;
+        }
+        else
+        {
+            return get_index_of<T, I + 1>();
+        }
+    }
+
+public:
+    template<typename T>
+    static constexpr size_t index_of = get_index_of<T>();
+
+    template<size_t I>
+    using alternative_type = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+    static constexpr size_t num_alternatives = sizeof...(Ts);
+
+    /// @brief Holds a null pointer of the first alternative, like a default constructed `std::variant`.
+    TaggedPointer() : m_data(0) {}
+
+    template<typename T>
+    requires(std::is_same_v<T, Ts> || ...)
+    TaggedPointer(T pointer) : m_data(reinterpret_cast<std::uintptr_t>(pointer) | index_of<T>)
+    {
+        assert((reinterpret_cast<std::uintptr_t>(pointer) & s_tag_mask) == 0 && "The pointee must be aligned to 8 bytes.");
+    }
+
+    /// @brief Returns the index of the alternative that is held.
+    size_t index() const { return m_data & s_tag_mask; }
+
+    /// @brief Returns the pointer, which must be of the alternative that is held.
+    template<typename T>
+    T get_unchecked() const
+    {
+        assert(index() == index_of<T>);
+        return reinterpret_cast<T>(m_data & ~s_tag_mask);
+    }
+
+    /// @brief Returns the address of the pointee regardless of its alternative.
+    const void* get_address() const { return reinterpret_cast<const void*>(m_data & ~s_tag_mask); }
+
+    /// @brief Compares the alternative and the address, like the comparison of `std::variant`s of pointers.
+    friend bool operator==(const TaggedPointer& l, const TaggedPointer& r) = default;
+    friend auto operator<=>(const TaggedPointer& l, const TaggedPointer& r)
+    {
+        if (const auto order = l.index() <=> r.index(); order != 0)
+        {
+            return order;
+        }
+        return std::compare_three_way()(l.get_address(), r.get_address());
+    }
+};
+
+template<typename T, typename... Ts>
+bool holds_alternative(const TaggedPointer<Ts...>& pointer)
+{
+    return pointer.index() == TaggedPointer<Ts...>::template index_of<T>;
+}
+
+/// @brief Returns the pointer of the alternative T or throws `std::bad_variant_access` if another alternative is held.
+template<typename T, typename... Ts>
+T get(const TaggedPointer<Ts...>& pointer)
+{
+    if (!holds_alternative<T>(pointer))
+    {
+        throw std::bad_variant_access();
+    }
+    return pointer.template get_unchecked<T>();
+}
+
+/// @brief Returns the pointer of the alternative T or nullptr if another alternative is held.
+template<typename T, typename... Ts>
+T get_if(const TaggedPointer<Ts...>& pointer)
+{
+    return holds_alternative<T>(pointer) ? pointer.template get_unchecked<T>() : nullptr;
+}
+
+/// @brief Calls the visitor with the pointer of the alternative that is held.
+template<typename Visitor, typename... Ts>
+decltype(auto) visit(Visitor&& visitor, const TaggedPointer<Ts...>& pointer)
+{
+    using ReturnType = std::invoke_result_t<Visitor, typename TaggedPointer<Ts...>::template alternative_type<0>>;
+    return [&]<size_t... Is>(std::index_sequence<Is...>) -> ReturnType
+    {
+        using Dispatcher = ReturnType (*)(Visitor&&, const TaggedPointer<Ts...>&);
+        static constexpr Dispatcher dispatchers[] = { [](Visitor&& visitor_, const TaggedPointer<Ts...>& pointer_) -> ReturnType {
+            return std::invoke(std::forward<Visitor>(visitor_), pointer_.template get_unchecked<typename TaggedPointer<Ts...>::template alternative_type<Is>>());
+        }... };
+        return dispatchers[pointer.index()](std::forward<Visitor>(visitor), pointer);
+    }(std::index_sequence_for<Ts...>());
+}
+
+}
+
+template<typename... Ts>
+struct std::hash<loki::TaggedPointer<Ts...>>
+{
+    size_t operator()(const loki::TaggedPointer<Ts...>& pointer) const { return std::hash<const void*>()(pointer.get_address()) ^ pointer.index(); }
+};
+
+#endif
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOKI_INCLUDE_LOKI_UTILS_THREAD_POOL_HPP_
+#define LOKI_INCLUDE_LOKI_UTILS_THREAD_POOL_HPP_
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace loki
+{
+
+/// @brief `ThreadPool` executes submitted tasks on a fixed number of worker threads.
+///
+///        Tasks are started in the order in which they were submitted.
+///        The destructor finishes all submitted tasks before joining the workers.
+class ThreadPool
+{
+private:
+    std::vector<std::thread> m_workers;
+
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_stop;
+
+    void run()
+    {
+        while (true)
+        {
+            auto task = std::function<void()>();
+            {
+                auto lock = std::unique_lock<std::mutex>(m_mutex);
+                m_condition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+                if (m_stop && m_tasks.empty())
+                {
+                    return;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop();
+            }
+            task();
+        }
+    }
+
+public:
+    /// @brief Starts `num_threads` workers. If `num_threads` is 0 then one worker per hardware thread is started.
+    explicit ThreadPool(size_t num_threads = 0) : m_workers(), m_tasks(), m_mutex(), m_condition(), m_stop(false)
+    {
+        if (num_threads == 0)
+        {
+            num_threads = std::max(1U, std::thread::hardware_concurrency());
+        }
+        m_workers.reserve(num_threads);
+        for (size_t i = 0; i < num_threads; ++i)
+        {
+            m_workers.emplace_back([this] { run(); });
+        }
+    }
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+    ThreadPool(ThreadPool&& other) = delete;
+    ThreadPool& operator=(ThreadPool&& other) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            auto lock = std::unique_lock<std::mutex>(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    /// @brief Schedules the task for execution and returns a future to its result.
+    ///        Exceptions thrown by the task are rethrown by `std::future::get`.
+    template<typename Function>
+    std::future<std::invoke_result_t<std::decay_t<Function>>> submit(Function&& function)
+    {
+        using ResultType = std::invoke_result_t<std::decay_t<Function>>;
+        // std::function requires copyable targets, hence, we share the packaged task.
+        auto task = std::make_shared<std::packaged_task<ResultType()>>(std::forward<Function>(function));
+        auto result = task->get_future();
+        {
+            auto lock = std::unique_lock<std::mutex>(m_mutex);
+            m_tasks.emplace([task] { (*task)(); });
+        }
+        m_condition.notify_one();
+        return result;
+    }
+
+    /// @brief Returns the number of worker threads.
+    size_t size() const { return m_workers.size(); }
+};
+
+}
+
+#endif
@@ -46,6 +46,9 @@ private:
     // We use pre-allocated memory to store objects persistent.
     SegmentedVector<HolderType> m_persistent_vector;
 
+    // The index of the first created element.
+    size_t m_index_offset;
+
     void range_check(size_t pos) const
     {
         if (pos >= size())
@@ -57,7 +60,8 @@ private:
 
 public:
     UniqueFactory(size_t initial_num_element_per_segment = 16, size_t maximum_num_elements_per_segment = 16 * 1024) :
-        m_persistent_vector(SegmentedVector<HolderType>(initial_num_element_per_segment, maximum_num_elements_per_segment))
+        m_persistent_vector(SegmentedVector<HolderType>(initial_num_element_per_segment, maximum_num_elements_per_segment)),
+        m_index_offset(0)
     {
     }
     UniqueFactory(const UniqueFactory& other) = delete;
@@ -65,18 +69,32 @@ public:
     UniqueFactory(UniqueFactory&& other) = default;
     UniqueFactory& operator=(UniqueFactory&& other) = default;
 
+    /// @brief Constructs an object with the index that it gets if it is inserted next, e.g., to look it up in other factories
+    ///        before it is inserted with `get_or_create`. Does not modify the factory.
+    template<typename SubType, typename... Args>
+    HolderType create(Args&&... args) const
+    {
+        // Explicitly call the constructor of T to give exclusive access to the factory.
+        // The element with index i is stored at position i - m_index_offset.
+        return SubType(m_index_offset + size(), std::forward<Args>(args)...);
+    }
+
     /// @brief Returns a pointer to an existing object or creates it before if it does not exist.
     template<typename SubType, typename... Args>
     HolderType const* get_or_create(Args&&... args)
     {
-        /* Construct and insert the element in persistent memory. */
+        return get_or_create(create<SubType>(std::forward<Args>(args)...));
+    }
 
-        // Ensure that element with identifier i is stored at position i.
-        size_t index = m_uniqueness_set.size();
-        assert(index == m_persistent_vector.size());
+    /// @brief Returns a pointer to an existing object that is equal to the `element` or inserts it before if it does not exist.
+    ///        The `element` must have been constructed by `create` of this factory since the last insertion.
+    HolderType const* get_or_create(HolderType&& element)
+    {
+        /* Insert the element in persistent memory. */
 
-        // Explicitly call the constructor of T to give exclusive access to the factory.
-        const auto* element_ptr = &m_persistent_vector.emplace_back(SubType(index, std::forward<Args>(args)...));
+        assert(m_uniqueness_set.size() == m_persistent_vector.size());
+
+        const auto* element_ptr = &m_persistent_vector.emplace_back(std::move(element));
         // The pointer to the location in persistent memory.
         assert(element_ptr);
 
@@ -100,11 +118,29 @@ public:
         return element_ptr;
     }
 
+    /// @brief Returns a pointer to an existing object that is equal to the `element`, or nullptr if no such object exists.
+    ///        Does not modify the factory.
+    HolderType const* find(const HolderType& element) const
+    {
+        const auto it = m_uniqueness_set.find(&element);
+        return (it != m_uniqueness_set.end()) ? *it : nullptr;
+    }
+
+    /// @brief Sets the index of the first created object, e.g., to continue the indexing of another factory.
+    ///        Must be called before the first object is created.
+    void set_index_offset(size_t index_offset)
+    {
+        assert(size() == 0);
+        m_index_offset = index_offset;
+    }
+
+    size_t get_index_offset() const { return m_index_offset; }
+
     /**
      * Accessors
      */
 
-    /// @brief Returns a pointer to an existing object with the given pos.
+    /// @brief Returns a pointer to an existing object with the given pos, i.e., the object with index `pos + get_index_offset()`.
     HolderType const* operator[](size_t pos) const
     {
         assert(pos < size());
@@ -128,6 +164,28 @@ public:
      */
 
     size_t size() const { return m_persistent_vector.size(); }
+
+    /// @brief Returns an estimate of the number of bytes allocated by the factory.
+    ///        Memory that is owned by the objects themselves, e.g., by member vectors, is not included.
+    size_t get_estimated_memory_usage() const
+    {
+        return m_persistent_vector.capacity() * sizeof(HolderType) + m_uniqueness_set.bucket_count() * sizeof(void*)
+               + m_uniqueness_set.size() * (sizeof(const HolderType*) + 2 * sizeof(void*));
+    }
+
+    /// @brief Destroys all objects but keeps allocated memory to be reused. The index offset is kept.
+    void clear()
+    {
+        m_uniqueness_set.clear();
+        m_persistent_vector.clear();
+    }
+
+    /// @brief Releases unused memory without moving the objects, hence, pointers to the objects remain valid.
+    void shrink_to_fit()
+    {
+        m_persistent_vector.shrink_to_fit();
+        m_uniqueness_set.rehash(0);
+    }
 };
 
 }
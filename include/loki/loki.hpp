@@ -7,6 +7,8 @@
 
 #include "loki/details/exceptions.hpp"
 #include "loki/details/parser.hpp"
+#include "loki/details/registry.hpp"
+#include "loki/details/suite.hpp"
 
 /**
  * AST
@@ -19,6 +21,7 @@
 #include "loki/details/ast/parser.hpp"
 #include "loki/details/ast/parser_wrapper.hpp"
 #include "loki/details/ast/printer.hpp"
+#include "loki/details/ast/profiler.hpp"
 
 /**
  * PDDL
@@ -26,6 +29,7 @@
 
 #include "loki/details/pddl/action.hpp"
 #include "loki/details/pddl/atom.hpp"
+#include "loki/details/pddl/atom_index.hpp"
 #include "loki/details/pddl/axiom.hpp"
 #include "loki/details/pddl/conditions.hpp"
 #include "loki/details/pddl/declarations.hpp"
@@ -59,7 +63,9 @@
 #include "loki/details/utils/collections.hpp"
 #include "loki/details/utils/filesystem.hpp"
 #include "loki/details/utils/memory.hpp"
+#include "loki/details/utils/name_index.hpp"
 #include "loki/details/utils/segmented_vector.hpp"
+#include "loki/details/utils/string_arena.hpp"
 #include "loki/details/utils/unique_factory.hpp"
 #include "loki/details/utils/variadic_container.hpp"
 
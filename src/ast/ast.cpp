@@ -0,0 +1,334 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "loki/details/ast/ast.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace loki::ast
+{
+
+namespace
+{
+/// @brief `PendingNodes` holds the children of destroyed nodes until they are destroyed one after another.
+///        Destroying a child only moves its own children into the queue, hence, the native stack depth is bounded
+///        by the depth of a single node instead of the depth of the formula.
+struct PendingNodes
+{
+    std::tuple<std::vector<GoalDescriptor>, std::vector<PreconditionGoalDescriptor>, std::vector<Effect>> nodes;
+    bool is_draining = false;
+
+    bool empty() const { return std::apply([](const auto&... vectors) { return (vectors.empty() && ...); }, nodes); }
+};
+
+thread_local PendingNodes pending_nodes;
+
+template<typename T>
+void destroy_last(std::vector<T>& nodes)
+{
+    // Destroying the node may add further nodes, which invalidates references into the vector.
+    auto node = std::move(nodes.back());
+    nodes.pop_back();
+}
+
+void drain()
+{
+    if (pending_nodes.is_draining)
+    {
+        return;
+    }
+    pending_nodes.is_draining = true;
+    auto& [goal_descriptors, precondition_goal_descriptors, effects] = pending_nodes.nodes;
+    while (!pending_nodes.empty())
+    {
+        if (!goal_descriptors.empty())
+        {
+            destroy_last(goal_descriptors);
+        }
+        else if (!precondition_goal_descriptors.empty())
+        {
+            destroy_last(precondition_goal_descriptors);
+        }
+        else
+        {
+            destroy_last(effects);
+        }
+    }
+    pending_nodes.is_draining = false;
+}
+
+template<typename T>
+void destroy_iteratively(T& node)
+{
+    std::get<std::vector<T>>(pending_nodes.nodes).push_back(std::move(node));
+    drain();
+}
+
+template<typename T>
+void destroy_iteratively(std::vector<T>& nodes)
+{
+    auto& pending = std::get<std::vector<T>>(pending_nodes.nodes);
+    std::move(nodes.begin(), nodes.end(), std::back_inserter(pending));
+    nodes.clear();
+    drain();
+}
+
+/// @brief `PendingCopies` holds the default constructed children of copied nodes together with the children that they copy
+///        until they are copied one after another. Copying a child only adds its own children to the queue, hence,
+///        the native stack depth is bounded by the depth of a single node instead of the depth of the formula.
+///        The children are owned by nodes on the heap or by vectors that are not resized, hence, they stay at their address
+///        until the outermost copy constructor drains the queue.
+struct PendingCopies
+{
+    template<typename T>
+    using Copies = std::vector<std::pair<T*, const T*>>;
+
+    std::tuple<Copies<GoalDescriptor>, Copies<PreconditionGoalDescriptor>, Copies<Effect>> copies;
+    bool is_draining = false;
+
+    bool empty() const { return std::apply([](const auto&... vectors) { return (vectors.empty() && ...); }, copies); }
+
+    void clear()
+    {
+        std::apply([](auto&... vectors) { (vectors.clear(), ...); }, copies);
+    }
+};
+
+thread_local PendingCopies pending_copies;
+
+template<typename T>
+void copy_last(PendingCopies::Copies<T>& copies)
+{
+    const auto [target, source] = copies.back();
+    copies.pop_back();
+    // The copy constructors of the children of the source add further copies instead of recursing.
+    *target = T(*source);
+}
+
+void drain_copies()
+{
+    if (pending_copies.is_draining)
+    {
+        return;
+    }
+    pending_copies.is_draining = true;
+    auto& [goal_descriptors, precondition_goal_descriptors, effects] = pending_copies.copies;
+    try
+    {
+        while (!pending_copies.empty())
+        {
+            if (!goal_descriptors.empty())
+            {
+                copy_last(goal_descriptors);
+            }
+            else if (!precondition_goal_descriptors.empty())
+            {
+                copy_last(precondition_goal_descriptors);
+            }
+            else
+            {
+                copy_last(effects);
+            }
+        }
+    }
+    catch (...)
+    {
+        // The remaining children stay default constructed and are destroyed with the partial copy.
+        pending_copies.clear();
+        pending_copies.is_draining = false;
+        throw;
+    }
+    pending_copies.is_draining = false;
+}
+
+template<typename T>
+void copy_iteratively(T& target, const T& source)
+{
+    std::get<PendingCopies::Copies<T>>(pending_copies.copies).emplace_back(&target, &source);
+    drain_copies();
+}
+
+template<typename T>
+void copy_iteratively(std::vector<T>& targets, const std::vector<T>& sources)
+{
+    assert(targets.size() == sources.size());
+    auto& pending = std::get<PendingCopies::Copies<T>>(pending_copies.copies);
+    for (size_t i = 0; i < sources.size(); ++i)
+    {
+        pending.emplace_back(&targets[i], &sources[i]);
+    }
+    drain_copies();
+}
+
+/// @brief Returns an effect with the alternative of `other`, where a list of effects is replaced by a list of default constructed effects.
+Effect::base_type copy_shallow(const Effect& other)
+{
+    if (const auto* effects = boost::get<std::vector<Effect>>(&other.get()))
+    {
+        return Effect::base_type(std::vector<Effect>(effects->size()));
+    }
+    return static_cast<const Effect::base_type&>(other);
+}
+}
+
+GoalDescriptorAnd::GoalDescriptorAnd(const GoalDescriptorAnd& other) : x3::position_tagged(other), goal_descriptors(other.goal_descriptors.size())
+{
+    copy_iteratively(goal_descriptors, other.goal_descriptors);
+}
+
+GoalDescriptorAnd& GoalDescriptorAnd::operator=(const GoalDescriptorAnd& other) { return *this = GoalDescriptorAnd(other); }
+
+GoalDescriptorAnd::~GoalDescriptorAnd() { destroy_iteratively(goal_descriptors); }
+
+GoalDescriptorOr::GoalDescriptorOr(const GoalDescriptorOr& other) : x3::position_tagged(other), goal_descriptors(other.goal_descriptors.size())
+{
+    copy_iteratively(goal_descriptors, other.goal_descriptors);
+}
+
+GoalDescriptorOr& GoalDescriptorOr::operator=(const GoalDescriptorOr& other) { return *this = GoalDescriptorOr(other); }
+
+GoalDescriptorOr::~GoalDescriptorOr() { destroy_iteratively(goal_descriptors); }
+
+GoalDescriptorNot::GoalDescriptorNot(const GoalDescriptorNot& other) : x3::position_tagged(other), goal_descriptor()
+{
+    copy_iteratively(goal_descriptor, other.goal_descriptor);
+}
+
+GoalDescriptorNot& GoalDescriptorNot::operator=(const GoalDescriptorNot& other) { return *this = GoalDescriptorNot(other); }
+
+GoalDescriptorNot::~GoalDescriptorNot() { destroy_iteratively(goal_descriptor); }
+
+GoalDescriptorImply::GoalDescriptorImply(const GoalDescriptorImply& other) :
+    x3::position_tagged(other),
+    goal_descriptor_left(),
+    goal_descriptor_right()
+{
+    copy_iteratively(goal_descriptor_left, other.goal_descriptor_left);
+    copy_iteratively(goal_descriptor_right, other.goal_descriptor_right);
+}
+
+GoalDescriptorImply& GoalDescriptorImply::operator=(const GoalDescriptorImply& other) { return *this = GoalDescriptorImply(other); }
+
+GoalDescriptorImply::~GoalDescriptorImply()
+{
+    destroy_iteratively(goal_descriptor_left);
+    destroy_iteratively(goal_descriptor_right);
+}
+
+GoalDescriptorExists::GoalDescriptorExists(const GoalDescriptorExists& other) :
+    x3::position_tagged(other),
+    typed_list_of_variables(other.typed_list_of_variables),
+    goal_descriptor()
+{
+    copy_iteratively(goal_descriptor, other.goal_descriptor);
+}
+
+GoalDescriptorExists& GoalDescriptorExists::operator=(const GoalDescriptorExists& other) { return *this = GoalDescriptorExists(other); }
+
+GoalDescriptorExists::~GoalDescriptorExists() { destroy_iteratively(goal_descriptor); }
+
+GoalDescriptorForall::GoalDescriptorForall(const GoalDescriptorForall& other) :
+    x3::position_tagged(other),
+    typed_list_of_variables(other.typed_list_of_variables),
+    goal_descriptor()
+{
+    copy_iteratively(goal_descriptor, other.goal_descriptor);
+}
+
+GoalDescriptorForall& GoalDescriptorForall::operator=(const GoalDescriptorForall& other) { return *this = GoalDescriptorForall(other); }
+
+GoalDescriptorForall::~GoalDescriptorForall() { destroy_iteratively(goal_descriptor); }
+
+PreconditionGoalDescriptorAnd::PreconditionGoalDescriptorAnd(const PreconditionGoalDescriptorAnd& other) :
+    x3::position_tagged(other),
+    precondition_goal_descriptors(other.precondition_goal_descriptors.size())
+{
+    copy_iteratively(precondition_goal_descriptors, other.precondition_goal_descriptors);
+}
+
+PreconditionGoalDescriptorAnd& PreconditionGoalDescriptorAnd::operator=(const PreconditionGoalDescriptorAnd& other)
+{
+    return *this = PreconditionGoalDescriptorAnd(other);
+}
+
+PreconditionGoalDescriptorAnd::~PreconditionGoalDescriptorAnd() { destroy_iteratively(precondition_goal_descriptors); }
+
+PreconditionGoalDescriptorForall::PreconditionGoalDescriptorForall(const PreconditionGoalDescriptorForall& other) :
+    x3::position_tagged(other),
+    typed_list_of_variables(other.typed_list_of_variables),
+    precondition_goal_descriptor()
+{
+    copy_iteratively(precondition_goal_descriptor, other.precondition_goal_descriptor);
+}
+
+PreconditionGoalDescriptorForall& PreconditionGoalDescriptorForall::operator=(const PreconditionGoalDescriptorForall& other)
+{
+    return *this = PreconditionGoalDescriptorForall(other);
+}
+
+PreconditionGoalDescriptorForall::~PreconditionGoalDescriptorForall() { destroy_iteratively(precondition_goal_descriptor); }
+
+Effect::Effect(const Effect& other) : x3::position_tagged(other), base_type(copy_shallow(other))
+{
+    if (auto* effects = boost::get<std::vector<Effect>>(&get()))
+    {
+        copy_iteratively(*effects, boost::get<std::vector<Effect>>(other.get()));
+    }
+}
+
+Effect& Effect::operator=(const Effect& other) { return *this = Effect(other); }
+
+Effect::~Effect()
+{
+    if (auto* effects = boost::get<std::vector<Effect>>(&get()))
+    {
+        destroy_iteratively(*effects);
+    }
+}
+
+EffectConditionalForall::EffectConditionalForall(const EffectConditionalForall& other) :
+    x3::position_tagged(other),
+    typed_list_of_variables(other.typed_list_of_variables),
+    effect()
+{
+    copy_iteratively(effect, other.effect);
+}
+
+EffectConditionalForall& EffectConditionalForall::operator=(const EffectConditionalForall& other) { return *this = EffectConditionalForall(other); }
+
+EffectConditionalForall::~EffectConditionalForall() { destroy_iteratively(effect); }
+
+EffectConditionalWhen::EffectConditionalWhen(const EffectConditionalWhen& other) : x3::position_tagged(other), goal_descriptor(), effect()
+{
+    copy_iteratively(goal_descriptor, other.goal_descriptor);
+    copy_iteratively(effect, other.effect);
+}
+
+EffectConditionalWhen& EffectConditionalWhen::operator=(const EffectConditionalWhen& other) { return *this = EffectConditionalWhen(other); }
+
+EffectConditionalWhen::~EffectConditionalWhen()
+{
+    destroy_iteratively(goal_descriptor);
+    destroy_iteratively(effect);
+}
+
+}
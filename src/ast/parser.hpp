@@ -19,8 +19,20 @@
 #define LOKI_SRC_DOMAIN_AST_PARSER_HPP_
 
 #include "loki/details/ast/ast.hpp"
+#include "profiler.hpp"
 
+#include <algorithm>
+#include <array>
 #include <boost/spirit/home/x3.hpp>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace loki
 {
@@ -628,6 +640,446 @@ inline auto keyword_lit(const std::string& keyword) { return lit(keyword) >> no_
 /// @brief Synthesizes a keyword string
 inline auto keyword_string(const std::string& keyword) { return string(keyword) >> no_skip[&separator()]; }
 
+/// @brief `NumberParser` parses a decimal number with `std::from_chars`, which does not depend on the locale and rounds correctly,
+///        such that printing the value with enough digits and parsing it again gives the same value.
+///        Integers with at most 15 digits are exactly representable and accumulated directly.
+///        Like x3::double_, it accepts an optional sign, an optional fraction, an optional exponent, inf, and nan.
+///        Numbers whose magnitude is out of the range of double saturate to infinity or zero.
+struct NumberParser : x3::parser<NumberParser>
+{
+    using attribute_type = double;
+
+    static bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+    /// @brief Returns infinity if the nonnegative decimal number in [first, last), which is out of the range of double, is too large
+    ///        and zero if it is too small.
+    static double saturate(const char* first, const char* last)
+    {
+        const char* const exponent_begin = std::find_if(first, last, [](char c) { return c == 'e' || c == 'E'; });
+        long exponent = 0;
+        if (exponent_begin != last)
+        {
+            const char* const exponent_digits_begin = exponent_begin + 1 + (exponent_begin[1] == '+');
+            if (std::from_chars(exponent_digits_begin, last, exponent).ec == std::errc::result_out_of_range)
+            {
+                // Large enough to dominate the number of digits of the mantissa.
+                exponent = (*exponent_digits_begin == '-') ? std::numeric_limits<long>::min() / 2 : std::numeric_limits<long>::max() / 2;
+            }
+        }
+        // The decimal order of the first nonzero digit, e.g., 2 for 123.4 and -2 for 0.012.
+        long order = 0;
+        long num_integer_digits = 0;
+        long num_leading_fraction_zeros = 0;
+        const char* it = first;
+        while (it != exponent_begin && *it == '0')
+        {
+            ++it;
+        }
+        while (it != exponent_begin && is_digit(*it))
+        {
+            ++num_integer_digits;
+            ++it;
+        }
+        if (num_integer_digits > 0)
+        {
+            order = num_integer_digits - 1;
+        }
+        else
+        {
+            it += (it != exponent_begin && *it == '.');
+            while (it != exponent_begin && *it == '0')
+            {
+                ++num_leading_fraction_zeros;
+                ++it;
+            }
+            order = -(num_leading_fraction_zeros + 1);
+        }
+        return (order + exponent > 0) ? std::numeric_limits<double>::infinity() : 0.;
+    }
+
+    template<typename Iterator, typename Context, typename RContext, typename Attr>
+    bool parse(Iterator& first, const Iterator& last, const Context& context, RContext&, Attr& attr) const
+    {
+        static_assert(std::contiguous_iterator<Iterator>, "NumberParser reads the input through a pointer.");
+        x3::skip_over(first, last, context);
+        if (first == last)
+        {
+            return false;
+        }
+        const char* const begin = &*first;
+        const char* const end = begin + std::distance(first, last);
+        const char* it = begin;
+        const bool negative = (*it == '-');
+        if (*it == '-' || *it == '+')
+        {
+            ++it;
+        }
+        if (it == end || *it == '-' || *it == '+')
+        {
+            return false;
+        }
+
+        // Fast path for integers
+        const char* const digits_begin = it;
+        uint64_t integer = 0;
+        while (it != end && is_digit(*it) && it - digits_begin < 16)
+        {
+            integer = 10 * integer + static_cast<uint64_t>(*it - '0');
+            ++it;
+        }
+        double value = 0;
+        if (it != digits_begin && it - digits_begin <= 15 && (it == end || (!is_digit(*it) && *it != '.' && *it != 'e' && *it != 'E')))
+        {
+            value = static_cast<double>(integer);
+        }
+        else
+        {
+            const auto [ptr, ec] = std::from_chars(digits_begin, end, value);
+            if (ec == std::errc::result_out_of_range)
+            {
+                value = saturate(digits_begin, ptr);
+            }
+            else if (ec != std::errc())
+            {
+                return false;
+            }
+            it = ptr;
+        }
+
+        x3::traits::move_to(negative ? -value : value, attr);
+        first += (it - begin);
+        return true;
+    }
+};
+
+/// @brief Parses `(keyword`, where `keyword` is one of the `keywords` followed by a separator, and returns the value of the keyword.
+///        Returns std::nullopt if the input does not start with a keyword, in which case `first` is undefined.
+template<typename T, typename Iterator, typename Context>
+std::optional<T> parse_parenthesized_keyword(const x3::symbols<T>& keywords, Iterator& first, const Iterator& last, const Context& context)
+{
+    x3::skip_over(first, last, context);
+    if (first == last || *first != '(')
+    {
+        return std::nullopt;
+    }
+    ++first;
+    x3::skip_over(first, last, context);
+    auto value = T();
+    if (!keywords.parse(first, last, x3::unused, x3::unused, value))
+    {
+        return std::nullopt;
+    }
+    // Same as no_skip[&separator()] in keyword_lit
+    if (first != last && !std::isspace(static_cast<unsigned char>(*first)) && *first != '(' && *first != ')')
+    {
+        return std::nullopt;
+    }
+    return value;
+}
+
+/// @brief Placeholder for a `KeywordDispatchParser` without fallback.
+struct NoFallback
+{
+};
+
+/// @brief `KeywordDispatchParser` parses alternatives that start with `(keyword` by looking up the keyword after the opening parenthesis once
+///        and parsing only the alternative that is registered for it, instead of trying the alternatives one after another.
+///        Input that does not start with a registered keyword, or that its alternative rejects, is parsed by the `fallback`.
+///        Since each registered alternative rejects all other keywords, the result is the same as for the ordered alternatives
+///        `alternatives... | fallback`.
+template<typename Attribute, typename Fallback, typename... Alternatives>
+struct KeywordDispatchParser : x3::parser<KeywordDispatchParser<Attribute, Fallback, Alternatives...>>
+{
+    using attribute_type = Attribute;
+
+    // Maps each keyword to the index of its alternative.
+    x3::symbols<size_t> keywords;
+    Fallback fallback;
+    std::tuple<Alternatives...> alternatives;
+
+    KeywordDispatchParser(const std::array<const char*, sizeof...(Alternatives)>& keywords_, Fallback fallback_, Alternatives... alternatives_) :
+        keywords(),
+        fallback(fallback_),
+        alternatives(alternatives_...)
+    {
+        for (size_t i = 0; i < keywords_.size(); ++i)
+        {
+            keywords.add(keywords_[i], i);
+        }
+    }
+
+    template<typename Iterator, typename Context>
+    std::optional<size_t> lookup(Iterator it, const Iterator& last, const Context& context) const
+    {
+        return parse_parenthesized_keyword(keywords, it, last, context);
+    }
+
+    template<typename Parser, typename Iterator, typename Context, typename RContext, typename Attr>
+    static bool parse_into(const Parser& parser, Iterator& first, const Iterator& last, const Context& context, RContext& rcontext, Attr& attr)
+    {
+        auto value = typename x3::traits::attribute_of<Parser, Context>::type();
+        if (!parser.parse(first, last, context, rcontext, value))
+        {
+            return false;
+        }
+        attr = std::move(value);
+        return true;
+    }
+
+    template<size_t... Is, typename Iterator, typename Context, typename RContext, typename Attr>
+    bool parse_alternative(size_t index,
+                           std::index_sequence<Is...>,
+                           Iterator& first,
+                           const Iterator& last,
+                           const Context& context,
+                           RContext& rcontext,
+                           Attr& attr) const
+    {
+        bool success = false;
+        ((index == Is && (success = parse_into(std::get<Is>(alternatives), first, last, context, rcontext, attr))), ...);
+        return success;
+    }
+
+    template<typename Iterator, typename Context, typename RContext, typename Attr>
+    bool parse(Iterator& first, const Iterator& last, const Context& context, RContext& rcontext, Attr& attr) const
+    {
+        const auto index = lookup(first, last, context);
+        if (index.has_value() && parse_alternative(index.value(), std::index_sequence_for<Alternatives...> {}, first, last, context, rcontext, attr))
+        {
+            return true;
+        }
+        if constexpr (std::is_same_v<Fallback, NoFallback>)
+        {
+            return false;
+        }
+        else
+        {
+            return fallback.parse(first, last, context, rcontext, attr);
+        }
+    }
+};
+
+/// @brief Creates a `KeywordDispatchParser` that parses input starting with `(keywords[i]` with `alternatives[i]`.
+template<typename Attribute, typename Fallback, typename... Alternatives>
+auto keyword_dispatch(const std::array<const char*, sizeof...(Alternatives)>& keywords, Fallback fallback, Alternatives... alternatives)
+{
+    return KeywordDispatchParser<Attribute, Fallback, Alternatives...>(keywords, fallback, alternatives...);
+}
+
+/// @brief Calls the `on_success` handler of the `rule` for the `attribute` parsed from `first` to `last`, the same as the rule does
+///        after parsing it, e.g., to tag the position of the attribute.
+template<typename Rule, typename Iterator, typename Context, typename Attribute>
+void on_rule_success(const Rule&, Iterator first, const Iterator& last, const Context& context, Attribute& attribute)
+{
+    x3::skip_over(first, last, context);
+    bool pass = true;
+    typename Rule::id().on_success(first, last, attribute, x3::make_context<x3::parse_pass_context_tag>(pass, context));
+}
+
+/// @brief A connective of a `NestedFormulaParser` with the names of the rules that parse it recursively, outermost first,
+///        whose invocations are counted by the rule profiler. The names of these rules equal their identifiers.
+template<typename Keyword>
+struct NestedFormulaKeyword
+{
+    const char* keyword;
+    Keyword value;
+    std::vector<const char*> rule_names;
+};
+
+/// @brief The frame of a connective in a `NestedFormulaParser`.
+template<typename Iterator, typename Keyword, typename Prefix, typename Attribute>
+struct NestedFormulaFrame
+{
+    Keyword keyword;
+    // The start of the connective
+    Iterator first;
+    // The attributes that the connective parses before its nested formulas, e.g., the variables of a quantifier
+    Prefix prefix;
+    std::vector<Attribute> children;
+};
+
+/// @brief `NestedFormulaParser` parses formulas whose connectives nest formulas of the same kind, e.g., goal descriptors,
+///        with an explicit stack of frames instead of recursing into the rules of the connectives once per level of nesting,
+///        such that deeply nested formulas do not overflow the native stack.
+///
+///        A connective starts with `(keyword`, which is looked up like in `KeywordDispatchParser`,
+///        followed by a prefix, its nested formulas, and `)`. Other input is parsed by the `leaf` parser of `Derived`.
+///        `Derived` parses the prefix, returns the number of nested formulas of a connective, where 0 stands for any number,
+///        and creates the attribute of a connective from its frame. The nested formulas are parsed as if by the `formula` rule of `Derived`,
+///        i.e., the attributes, the calls to the `on_success` handlers, and the expectation failures are the same as for the recursive rules.
+///        With LOKI_ENABLE_PARSER_PROFILING, the frames also count the invocations of the `formula` rule and of the rules of the connectives.
+template<typename Derived, typename Attribute, typename Keyword, typename Prefix>
+struct NestedFormulaParser : x3::parser<Derived>
+{
+    using attribute_type = Attribute;
+
+    template<typename Iterator>
+    using Frame = NestedFormulaFrame<Iterator, Keyword, Prefix, Attribute>;
+
+    x3::symbols<Keyword> keywords;
+    std::vector<std::pair<Keyword, std::vector<const char*>>> rule_names;
+
+    explicit NestedFormulaParser(const std::vector<NestedFormulaKeyword<Keyword>>& keywords_) : keywords(), rule_names()
+    {
+        for (const auto& keyword : keywords_)
+        {
+            keywords.add(keyword.keyword, keyword.value);
+            rule_names.emplace_back(keyword.value, keyword.rule_names);
+        }
+    }
+
+    template<typename Iterator>
+    static bool has_all_children(const Derived& derived, const Frame<Iterator>& frame)
+    {
+        const auto arity = derived.get_arity(frame.keyword);
+        return arity != 0 && frame.children.size() == arity;
+    }
+
+#ifdef LOKI_ENABLE_PARSER_PROFILING
+    /// @brief The counters of the `formula` rule and of the rules of each connective.
+    struct ProfileCounters
+    {
+        parser::RuleCounters* formula;
+        std::vector<std::pair<Keyword, std::vector<parser::RuleCounters*>>> connectives;
+
+        const std::vector<parser::RuleCounters*>& get_connective(Keyword keyword) const
+        {
+            return std::find_if(connectives.begin(), connectives.end(), [keyword](const auto& connective) { return connective.first == keyword; })
+                ->second;
+        }
+    };
+
+    /// @brief Returns the counters, which are registered on first use like the counters of the rules.
+    const ProfileCounters& get_profile_counters() const
+    {
+        static const auto counters = [this]
+        {
+            auto result = ProfileCounters { &parser::register_rule_counters(static_cast<const Derived&>(*this).formula.name), {} };
+            for (const auto& [keyword, names] : rule_names)
+            {
+                auto& connective_counters = result.connectives.emplace_back(keyword, std::vector<parser::RuleCounters*>()).second;
+                for (const auto name : names)
+                {
+                    connective_counters.push_back(&parser::register_rule_counters(name));
+                }
+            }
+            return result;
+        }();
+        return counters;
+    }
+#endif
+
+    template<typename Iterator, typename Context, typename RContext, typename ActualAttribute>
+    bool parse(Iterator& first, const Iterator& last, const Context& context, RContext& rcontext, ActualAttribute& attribute) const
+    {
+        const auto& derived = static_cast<const Derived&>(*this);
+        auto frames = std::vector<Frame<Iterator>>();
+#ifdef LOKI_ENABLE_PARSER_PROFILING
+        // The outermost formula is counted by the `formula` rule itself, the nested formulas and all connectives by the frames.
+        const auto& profile_counters = get_profile_counters();
+        auto profile_scopes = parser::RuleProfileScopeStack();
+        const auto push_profile_scopes = [&](Keyword keyword, bool is_nested)
+        {
+            if (is_nested)
+            {
+                profile_scopes.push(*profile_counters.formula);
+            }
+            for (auto* counters : profile_counters.get_connective(keyword))
+            {
+                profile_scopes.push(*counters);
+            }
+        };
+        const auto pop_profile_scopes = [&](Keyword keyword, bool is_nested)
+        {
+            for (size_t i = 0; i < profile_counters.get_connective(keyword).size(); ++i)
+            {
+                profile_scopes.pop(true);
+            }
+            if (is_nested)
+            {
+                profile_scopes.pop(true);
+            }
+        };
+#endif
+        auto it = first;
+        while (true)
+        {
+            const auto start = it;
+            auto keyword_end = it;
+            if (const auto keyword = parse_parenthesized_keyword(keywords, keyword_end, last, context))
+            {
+#ifdef LOKI_ENABLE_PARSER_PROFILING
+                push_profile_scopes(keyword.value(), !frames.empty());
+#endif
+                it = keyword_end;
+                frames.push_back(Frame<Iterator> { keyword.value(), start, Prefix(), std::vector<Attribute>() });
+                derived.parse_prefix(frames.back(), it, last, context, rcontext);
+                continue;
+            }
+
+            auto value = Attribute();
+            bool is_list_complete = false;
+#ifdef LOKI_ENABLE_PARSER_PROFILING
+            if (!frames.empty())
+            {
+                profile_scopes.push(*profile_counters.formula);
+            }
+#endif
+            const bool is_leaf = derived.leaf.parse(it, last, context, rcontext, value);
+#ifdef LOKI_ENABLE_PARSER_PROFILING
+            if (!frames.empty())
+            {
+                profile_scopes.pop(is_leaf);
+            }
+#endif
+            if (is_leaf)
+            {
+                if (frames.empty())
+                {
+                    attribute = std::move(value);
+                    first = it;
+                    return true;
+                }
+                on_rule_success(derived.formula, start, it, context, value);
+                frames.back().children.push_back(std::move(value));
+            }
+            else if (frames.empty())
+            {
+                return false;
+            }
+            else if (derived.get_arity(frames.back().keyword) != 0)
+            {
+                boost::throw_exception(x3::expectation_failure<Iterator>(start, x3::what(derived.formula)));
+            }
+            else
+            {
+                is_list_complete = true;
+            }
+
+            // Close the connectives whose nested formulas are complete.
+            while (is_list_complete || has_all_children(derived, frames.back()))
+            {
+                is_list_complete = false;
+                x3::expect[lit(')')].parse(it, last, context, rcontext, x3::unused);
+                auto frame = std::move(frames.back());
+                frames.pop_back();
+                value = derived.create(frame, it, context);
+#ifdef LOKI_ENABLE_PARSER_PROFILING
+                pop_profile_scopes(frame.keyword, !frames.empty());
+#endif
+                if (frames.empty())
+                {
+                    attribute = std::move(value);
+                    first = it;
+                    return true;
+                }
+                on_rule_success(derived.formula, frame.first, it, context, value);
+                frames.back().children.push_back(std::move(value));
+            }
+        }
+    }
+};
+
 parser::define_keyword_type const& define_keyword();
 parser::domain_keyword_type const& domain_keyword();
 
@@ -24,16 +24,17 @@
 #include "loki/details/ast/parser.hpp"
 #include "loki/details/ast/parser_wrapper.hpp"
 #include "parser.hpp"
+#include "profiler.hpp"
 
 #include <boost/spirit/home/x3.hpp>
 #include <boost/spirit/home/x3/support/utility/annotate_on_success.hpp>
+#include <stdexcept>
 
 namespace loki::parser
 {
 namespace x3 = boost::spirit::x3;
 namespace ascii = boost::spirit::x3::ascii;
 
-using x3::double_;
 using x3::eps;
 using x3::int_;
 using x3::lexeme;
@@ -268,7 +269,7 @@ const auto name_total_cost_def = keyword_string("total-cost");
 const auto function_symbol_total_cost_def = name_total_cost;
 const auto function_symbol_def = name;
 const auto term_def = name | variable;
-const auto number_def = double_;
+const auto number_def = NumberParser {};
 const auto predicate_def = name;
 
 const auto requirement_strips_def = keyword_lit(":strips") > x3::attr(ast::RequirementStrips {});
@@ -344,8 +345,128 @@ const auto function_expression_binary_op_def = (lit('(') >> binary_operator >> f
 const auto function_expression_minus_def = (lit('(') >> lit('-')) >> function_expression > lit(')');
 const auto function_expression_head_def = function_head;
 
-const auto goal_descriptor_def = goal_descriptor_not | goal_descriptor_and | goal_descriptor_or | goal_descriptor_imply | goal_descriptor_exists
-                                 | goal_descriptor_forall | goal_descriptor_function_comparison | goal_descriptor_atom | goal_descriptor_literal;
+/// @brief Parses `> '(' > typed_list_of_variables > ')'` after the keyword of a quantifier.
+template<typename Iterator, typename Context, typename RContext>
+void parse_quantified_variables(Iterator& first, const Iterator& last, const Context& context, RContext& rcontext, ast::TypedListOfVariables& attribute)
+{
+    x3::expect[lit('(')].parse(first, last, context, rcontext, x3::unused);
+    x3::expect[typed_list_of_variables].parse(first, last, context, rcontext, attribute);
+    x3::expect[lit(')')].parse(first, last, context, rcontext, x3::unused);
+}
+
+enum class GoalDescriptorConnective
+{
+    NOT,
+    AND,
+    OR,
+    IMPLY,
+    EXISTS,
+    FORALL
+};
+
+/// @brief `GoalDescriptorParser` parses the same as
+///        `keyword_dispatch<ast::GoalDescriptor>({ "not", "and", "or", "imply", "exists", "forall" }, goal_descriptor_function_comparison | ...)`
+///        over the rules of the connectives, but with an explicit stack, see `NestedFormulaParser`.
+struct GoalDescriptorParser : NestedFormulaParser<GoalDescriptorParser, ast::GoalDescriptor, GoalDescriptorConnective, ast::TypedListOfVariables>
+{
+    using Connective = GoalDescriptorConnective;
+
+    decltype(goal_descriptor_function_comparison | goal_descriptor_atom | goal_descriptor_literal) leaf;
+    goal_descriptor_type formula;
+
+    GoalDescriptorParser() :
+        NestedFormulaParser({ { "not", Connective::NOT, { goal_descriptor_not.name } },
+                              { "and", Connective::AND, { goal_descriptor_and.name } },
+                              { "or", Connective::OR, { goal_descriptor_or.name } },
+                              { "imply", Connective::IMPLY, { goal_descriptor_imply.name } },
+                              { "exists", Connective::EXISTS, { goal_descriptor_exists.name } },
+                              { "forall", Connective::FORALL, { goal_descriptor_forall.name } } }),
+        leaf(goal_descriptor_function_comparison | goal_descriptor_atom | goal_descriptor_literal),
+        formula(goal_descriptor)
+    {
+    }
+
+    static size_t get_arity(Connective connective)
+    {
+        switch (connective)
+        {
+            case Connective::AND:
+            case Connective::OR:
+                return 0;
+            case Connective::IMPLY:
+                return 2;
+            default:
+                return 1;
+        }
+    }
+
+    template<typename Iterator, typename Context, typename RContext>
+    void parse_prefix(Frame<Iterator>& frame, Iterator& first, const Iterator& last, const Context& context, RContext& rcontext) const
+    {
+        if (frame.keyword == Connective::EXISTS || frame.keyword == Connective::FORALL)
+        {
+            parse_quantified_variables(first, last, context, rcontext, frame.prefix);
+        }
+    }
+
+    template<typename Iterator, typename Context>
+    ast::GoalDescriptor create(Frame<Iterator>& frame, const Iterator& last, const Context& context) const
+    {
+        auto& children = frame.children;
+        switch (frame.keyword)
+        {
+            case Connective::NOT:
+            {
+                auto node = ast::GoalDescriptorNot();
+                node.goal_descriptor = std::move(children.at(0));
+                on_rule_success(goal_descriptor_not, frame.first, last, context, node);
+                return ast::GoalDescriptor(std::move(node));
+            }
+            case Connective::AND:
+            {
+                auto node = ast::GoalDescriptorAnd();
+                node.goal_descriptors = std::move(children);
+                on_rule_success(goal_descriptor_and, frame.first, last, context, node);
+                return ast::GoalDescriptor(std::move(node));
+            }
+            case Connective::OR:
+            {
+                auto node = ast::GoalDescriptorOr();
+                node.goal_descriptors = std::move(children);
+                on_rule_success(goal_descriptor_or, frame.first, last, context, node);
+                return ast::GoalDescriptor(std::move(node));
+            }
+            case Connective::IMPLY:
+            {
+                auto node = ast::GoalDescriptorImply();
+                node.goal_descriptor_left = std::move(children.at(0));
+                node.goal_descriptor_right = std::move(children.at(1));
+                on_rule_success(goal_descriptor_imply, frame.first, last, context, node);
+                return ast::GoalDescriptor(std::move(node));
+            }
+            case Connective::EXISTS:
+            {
+                auto node = ast::GoalDescriptorExists();
+                node.typed_list_of_variables = std::move(frame.prefix);
+                node.goal_descriptor = std::move(children.at(0));
+                on_rule_success(goal_descriptor_exists, frame.first, last, context, node);
+                return ast::GoalDescriptor(std::move(node));
+            }
+            case Connective::FORALL:
+            {
+                auto node = ast::GoalDescriptorForall();
+                node.typed_list_of_variables = std::move(frame.prefix);
+                node.goal_descriptor = std::move(children.at(0));
+                on_rule_success(goal_descriptor_forall, frame.first, last, context, node);
+                return ast::GoalDescriptor(std::move(node));
+            }
+        }
+        throw std::logic_error("GoalDescriptorParser::create: unexpected connective.");
+    }
+};
+
+// Goal descriptors of machine-generated problems can be nested deeply, hence, the connectives are parsed without recursion.
+const auto goal_descriptor_def = GoalDescriptorParser();
 const auto goal_descriptor_atom_def = atom;
 const auto goal_descriptor_literal_def = literal;
 const auto goal_descriptor_and_def = (lit('(') >> keyword_lit("and")) > *goal_descriptor > lit(')');
@@ -356,11 +477,31 @@ const auto goal_descriptor_exists_def = (lit('(') >> keyword_lit("exists")) > li
 const auto goal_descriptor_forall_def = (lit('(') >> keyword_lit("forall")) > lit('(') > typed_list_of_variables > lit(')') > goal_descriptor > lit(')');
 const auto goal_descriptor_function_comparison_def = (lit('(') >> binary_comparator) >> function_expression > function_expression > lit(')');
 
-const auto constraint_goal_descriptor_def = constraint_goal_descriptor_and | constraint_goal_descriptor_forall | constraint_goal_descriptor_at_end
-                                            | constraint_goal_descriptor_always | constraint_goal_descriptor_sometime | constraint_goal_descriptor_within
-                                            | constraint_goal_descriptor_at_most_once | constraint_goal_descriptor_sometime_after
-                                            | constraint_goal_descriptor_sometime_before | constraint_goal_descriptor_always_within
-                                            | constraint_goal_descriptor_hold_during | constraint_goal_descriptor_hold_after;
+const auto constraint_goal_descriptor_def = keyword_dispatch<ast::ConstraintGoalDescriptor>({ "and",
+                                                                                              "forall",
+                                                                                              "at",
+                                                                                              "always",
+                                                                                              "sometime",
+                                                                                              "within",
+                                                                                              "at-most-once",
+                                                                                              "sometime-after",
+                                                                                              "sometime-before",
+                                                                                              "always-within",
+                                                                                              "hold-during",
+                                                                                              "hold-after" },
+                                                                                            NoFallback {},
+                                                                                            constraint_goal_descriptor_and,
+                                                                                            constraint_goal_descriptor_forall,
+                                                                                            constraint_goal_descriptor_at_end,
+                                                                                            constraint_goal_descriptor_always,
+                                                                                            constraint_goal_descriptor_sometime,
+                                                                                            constraint_goal_descriptor_within,
+                                                                                            constraint_goal_descriptor_at_most_once,
+                                                                                            constraint_goal_descriptor_sometime_after,
+                                                                                            constraint_goal_descriptor_sometime_before,
+                                                                                            constraint_goal_descriptor_always_within,
+                                                                                            constraint_goal_descriptor_hold_during,
+                                                                                            constraint_goal_descriptor_hold_after);
 const auto constraint_goal_descriptor_and_def = (lit('(') >> keyword_lit("and")) > *constraint_goal_descriptor > lit(')');
 const auto constraint_goal_descriptor_forall_def = (lit('(') >> keyword_lit("forall")) > lit('(') > typed_list_of_variables > lit(')')
                                                    > constraint_goal_descriptor > lit(')');
@@ -375,8 +516,62 @@ const auto constraint_goal_descriptor_always_within_def = (lit('(') >> keyword_l
 const auto constraint_goal_descriptor_hold_during_def = (lit('(') >> keyword_lit("hold-during")) > number > number > goal_descriptor > lit(')');
 const auto constraint_goal_descriptor_hold_after_def = (lit('(') >> keyword_lit("hold-after")) > number > goal_descriptor > lit(')');
 
-const auto precondition_goal_descriptor_def =
-    precondition_goal_descriptor_and | precondition_goal_descriptor_preference | precondition_goal_descriptor_forall | precondition_goal_descriptor_simple;
+enum class PreconditionGoalDescriptorConnective
+{
+    AND,
+    FORALL
+};
+
+/// @brief `PreconditionGoalDescriptorParser` parses the same as
+///        `keyword_dispatch<ast::PreconditionGoalDescriptor>({ "and", "preference", "forall" }, precondition_goal_descriptor_simple, ...)`
+///        over the rules of the connectives, but with an explicit stack, see `NestedFormulaParser`.
+struct PreconditionGoalDescriptorParser :
+    NestedFormulaParser<PreconditionGoalDescriptorParser, ast::PreconditionGoalDescriptor, PreconditionGoalDescriptorConnective, ast::TypedListOfVariables>
+{
+    using Connective = PreconditionGoalDescriptorConnective;
+
+    // A preference does not nest precondition goal descriptors and rejects input without its keyword.
+    decltype(precondition_goal_descriptor_preference | precondition_goal_descriptor_simple) leaf;
+    precondition_goal_descriptor_type formula;
+
+    PreconditionGoalDescriptorParser() :
+        NestedFormulaParser({ { "and", Connective::AND, { precondition_goal_descriptor_and.name } },
+                              { "forall", Connective::FORALL, { precondition_goal_descriptor_forall.name } } }),
+        leaf(precondition_goal_descriptor_preference | precondition_goal_descriptor_simple),
+        formula(precondition_goal_descriptor)
+    {
+    }
+
+    static size_t get_arity(Connective connective) { return (connective == Connective::AND) ? 0 : 1; }
+
+    template<typename Iterator, typename Context, typename RContext>
+    void parse_prefix(Frame<Iterator>& frame, Iterator& first, const Iterator& last, const Context& context, RContext& rcontext) const
+    {
+        if (frame.keyword == Connective::FORALL)
+        {
+            parse_quantified_variables(first, last, context, rcontext, frame.prefix);
+        }
+    }
+
+    template<typename Iterator, typename Context>
+    ast::PreconditionGoalDescriptor create(Frame<Iterator>& frame, const Iterator& last, const Context& context) const
+    {
+        if (frame.keyword == Connective::AND)
+        {
+            auto node = ast::PreconditionGoalDescriptorAnd();
+            node.precondition_goal_descriptors = std::move(frame.children);
+            on_rule_success(precondition_goal_descriptor_and, frame.first, last, context, node);
+            return ast::PreconditionGoalDescriptor(std::move(node));
+        }
+        auto node = ast::PreconditionGoalDescriptorForall();
+        node.typed_list_of_variables = std::move(frame.prefix);
+        node.precondition_goal_descriptor = std::move(frame.children.at(0));
+        on_rule_success(precondition_goal_descriptor_forall, frame.first, last, context, node);
+        return ast::PreconditionGoalDescriptor(std::move(node));
+    }
+};
+
+const auto precondition_goal_descriptor_def = PreconditionGoalDescriptorParser();
 const auto preference_name_def = name;
 const auto precondition_goal_descriptor_simple_def = goal_descriptor;
 const auto precondition_goal_descriptor_and_def = (lit('(') >> keyword_lit("and") > *precondition_goal_descriptor) > lit(')');
@@ -395,9 +590,97 @@ const auto assign_operator_def =
 // For action cost effects only
 const auto numeric_term_def = function_expression_number | function_expression_head;
 
-const auto effect_root_def = ((lit('(') >> keyword_lit("and")) > *effect_numeric_fluent_total_cost_or_effect > lit(')')) | effect_conditional
-                             | effect_production | effect_production_numeric_fluent_total_cost;
-const auto effect_def = ((lit('(') >> keyword_lit("and")) > *effect > lit(')')) | effect_conditional | effect_production;
+const auto effect_root_def = keyword_dispatch<ast::EffectRoot>({ "and", "forall", "when" },
+                                                                effect_production | effect_production_numeric_fluent_total_cost,
+                                                                (lit('(') >> keyword_lit("and")) > *effect_numeric_fluent_total_cost_or_effect > lit(')'),
+                                                                effect_conditional,
+                                                                effect_conditional);
+enum class EffectConnective
+{
+    AND,
+    FORALL,
+    WHEN
+};
+
+struct EffectPrefix
+{
+    ast::TypedListOfVariables typed_list_of_variables;
+    ast::GoalDescriptor goal_descriptor;
+};
+
+/// @brief `EffectParser` parses the same as
+///        `keyword_dispatch<ast::Effect>({ "and", "forall", "when" }, effect_production, ...)`
+///        over the rules of the connectives, but with an explicit stack, see `NestedFormulaParser`.
+struct EffectParser : NestedFormulaParser<EffectParser, ast::Effect, EffectConnective, EffectPrefix>
+{
+    using Connective = EffectConnective;
+
+    effect_production_type leaf;
+    effect_type formula;
+
+    EffectParser() :
+        // The list of effects has no rule of its own.
+        NestedFormulaParser({ { "and", Connective::AND, {} },
+                              { "forall", Connective::FORALL, { effect_conditional.name, effect_conditional_forall.name } },
+                              { "when", Connective::WHEN, { effect_conditional.name, effect_conditional_when.name } } }),
+        leaf(effect_production),
+        formula(effect)
+    {
+    }
+
+    static size_t get_arity(Connective connective) { return (connective == Connective::AND) ? 0 : 1; }
+
+    template<typename Iterator, typename Context, typename RContext>
+    void parse_prefix(Frame<Iterator>& frame, Iterator& first, const Iterator& last, const Context& context, RContext& rcontext) const
+    {
+        if (frame.keyword == Connective::FORALL)
+        {
+            parse_quantified_variables(first, last, context, rcontext, frame.prefix.typed_list_of_variables);
+        }
+        else if (frame.keyword == Connective::WHEN)
+        {
+            x3::expect[goal_descriptor].parse(first, last, context, rcontext, frame.prefix.goal_descriptor);
+        }
+    }
+
+    template<typename Rule, typename Iterator, typename Context, typename Node>
+    static ast::Effect create_conditional(const Rule& rule, const Frame<Iterator>& frame, const Iterator& last, const Context& context, Node& node)
+    {
+        on_rule_success(rule, frame.first, last, context, node);
+        auto conditional = ast::EffectConditional(std::move(node));
+        on_rule_success(effect_conditional, frame.first, last, context, conditional);
+        return ast::Effect(std::move(conditional));
+    }
+
+    template<typename Iterator, typename Context>
+    ast::Effect create(Frame<Iterator>& frame, const Iterator& last, const Context& context) const
+    {
+        switch (frame.keyword)
+        {
+            case Connective::AND:
+            {
+                return ast::Effect(std::move(frame.children));
+            }
+            case Connective::FORALL:
+            {
+                auto node = ast::EffectConditionalForall();
+                node.typed_list_of_variables = std::move(frame.prefix.typed_list_of_variables);
+                node.effect = std::move(frame.children.at(0));
+                return create_conditional(effect_conditional_forall, frame, last, context, node);
+            }
+            case Connective::WHEN:
+            {
+                auto node = ast::EffectConditionalWhen();
+                node.goal_descriptor = std::move(frame.prefix.goal_descriptor);
+                node.effect = std::move(frame.children.at(0));
+                return create_conditional(effect_conditional_when, frame, last, context, node);
+            }
+        }
+        throw std::logic_error("EffectParser::create: unexpected connective.");
+    }
+};
+
+const auto effect_def = EffectParser();
 const auto effect_numeric_fluent_total_cost_or_effect_def = effect_production_numeric_fluent_total_cost | effect;
 const auto effect_production_literal_def = literal;
 const auto effect_production_numeric_fluent_total_cost_def = (lit('(') >> assign_operator_increase >> lit('(') >> function_symbol_total_cost) > lit(')')
@@ -493,158 +776,158 @@ const auto problem_def = lit('(') > define_keyword > problem_name > problem_doma
 /**
  * Domain
  */
-BOOST_SPIRIT_DEFINE(name, variable, name_total_cost, function_symbol_total_cost, function_symbol, term, number, predicate)
-
-BOOST_SPIRIT_DEFINE(requirement_strips,
-                    requirement_typing,
-                    requirement_negative_preconditions,
-                    requirement_disjunctive_preconditions,
-                    requirement_equality,
-                    requirement_existential_preconditions,
-                    requirement_universal_preconditions,
-                    requirement_quantified_preconditions,
-                    requirement_conditional_effects,
-                    requirement_fluents,
-                    requirement_object_fluents,
-                    requirement_numeric_fluents,
-                    requirement_adl,
-                    requirement_durative_actions,
-                    requirement_derived_predicates,
-                    requirement_timed_initial_literals,
-                    requirement_preferences,
-                    requirement_constraints,
-                    requirement_action_costs,
-                    requirement)
-
-BOOST_SPIRIT_DEFINE(type,
-                    type_object,
-                    type_number,
-                    type_either,
-                    typed_list_of_names_recursively,
-                    typed_list_of_names,
-                    typed_list_of_variables_recursively,
-                    typed_list_of_variables)
-
-BOOST_SPIRIT_DEFINE(atomic_formula_skeleton)
-
-BOOST_SPIRIT_DEFINE(atomic_function_skeleton_total_cost,
-                    atomic_function_skeleton_general,
-                    atomic_function_skeleton,
-                    function_typed_list_of_atomic_function_skeletons_recursively,
-                    function_typed_list_of_atomic_function_skeletons)
-
-BOOST_SPIRIT_DEFINE(atomic_formula_of_terms_predicate, atomic_formula_of_terms_equality, atomic_formula_of_terms, atom, negated_atom, literal)
-
-BOOST_SPIRIT_DEFINE(multi_operator_mul, multi_operator_plus, multi_operator, binary_operator_minus, binary_operator_div, binary_operator)
-
-BOOST_SPIRIT_DEFINE(binary_comparator_greater,
-                    binary_comparator_less,
-                    binary_comparator_equal,
-                    binary_comparator_greater_equal,
-                    binary_comparator_less_equal,
-                    binary_comparator)
-
-BOOST_SPIRIT_DEFINE(function_head,
-                    function_expression,
-                    function_expression_number,
-                    function_expression_binary_op,
-                    function_expression_minus,
-                    function_expression_head)
-
-BOOST_SPIRIT_DEFINE(goal_descriptor,
-                    goal_descriptor_atom,
-                    goal_descriptor_literal,
-                    goal_descriptor_and,
-                    goal_descriptor_or,
-                    goal_descriptor_not,
-                    goal_descriptor_imply,
-                    goal_descriptor_exists,
-                    goal_descriptor_forall,
-                    goal_descriptor_function_comparison)
-
-BOOST_SPIRIT_DEFINE(constraint_goal_descriptor,
-                    constraint_goal_descriptor_and,
-                    constraint_goal_descriptor_forall,
-                    constraint_goal_descriptor_at_end,
-                    constraint_goal_descriptor_always,
-                    constraint_goal_descriptor_sometime,
-                    constraint_goal_descriptor_within,
-                    constraint_goal_descriptor_at_most_once,
-                    constraint_goal_descriptor_sometime_after,
-                    constraint_goal_descriptor_sometime_before,
-                    constraint_goal_descriptor_always_within,
-                    constraint_goal_descriptor_hold_during,
-                    constraint_goal_descriptor_hold_after)
-
-BOOST_SPIRIT_DEFINE(preference_name,
-                    precondition_goal_descriptor,
-                    precondition_goal_descriptor_simple,
-                    precondition_goal_descriptor_and,
-                    precondition_goal_descriptor_preference,
-                    precondition_goal_descriptor_forall)
-
-BOOST_SPIRIT_DEFINE(assign_operator_assign,
-                    assign_operator_scale_up,
-                    assign_operator_scale_down,
-                    assign_operator_increase,
-                    assign_operator_decrease,
-                    assign_operator)
-
-BOOST_SPIRIT_DEFINE(numeric_term)
-
-BOOST_SPIRIT_DEFINE(effect,
-                    effect_production_literal,
-                    effect_production_numeric_fluent_total_cost,
-                    effect_production_numeric_fluent_general,
-                    effect_production,
-                    effect_conditional_forall,
-                    effect_conditional_when,
-                    effect_conditional,
-                    effect_numeric_fluent_total_cost_or_effect,
-                    effect_root,
-                    action_symbol,
-                    action_body,
-                    action,
-                    axiom)
-
-BOOST_SPIRIT_DEFINE(define_keyword, domain_keyword, domain_name, requirements, types, constants, predicates, functions, constraints, structure, domain)
+LOKI_SPIRIT_DEFINE(name, variable, name_total_cost, function_symbol_total_cost, function_symbol, term, number, predicate)
+
+LOKI_SPIRIT_DEFINE(requirement_strips,
+                   requirement_typing,
+                   requirement_negative_preconditions,
+                   requirement_disjunctive_preconditions,
+                   requirement_equality,
+                   requirement_existential_preconditions,
+                   requirement_universal_preconditions,
+                   requirement_quantified_preconditions,
+                   requirement_conditional_effects,
+                   requirement_fluents,
+                   requirement_object_fluents,
+                   requirement_numeric_fluents,
+                   requirement_adl,
+                   requirement_durative_actions,
+                   requirement_derived_predicates,
+                   requirement_timed_initial_literals,
+                   requirement_preferences,
+                   requirement_constraints,
+                   requirement_action_costs,
+                   requirement)
+
+LOKI_SPIRIT_DEFINE(type,
+                   type_object,
+                   type_number,
+                   type_either,
+                   typed_list_of_names_recursively,
+                   typed_list_of_names,
+                   typed_list_of_variables_recursively,
+                   typed_list_of_variables)
+
+LOKI_SPIRIT_DEFINE(atomic_formula_skeleton)
+
+LOKI_SPIRIT_DEFINE(atomic_function_skeleton_total_cost,
+                   atomic_function_skeleton_general,
+                   atomic_function_skeleton,
+                   function_typed_list_of_atomic_function_skeletons_recursively,
+                   function_typed_list_of_atomic_function_skeletons)
+
+LOKI_SPIRIT_DEFINE(atomic_formula_of_terms_predicate, atomic_formula_of_terms_equality, atomic_formula_of_terms, atom, negated_atom, literal)
+
+LOKI_SPIRIT_DEFINE(multi_operator_mul, multi_operator_plus, multi_operator, binary_operator_minus, binary_operator_div, binary_operator)
+
+LOKI_SPIRIT_DEFINE(binary_comparator_greater,
+                   binary_comparator_less,
+                   binary_comparator_equal,
+                   binary_comparator_greater_equal,
+                   binary_comparator_less_equal,
+                   binary_comparator)
+
+LOKI_SPIRIT_DEFINE(function_head,
+                   function_expression,
+                   function_expression_number,
+                   function_expression_binary_op,
+                   function_expression_minus,
+                   function_expression_head)
+
+LOKI_SPIRIT_DEFINE(goal_descriptor,
+                   goal_descriptor_atom,
+                   goal_descriptor_literal,
+                   goal_descriptor_and,
+                   goal_descriptor_or,
+                   goal_descriptor_not,
+                   goal_descriptor_imply,
+                   goal_descriptor_exists,
+                   goal_descriptor_forall,
+                   goal_descriptor_function_comparison)
+
+LOKI_SPIRIT_DEFINE(constraint_goal_descriptor,
+                   constraint_goal_descriptor_and,
+                   constraint_goal_descriptor_forall,
+                   constraint_goal_descriptor_at_end,
+                   constraint_goal_descriptor_always,
+                   constraint_goal_descriptor_sometime,
+                   constraint_goal_descriptor_within,
+                   constraint_goal_descriptor_at_most_once,
+                   constraint_goal_descriptor_sometime_after,
+                   constraint_goal_descriptor_sometime_before,
+                   constraint_goal_descriptor_always_within,
+                   constraint_goal_descriptor_hold_during,
+                   constraint_goal_descriptor_hold_after)
+
+LOKI_SPIRIT_DEFINE(preference_name,
+                   precondition_goal_descriptor,
+                   precondition_goal_descriptor_simple,
+                   precondition_goal_descriptor_and,
+                   precondition_goal_descriptor_preference,
+                   precondition_goal_descriptor_forall)
+
+LOKI_SPIRIT_DEFINE(assign_operator_assign,
+                   assign_operator_scale_up,
+                   assign_operator_scale_down,
+                   assign_operator_increase,
+                   assign_operator_decrease,
+                   assign_operator)
+
+LOKI_SPIRIT_DEFINE(numeric_term)
+
+LOKI_SPIRIT_DEFINE(effect,
+                   effect_production_literal,
+                   effect_production_numeric_fluent_total_cost,
+                   effect_production_numeric_fluent_general,
+                   effect_production,
+                   effect_conditional_forall,
+                   effect_conditional_when,
+                   effect_conditional,
+                   effect_numeric_fluent_total_cost_or_effect,
+                   effect_root,
+                   action_symbol,
+                   action_body,
+                   action,
+                   axiom)
+
+LOKI_SPIRIT_DEFINE(define_keyword, domain_keyword, domain_name, requirements, types, constants, predicates, functions, constraints, structure, domain)
 
 /**
  * Problem
  */
-BOOST_SPIRIT_DEFINE(basic_function_term)
-
-BOOST_SPIRIT_DEFINE(atomic_formula_of_names_predicate,
-                    atomic_formula_of_names_equality,
-                    atomic_formula_of_names,
-                    ground_atom,
-                    negated_ground_atom,
-                    ground_literal)
-
-BOOST_SPIRIT_DEFINE(initial_element_literals,
-                    initial_element_timed_literals,
-                    initial_element_numeric_fluents_total_cost,
-                    initial_element_numeric_fluents_general,
-                    initial_element)
-
-BOOST_SPIRIT_DEFINE(metric_function_expression,
-                    metric_function_expression_number,
-                    metric_function_expression_binary_operator,
-                    metric_function_expression_multi_operator,
-                    metric_function_expression_minus,
-                    metric_function_expression_basic_function_term,
-                    metric_function_expression_total_time,
-                    metric_function_expression_preferences)
-
-BOOST_SPIRIT_DEFINE(optimization_minimize, optimization_maximize, optimization, metric_specification_total_cost, metric_specification_general)
-
-BOOST_SPIRIT_DEFINE(preference_constraint_goal_descriptor,
-                    preference_constraint_goal_descriptor_and,
-                    preference_constraint_goal_descriptor_forall,
-                    preference_constraint_goal_descriptor_preference,
-                    preference_constraint_goal_descriptor_simple)
-
-BOOST_SPIRIT_DEFINE(problem_keyword, problem_name, problem_domain_name, objects, initial, goal, problem_constraints, metric_specification, problem)
+LOKI_SPIRIT_DEFINE(basic_function_term)
+
+LOKI_SPIRIT_DEFINE(atomic_formula_of_names_predicate,
+                   atomic_formula_of_names_equality,
+                   atomic_formula_of_names,
+                   ground_atom,
+                   negated_ground_atom,
+                   ground_literal)
+
+LOKI_SPIRIT_DEFINE(initial_element_literals,
+                   initial_element_timed_literals,
+                   initial_element_numeric_fluents_total_cost,
+                   initial_element_numeric_fluents_general,
+                   initial_element)
+
+LOKI_SPIRIT_DEFINE(metric_function_expression,
+                   metric_function_expression_number,
+                   metric_function_expression_binary_operator,
+                   metric_function_expression_multi_operator,
+                   metric_function_expression_minus,
+                   metric_function_expression_basic_function_term,
+                   metric_function_expression_total_time,
+                   metric_function_expression_preferences)
+
+LOKI_SPIRIT_DEFINE(optimization_minimize, optimization_maximize, optimization, metric_specification_total_cost, metric_specification_general)
+
+LOKI_SPIRIT_DEFINE(preference_constraint_goal_descriptor,
+                   preference_constraint_goal_descriptor_and,
+                   preference_constraint_goal_descriptor_forall,
+                   preference_constraint_goal_descriptor_preference,
+                   preference_constraint_goal_descriptor_simple)
+
+LOKI_SPIRIT_DEFINE(problem_keyword, problem_name, problem_domain_name, objects, initial, goal, problem_constraints, metric_specification, problem)
 
 ///////////////////////////////////////////////////////////////////////////
 // Annotation and Error handling
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "profiler.hpp"
+
+#include "loki/details/ast/profiler.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <iomanip>
+#include <mutex>
+#include <string_view>
+
+namespace loki
+{
+namespace parser
+{
+
+RuleCounters::RuleCounters(const char* name_) :
+    name(name_),
+    num_invocations(0),
+    num_successes(0),
+    num_backtracks(0),
+    num_exceptions(0),
+    total_nanoseconds(0),
+    self_nanoseconds(0)
+{
+}
+
+// The registry owns the counters of all rules. Deque keeps references stable while rules register.
+static std::mutex s_registry_mutex;
+static std::deque<RuleCounters> s_registry;
+
+RuleCounters& register_rule_counters(const char* name)
+{
+    auto lock = std::lock_guard<std::mutex>(s_registry_mutex);
+    // A rule is instantiated once per context in which it is used, e.g., inside of a lexeme, but all share the counters.
+    const auto it = std::find_if(s_registry.begin(), s_registry.end(), [name](const auto& counters) { return std::string_view(counters.name) == name; });
+    if (it != s_registry.end())
+    {
+        return *it;
+    }
+    return s_registry.emplace_back(name);
+}
+
+thread_local RuleProfileScope* RuleProfileScope::s_current = nullptr;
+
+RuleProfileScope::RuleProfileScope(RuleCounters& counters) :
+    m_counters(counters),
+    m_parent(s_current),
+    m_start(Clock::now()),
+    m_nested_time(Clock::duration::zero()),
+    m_finished(false)
+{
+    s_current = this;
+}
+
+RuleProfileScope::~RuleProfileScope()
+{
+    const auto elapsed = Clock::now() - m_start;
+    m_counters.num_invocations.fetch_add(1, std::memory_order_relaxed);
+    if (!m_finished)
+    {
+        m_counters.num_exceptions.fetch_add(1, std::memory_order_relaxed);
+    }
+    m_counters.total_nanoseconds.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(), std::memory_order_relaxed);
+    m_counters.self_nanoseconds.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed - m_nested_time).count(),
+                                          std::memory_order_relaxed);
+    if (m_parent)
+    {
+        m_parent->m_nested_time += elapsed;
+    }
+    s_current = m_parent;
+}
+
+void RuleProfileScope::finish(bool success)
+{
+    m_finished = true;
+    auto& counter = (success) ? m_counters.num_successes : m_counters.num_backtracks;
+    counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+RuleProfileScopeStack::RuleProfileScopeStack() : m_scopes() {}
+
+RuleProfileScopeStack::~RuleProfileScopeStack()
+{
+    while (!m_scopes.empty())
+    {
+        m_scopes.pop_back();
+    }
+}
+
+void RuleProfileScopeStack::push(RuleCounters& counters) { m_scopes.emplace_back(counters); }
+
+void RuleProfileScopeStack::pop(bool success)
+{
+    m_scopes.back().finish(success);
+    m_scopes.pop_back();
+}
+
+}
+
+bool is_parser_profiling_enabled()
+{
+#ifdef LOKI_ENABLE_PARSER_PROFILING
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::vector<RuleProfile> get_parser_profiles()
+{
+    auto profiles = std::vector<RuleProfile>();
+    {
+        auto lock = std::lock_guard<std::mutex>(parser::s_registry_mutex);
+        for (const auto& counters : parser::s_registry)
+        {
+            const auto num_invocations = counters.num_invocations.load(std::memory_order_relaxed);
+            if (num_invocations == 0)
+            {
+                continue;
+            }
+            profiles.push_back(RuleProfile { counters.name,
+                                             num_invocations,
+                                             counters.num_successes.load(std::memory_order_relaxed),
+                                             counters.num_backtracks.load(std::memory_order_relaxed),
+                                             counters.num_exceptions.load(std::memory_order_relaxed),
+                                             std::chrono::nanoseconds(counters.total_nanoseconds.load(std::memory_order_relaxed)),
+                                             std::chrono::nanoseconds(counters.self_nanoseconds.load(std::memory_order_relaxed)) });
+        }
+    }
+    std::sort(profiles.begin(),
+              profiles.end(),
+              [](const auto& lhs, const auto& rhs)
+              {
+                  if (lhs.self_time != rhs.self_time)
+                  {
+                      return lhs.self_time > rhs.self_time;
+                  }
+                  return lhs.name < rhs.name;
+              });
+    return profiles;
+}
+
+void reset_parser_profiles()
+{
+    auto lock = std::lock_guard<std::mutex>(parser::s_registry_mutex);
+    for (auto& counters : parser::s_registry)
+    {
+        counters.num_invocations.store(0, std::memory_order_relaxed);
+        counters.num_successes.store(0, std::memory_order_relaxed);
+        counters.num_backtracks.store(0, std::memory_order_relaxed);
+        counters.num_exceptions.store(0, std::memory_order_relaxed);
+        counters.total_nanoseconds.store(0, std::memory_order_relaxed);
+        counters.self_nanoseconds.store(0, std::memory_order_relaxed);
+    }
+}
+
+void print_parser_profiles(std::ostream& out, const std::vector<RuleProfile>& profiles)
+{
+    auto total_self_time = std::chrono::nanoseconds::zero();
+    size_t name_width = 4;
+    for (const auto& profile : profiles)
+    {
+        total_self_time += profile.self_time;
+        name_width = std::max(name_width, profile.name.size());
+    }
+    const auto to_milliseconds = [](std::chrono::nanoseconds time) { return std::chrono::duration<double, std::milli>(time).count(); };
+
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+    out << std::left << std::setw(name_width) << "rule" << std::right << std::setw(12) << "calls" << std::setw(12) << "successes" << std::setw(12)
+        << "backtracks" << std::setw(12) << "exceptions" << std::setw(12) << "total [ms]" << std::setw(12) << "self [ms]" << std::setw(8) << "self %"
+        << "\n";
+    out << std::fixed << std::setprecision(3);
+    for (const auto& profile : profiles)
+    {
+        const auto self_share = (total_self_time.count() > 0) ? 100. * profile.self_time.count() / total_self_time.count() : 0.;
+        out << std::left << std::setw(name_width) << profile.name << std::right << std::setw(12) << profile.num_invocations << std::setw(12)
+            << profile.num_successes << std::setw(12) << profile.num_backtracks << std::setw(12) << profile.num_exceptions << std::setw(12)
+            << to_milliseconds(profile.total_time) << std::setw(12) << to_milliseconds(profile.self_time) << std::setw(8) << std::setprecision(1)
+            << self_share << std::setprecision(3) << "\n";
+    }
+    out.flags(flags);
+    out.precision(precision);
+}
+
+}
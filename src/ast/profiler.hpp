@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LOKI_SRC_AST_PROFILER_HPP_
+#define LOKI_SRC_AST_PROFILER_HPP_
+
+#include <atomic>
+#include <boost/spirit/home/x3.hpp>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+
+namespace loki::parser
+{
+
+/// @brief `RuleCounters` accumulates the statistics of one rule.
+///        The counters are atomic because the problems may be parsed concurrently.
+struct RuleCounters
+{
+    const char* name;
+    std::atomic<uint64_t> num_invocations;
+    std::atomic<uint64_t> num_successes;
+    std::atomic<uint64_t> num_backtracks;
+    std::atomic<uint64_t> num_exceptions;
+    std::atomic<int64_t> total_nanoseconds;
+    std::atomic<int64_t> self_nanoseconds;
+
+    explicit RuleCounters(const char* name_);
+};
+
+/// @brief Returns the counters of the rule with the given name that live until the end of the program.
+///        Rules with the same name share their counters, hence, rules are registered with their identifiers,
+///        which are unique, whereas the names of keywords, e.g., of `domain_keyword`, coincide with the names of other rules.
+extern RuleCounters& register_rule_counters(const char* name);
+
+/// @brief `RuleProfileScope` measures one invocation of a rule.
+///
+///        The scopes of nested rules of the same thread form a stack
+///        such that the time of a nested rule is subtracted from the self time of its caller.
+///        A scope that is left without `finish`, i.e., by an exception, counts as exception.
+class RuleProfileScope
+{
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static thread_local RuleProfileScope* s_current;
+
+    RuleCounters& m_counters;
+    RuleProfileScope* m_parent;
+    Clock::time_point m_start;
+    Clock::duration m_nested_time;
+    bool m_finished;
+
+public:
+    explicit RuleProfileScope(RuleCounters& counters);
+    RuleProfileScope(const RuleProfileScope& other) = delete;
+    RuleProfileScope& operator=(const RuleProfileScope& other) = delete;
+    RuleProfileScope(RuleProfileScope&& other) = delete;
+    RuleProfileScope& operator=(RuleProfileScope&& other) = delete;
+    ~RuleProfileScope();
+
+    /// @brief Records whether the rule matched.
+    void finish(bool success);
+};
+
+/// @brief `RuleProfileScopeStack` measures the invocations of rules that a parser emulates with an explicit stack
+///        instead of invoking them recursively, e.g., the connectives in `NestedFormulaParser`.
+///
+///        The scopes are destroyed in the reverse order of their creation, also if they are left by an exception.
+class RuleProfileScopeStack
+{
+private:
+    // Deque keeps the scopes at their address, which the nested scopes refer to.
+    std::deque<RuleProfileScope> m_scopes;
+
+public:
+    RuleProfileScopeStack();
+    RuleProfileScopeStack(const RuleProfileScopeStack& other) = delete;
+    RuleProfileScopeStack& operator=(const RuleProfileScopeStack& other) = delete;
+    RuleProfileScopeStack(RuleProfileScopeStack&& other) = delete;
+    RuleProfileScopeStack& operator=(RuleProfileScopeStack&& other) = delete;
+    ~RuleProfileScopeStack();
+
+    /// @brief Starts measuring an invocation of the rule with the `counters`.
+    void push(RuleCounters& counters);
+
+    /// @brief Records whether the rule of the innermost scope matched and finishes its measurement.
+    void pop(bool success);
+};
+
+}
+
+#ifdef LOKI_ENABLE_PARSER_PROFILING
+
+/// @brief Same as BOOST_SPIRIT_DEFINE_ but wraps the rule definition in a `RuleProfileScope` of the counters of the identifier of the rule.
+#define LOKI_SPIRIT_DEFINE_(r, data, rule_name)                                                                                            \
+    template<typename Iterator, typename Context>                                                                                          \
+    inline bool parse_rule(decltype(rule_name) /* rule_ */,                                                                                \
+                           Iterator& first,                                                                                                \
+                           Iterator const& last,                                                                                           \
+                           Context const& context,                                                                                         \
+                           decltype(rule_name)::attribute_type& attr)                                                                      \
+    {                                                                                                                                      \
+        using boost::spirit::x3::unused;                                                                                                   \
+        static auto const def_ = (rule_name = BOOST_PP_CAT(rule_name, _def));                                                              \
+        static auto& counters_ = loki::parser::register_rule_counters(BOOST_PP_STRINGIZE(rule_name));                                      \
+        auto scope_ = loki::parser::RuleProfileScope(counters_);                                                                           \
+        const bool success_ = def_.parse(first, last, context, unused, attr);                                                              \
+        scope_.finish(success_);                                                                                                           \
+        return success_;                                                                                                                   \
+    }
+
+#define LOKI_SPIRIT_DEFINE(...) BOOST_PP_SEQ_FOR_EACH(LOKI_SPIRIT_DEFINE_, _, BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__))
+
+#else
+
+#define LOKI_SPIRIT_DEFINE(...) BOOST_SPIRIT_DEFINE(__VA_ARGS__)
+
+#endif
+
+#endif
@@ -37,4 +37,11 @@ SemanticParserError::SemanticParserError(const std::string& message, const std::
 
 NotImplementedError::NotImplementedError(const std::string& message) : std::runtime_error(message) {}
 
+FrozenError::FrozenError(const std::string& message) : std::runtime_error(message) {}
+
+DecompressionError::DecompressionError(const std::string& path_to_file, const std::string& message) :
+    std::runtime_error("Failed to decompress file at "s + path_to_file + ": "s + message)
+{
+}
+
 }
@@ -28,39 +28,29 @@
 #include "loki/details/pddl/parser.hpp"
 #include "loki/details/utils/filesystem.hpp"
 #include "loki/details/utils/memory.hpp"
+#include "loki/details/utils/thread_pool.hpp"
+#include "ast/parser.hpp"
+#include "pddl/parser/error_handling.hpp"
+#include "pddl/parser/structure.hpp"
+#include "pddl/unpacking_visitor.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
 #include <tuple>
 
 namespace loki
 {
 
-DomainParser::DomainParser(const fs::path& filepath, bool strict, bool quiet) :
-    m_filepath(filepath),
-    m_source(loki::read_file(filepath)),
-    m_position_cache(nullptr),
-    m_scopes(nullptr)
+/// @brief Initialize the global scope with the base types and the equality predicate and parse the domain.
+static Domain
+parse_domain(const fs::path& filepath, const ast::Domain& node, Context& context, size_t num_threads, const LazyActionBodyFunction& lazy_action_body = {})
 {
-    const auto start = std::chrono::high_resolution_clock::now();
-    if (!quiet)
-    {
-        std::cout << "Started parsing domain file: " << filepath << std::endl;
-    }
-
-    /* Parse the AST */
-    auto node = ast::Domain();
-    auto x3_error_handler = X3ErrorHandler(m_source.begin(), m_source.end(), filepath);
-    bool success = parse_ast(m_source, domain(), node, x3_error_handler.get_error_handler());
-    if (!success)
-    {
-        throw SyntaxParserError("", x3_error_handler.get_error_stream().str());
-    }
-
-    m_position_cache = std::make_unique<PDDLPositionCache>(x3_error_handler, filepath);
-    m_scopes = std::make_unique<ScopeStack>(m_position_cache->get_error_handler());
-
-    auto context = Context(m_factories, *m_position_cache, *m_scopes, strict, quiet);
     // Initialize global scope
     context.scopes.open_scope();
 
@@ -79,15 +69,66 @@ DomainParser::DomainParser(const fs::path& filepath, bool strict, bool quiet) :
     const auto equal_predicate = context.factories.get_or_create_predicate("=", binary_parameterlist);
     context.scopes.top().insert_predicate("=", equal_predicate, {});
 
-    m_domain = parse(filepath, node, context);
+    const auto domain = parse(filepath, node, context, num_threads, lazy_action_body);
 
     // Only the global scope remains
-    assert(context.scopes.get_stack().size() == 1);
+    assert(context.scopes.size() == 1);
+
+    return domain;
+}
+
+/// @brief Parses the conditions and effects of the lazy actions of a domain parser on first access.
+struct DomainParser::LazyActions
+{
+    // The parser whose factories, positions, scopes and requirements are used. It is updated when the parser is moved.
+    DomainParser* parser;
+    // Serializes the parsing since it creates PDDL objects in the factories of the parser.
+    std::mutex mutex;
+
+    explicit LazyActions(DomainParser* parser_) : parser(parser_), mutex() {}
+
+    std::tuple<std::optional<Condition>, std::optional<Effect>> parse(const ast::Action& node) const
+    {
+        auto scopes = ScopeStack(parser->m_position_cache->get_error_handler(), parser->m_scopes.get());
+        auto context = Context(parser->m_factories, *parser->m_position_cache, scopes, parser->m_options.strict, parser->m_options.quiet);
+        context.requirements = parser->m_domain->get_requirements();
+        scopes.open_scope();
+        return parse_lazy_body(node, context);
+    }
+};
+
+DomainParser::DomainParser(const fs::path& filepath, const DomainParserOptions& options) : DomainParser(filepath, loki::read_file(filepath), options) {}
+
+DomainParser::DomainParser(const fs::path& filepath, bool strict, bool quiet) : DomainParser(filepath, DomainParserOptions { .strict = strict, .quiet = quiet }) {}
+
+DomainParser::DomainParser(const fs::path& filepath, std::string source, const DomainParserOptions& options) :
+    m_filepath(filepath),
+    m_source(),
+    m_options(options),
+    m_position_cache(nullptr),
+    m_scopes(nullptr),
+    m_structures(),
+    m_sections_last(0),
+    m_domain_position(),
+    m_lazy_actions(nullptr)
+{
+    m_options.lazy = options.lazy && !options.strict;
+    if (m_options.lazy)
+    {
+        m_lazy_actions = std::make_unique<LazyActions>(this);
+    }
+    const auto start = std::chrono::high_resolution_clock::now();
+    if (!m_options.quiet)
+    {
+        std::cout << "Started parsing domain file: " << filepath << std::endl;
+    }
+
+    parse(std::move(source));
 
     const auto [vm_usage, resident_set] = process_mem_usage();
     const auto stop = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(stop - start);
-    if (!quiet)
+    if (!m_options.quiet)
     {
         std::cout << "Finished parsing after " << duration.count() << " milliseconds." << std::endl;
         std::cout << "Peak virtual memory: " << vm_usage << " KB." << std::endl;
@@ -95,50 +136,384 @@ DomainParser::DomainParser(const fs::path& filepath, bool strict, bool quiet) :
     }
 }
 
+DomainParser::DomainParser(DomainParser&& other) :
+    m_filepath(std::move(other.m_filepath)),
+    m_source(std::move(other.m_source)),
+    m_options(other.m_options),
+    m_factories(std::move(other.m_factories)),
+    m_position_cache(std::move(other.m_position_cache)),
+    m_scopes(std::move(other.m_scopes)),
+    m_domain(other.m_domain),
+    m_structures(std::move(other.m_structures)),
+    m_sections_last(other.m_sections_last),
+    m_domain_position(other.m_domain_position),
+    m_lazy_actions(std::move(other.m_lazy_actions))
+{
+    if (m_lazy_actions)
+    {
+        m_lazy_actions->parser = this;
+    }
+}
+
+DomainParser& DomainParser::operator=(DomainParser&& other)
+{
+    if (this != &other)
+    {
+        m_filepath = std::move(other.m_filepath);
+        m_source = std::move(other.m_source);
+        m_options = other.m_options;
+        m_factories = std::move(other.m_factories);
+        m_position_cache = std::move(other.m_position_cache);
+        m_scopes = std::move(other.m_scopes);
+        m_domain = other.m_domain;
+        m_structures = std::move(other.m_structures);
+        m_sections_last = other.m_sections_last;
+        m_domain_position = other.m_domain_position;
+        m_lazy_actions = std::move(other.m_lazy_actions);
+        if (m_lazy_actions)
+        {
+            m_lazy_actions->parser = this;
+        }
+    }
+    return *this;
+}
+
+DomainParser::~DomainParser() = default;
+
+void DomainParser::parse(std::string source)
+{
+    /* Parse the AST */
+    // The AST is shared with the lazy actions that parse their conditions and effects from it on first access.
+    const auto domain_node = std::make_shared<ast::Domain>();
+    auto& node = *domain_node;
+    auto x3_error_handler = X3ErrorHandler(source.cbegin(), source.cend(), m_filepath);
+    bool success = parse_ast(source, domain(), node, x3_error_handler.get_error_handler());
+    if (!success)
+    {
+        throw SyntaxParserError("", x3_error_handler.get_error_stream().str());
+    }
+
+    auto position_cache = std::make_unique<PDDLPositionCache>(x3_error_handler, m_filepath, 4, m_options.first_occurrence_only);
+    auto scopes = std::make_unique<ScopeStack>(position_cache->get_error_handler());
+
+    auto context = Context(m_factories, *position_cache, *scopes, m_options.strict, m_options.quiet);
+    auto lazy_action_body = LazyActionBodyFunction();
+    if (m_lazy_actions)
+    {
+        lazy_action_body = [lazy_actions = m_lazy_actions.get(), domain_node](const ast::Action& action_node)
+        {
+            return std::make_unique<LazyActionBody>([lazy_actions, domain_node, &action_node](const ActionImpl&) { return lazy_actions->parse(action_node); },
+                                                    lazy_actions->mutex);
+        };
+    }
+    m_domain = parse_domain(m_filepath, node, context, m_options.num_threads, lazy_action_body);
+
+    // Moving the string keeps its buffer, hence, the iterators of the error handler remain valid.
+    m_source = std::move(source);
+    m_position_cache = std::move(position_cache);
+    m_scopes = std::move(scopes);
+
+    /* Locate the structures */
+    const auto& error_handler = m_position_cache->get_error_handler();
+    m_sections_last = error_handler.get_source_position(node.domain_name).last;
+    const auto locate_section = [&](const auto& section)
+    {
+        if (section.has_value())
+        {
+            m_sections_last = std::max(m_sections_last, static_cast<size_t>(error_handler.get_source_position(section.value()).last));
+        }
+    };
+    locate_section(node.requirements);
+    locate_section(node.types);
+    locate_section(node.constants);
+    locate_section(node.predicates);
+    locate_section(node.functions);
+    locate_section(node.constraints);
+    m_structures.clear();
+    m_structures.reserve(node.structures.size());
+    for (const auto& structure_node : node.structures)
+    {
+        const auto position = error_handler.get_source_position(structure_node);
+        m_structures.push_back(StructureLocation { position.first, position.last, structure_node.get().which() == 0 });
+    }
+    m_domain_position = error_handler.get_source_position(node);
+
+    // The lazy actions parse from the AST, hence, they release the matched positions after they were materialized.
+    if (!m_lazy_actions)
+    {
+        m_position_cache->get_mutable_error_handler().release_positions();
+        m_position_cache->shrink_to_fit();
+    }
+}
+
+bool DomainParser::reparse_structure(size_t first, size_t last, const std::string& text)
+{
+    // Find the structure whose byte range, extended by the whitespace around it, encloses the edit.
+    const auto it = std::partition_point(m_structures.begin(), m_structures.end(), [first](const auto& location) { return location.last < first; });
+    if (it == m_structures.end())
+    {
+        return false;
+    }
+    const auto index = static_cast<size_t>(it - m_structures.begin());
+    const auto region_first = (index == 0) ? m_sections_last : m_structures[index - 1].last;
+    // The source ends with the closing parenthesis of the domain, followed by whitespace.
+    const auto region_last = (index + 1 < m_structures.size()) ? m_structures[index + 1].first : m_domain_position.last - 1;
+    if (first < region_first || last > region_last)
+    {
+        return false;
+    }
+
+    auto source = std::string();
+    source.reserve(m_source.size() - (last - first) + text.size());
+    source.append(m_source, 0, first).append(text).append(m_source, last);
+    const auto delta = static_cast<std::ptrdiff_t>(text.size()) - static_cast<std::ptrdiff_t>(last - first);
+
+    // The edited structure is matched with a separate error handler whose source positions refer to the edited source.
+    auto x3_error_handler = std::make_unique<X3ErrorHandler>(source.cbegin(), source.cend(), m_filepath);
+
+    /* Parse the AST of the edited structure */
+    auto node = ast::Structure();
+    auto iter = source.cbegin() + region_first;
+    const auto end = source.cbegin() + (region_last + delta);
+    try
+    {
+        if (!parse_ast(iter, end, structure(), node, x3_error_handler->get_error_handler()) || iter != end)
+        {
+            return false;
+        }
+    }
+    catch (const x3::expectation_failure<iterator_type>&)
+    {
+        // The syntax error is reported by parsing the whole source.
+        return false;
+    }
+
+    /* Parse the edited structure */
+    auto structure_positions = PDDLPositionCache(*x3_error_handler, m_filepath, 4, m_options.first_occurrence_only);
+    auto scopes = ScopeStack(structure_positions.get_error_handler(), m_scopes.get());
+    auto context = Context(m_factories, structure_positions, scopes, m_options.strict, m_options.quiet);
+    context.requirements = m_domain->get_requirements();
+    scopes.open_scope();
+    const auto structure_variant = loki::parse(node, context);
+
+    auto actions = ActionList();
+    auto axioms = AxiomList();
+    auto action_it = m_domain->get_actions().begin();
+    auto axiom_it = m_domain->get_axioms().begin();
+    for (size_t i = 0; i < m_structures.size(); ++i)
+    {
+        if (i == index)
+        {
+            boost::apply_visitor(UnpackingVisitor(actions, axioms), structure_variant);
+        }
+        else if (m_structures[i].is_action)
+        {
+            actions.push_back(*action_it);
+        }
+        else
+        {
+            axioms.push_back(*axiom_it);
+        }
+        // Advance past the action or axiom of the structure in the previous domain.
+        if (m_structures[i].is_action)
+        {
+            ++action_it;
+        }
+        else
+        {
+            ++axiom_it;
+        }
+    }
+    const auto domain = m_factories.get_or_create_domain(m_filepath,
+                                                         m_domain->get_name(),
+                                                         m_domain->get_requirements(),
+                                                         m_domain->get_types(),
+                                                         m_domain->get_constants(),
+                                                         m_domain->get_predicates(),
+                                                         m_domain->get_functions(),
+                                                         actions,
+                                                         axioms);
+
+    /* Update the parser */
+    auto& location = m_structures[index];
+    // Replace the positions of the previous structure by those of the edited structure and shift the positions after the edit.
+    // A position that ends inside the edit is moved to its start.
+    const auto get_edited_offset = [first, last, delta](uint32_t offset, bool is_range_end)
+    {
+        if (offset < first || (is_range_end && offset == first))
+        {
+            return offset;
+        }
+        if (offset < last || (is_range_end && offset == last))
+        {
+            return static_cast<uint32_t>(first);
+        }
+        return static_cast<uint32_t>(offset + delta);
+    };
+    const auto get_edited_position = [&get_edited_offset](const SourcePosition& position)
+    { return SourcePosition { get_edited_offset(position.first, false), get_edited_offset(position.last, true) }; };
+    m_position_cache->erase_if([&location](const SourcePosition& position) { return location.first <= position.first && position.first < location.last; });
+    m_position_cache->transform(get_edited_position);
+    m_position_cache->append(structure_positions);
+    m_domain_position = get_edited_position(m_domain_position);
+    m_position_cache->push_back(domain, m_domain_position);
+    // The error handler refers to the edited source. Swapping the strings keeps their buffers, hence, its iterators remain valid.
+    m_position_cache->get_mutable_error_handler().set_input(source.cbegin(), source.cend());
+    m_source.swap(source);
+    const auto position = structure_positions.get_error_handler().get_source_position(node);
+    location = StructureLocation { position.first, position.last, node.get().which() == 0 };
+    for (size_t i = index + 1; i < m_structures.size(); ++i)
+    {
+        m_structures[i].first += delta;
+        m_structures[i].last += delta;
+    }
+    m_domain = domain;
+    return true;
+}
+
 PDDLFactories& DomainParser::get_factories() { return m_factories; }
 
+const PDDLFactories& DomainParser::get_factories() const { return m_factories; }
+
 const PDDLPositionCache& DomainParser::get_position_cache() const { return *m_position_cache; }
 
 const Domain& DomainParser::get_domain() const { return m_domain; }
 
-ProblemParser::ProblemParser(const fs::path& filepath, DomainParser& domain_parser, bool strict, bool quiet) :
-    m_filepath(filepath),
-    m_source(loki::read_file(filepath)),
-    m_position_cache(nullptr),
-    m_scopes(nullptr)
+const std::string& DomainParser::get_source() const { return m_source; }
+
+void DomainParser::reparse(size_t first, size_t last, std::string_view text)
 {
-    const auto start = std::chrono::high_resolution_clock::now();
+    if (first > last || last > m_source.size())
+    {
+        throw std::out_of_range("DomainParser::reparse: the byte range [" + std::to_string(first) + ", " + std::to_string(last)
+                                + ") exceeds the source of size " + std::to_string(m_source.size()) + ".");
+    }
+    const auto normalized_text = normalize_text(text);
+    // The lazy actions of the current domain refer to the matched positions of the current source.
+    materialize();
+    if (m_options.strict || !reparse_structure(first, last, normalized_text))
+    {
+        auto source = std::string();
+        source.reserve(m_source.size() - (last - first) + normalized_text.size());
+        source.append(m_source, 0, first).append(normalized_text).append(m_source, last);
+        parse(std::move(source));
+    }
+}
+
+void DomainParser::materialize() const
+{
+    if (m_lazy_actions)
+    {
+        for (const auto& action : m_domain->get_actions())
+        {
+            action->materialize();
+        }
+        // The positions that were matched in the AST are only needed to parse the lazy actions.
+        std::lock_guard<std::mutex> lock(m_lazy_actions->mutex);
+        m_position_cache->get_mutable_error_handler().release_positions();
+    }
+}
+
+void DomainParser::freeze(bool shrink_to_fit)
+{
+    materialize();
+    m_factories.freeze(shrink_to_fit);
+    if (shrink_to_fit)
+    {
+        m_position_cache->shrink_to_fit();
+    }
+}
+
+/// @brief The result of reading and syntactically parsing a problem file, which does not depend on the domain.
+struct ProblemParser::ProblemAST
+{
+    std::chrono::high_resolution_clock::time_point start;
+    std::string source;
+    ast::Problem node;
+    std::unique_ptr<X3ErrorHandler> x3_error_handler;
+};
+
+std::unique_ptr<ProblemParser::ProblemAST> ProblemParser::parse_problem_ast(const fs::path& filepath, bool quiet)
+{
+    auto result = std::make_unique<ProblemAST>();
+    result->start = std::chrono::high_resolution_clock::now();
     if (!quiet)
     {
         std::cout << "Started parsing problem file: " << filepath << std::endl;
     }
 
     /* Parse the AST */
-    auto problem_node = ast::Problem();
-    auto x3_error_handler = X3ErrorHandler(m_source.begin(), m_source.end(), filepath);
-    bool success = parse_ast(m_source, problem(), problem_node, x3_error_handler.get_error_handler());
+    result->source = loki::read_file(filepath);
+    result->x3_error_handler = std::make_unique<X3ErrorHandler>(result->source.begin(), result->source.end(), filepath);
+    bool success = parse_ast(result->source, problem(), result->node, result->x3_error_handler->get_error_handler());
     if (!success)
     {
-        throw SyntaxParserError("", x3_error_handler.get_error_stream().str());
+        throw SyntaxParserError("", result->x3_error_handler->get_error_stream().str());
     }
+    return result;
+}
+
+ProblemParser::ProblemParser(const fs::path& filepath, DomainParser& domain_parser, const ProblemParserOptions& options) :
+    m_filepath(filepath),
+    m_source(),
+    m_own_factories(nullptr),
+    m_factories(&domain_parser.m_factories),
+    m_position_cache(nullptr),
+    m_scopes(nullptr)
+{
+    parse(domain_parser, *parse_problem_ast(filepath, options.quiet), options);
+}
+
+ProblemParser::ProblemParser(const fs::path& filepath, DomainParser& domain_parser, bool strict, bool quiet) :
+    ProblemParser(filepath, domain_parser, ProblemParserOptions { .strict = strict, .quiet = quiet })
+{
+}
+
+ProblemParser::ProblemParser(std::unique_ptr<ProblemAST> problem_ast,
+                             const fs::path& filepath,
+                             const DomainParser& domain_parser,
+                             std::unique_ptr<PDDLFactories> own_factories,
+                             const ProblemParserOptions& options) :
+    m_filepath(filepath),
+    m_source(),
+    m_own_factories(std::move(own_factories)),
+    m_factories(m_own_factories.get()),
+    m_position_cache(nullptr),
+    m_scopes(nullptr)
+{
+    parse(domain_parser, *problem_ast, options);
+}
 
-    m_position_cache = std::make_unique<PDDLPositionCache>(x3_error_handler, filepath);
+void ProblemParser::parse(const DomainParser& domain_parser, ProblemAST& problem_ast, const ProblemParserOptions& options)
+{
+    const auto& filepath = m_filepath;
+    // We need to keep the source in memory for error reporting.
+    // Moving the string keeps its buffer, hence, the iterators of the error handler remain valid.
+    m_source = std::move(problem_ast.source);
+
+    m_position_cache = std::make_unique<PDDLPositionCache>(*problem_ast.x3_error_handler, filepath, 4, options.first_occurrence_only);
+    m_position_cache->set_index_offsets(*m_factories);
     m_scopes = std::make_unique<ScopeStack>(m_position_cache->get_error_handler(), domain_parser.m_scopes.get());
 
-    auto context = Context(domain_parser.m_factories, *m_position_cache, *m_scopes, strict, quiet);
+    auto context = Context(*m_factories, *m_position_cache, *m_scopes, options.strict, options.quiet);
 
     // Initialize global scope
     context.scopes.open_scope();
 
-    m_problem = parse(filepath, problem_node, context, domain_parser.get_domain());
+    m_problem = loki::parse(filepath, problem_ast.node, context, domain_parser.get_domain(), options.num_threads);
 
     // Only the global scope remains
-    assert(context.scopes.get_stack().size() == 1);
+    assert(context.scopes.size() == 1);
+
+    // The positions are stored as byte offsets, hence, the matched positions of the AST are not needed anymore.
+    // Releasing them first leaves room for shrinking the storages of the positions.
+    m_position_cache->get_mutable_error_handler().release_positions();
+    m_position_cache->shrink_to_fit();
 
     const auto [vm_usage, resident_set] = process_mem_usage();
     const auto stop = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(stop - start);
-    if (!quiet)
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(stop - problem_ast.start);
+    if (!options.quiet)
     {
         std::cout << "Finished parsing after " << duration.count() << " milliseconds." << std::endl;
         std::cout << "Peak virtual memory: " << vm_usage << " KB." << std::endl;
@@ -146,8 +521,189 @@ ProblemParser::ProblemParser(const fs::path& filepath, DomainParser& domain_pars
     }
 }
 
+PDDLFactories& ProblemParser::get_factories() { return *m_factories; }
+
 const PDDLPositionCache& ProblemParser::get_position_cache() const { return *m_position_cache; }
 
 const Problem& ProblemParser::get_problem() const { return m_problem; }
 
-}
\ No newline at end of file
+void ProblemParser::freeze(bool shrink_to_fit)
+{
+    m_factories->freeze(shrink_to_fit);
+    if (shrink_to_fit)
+    {
+        m_position_cache->shrink_to_fit();
+    }
+}
+
+ProblemParser parse_problem(const fs::path& file_path, const DomainParser& domain_parser, const ProblemParserOptions& options)
+{
+    // The factories of the problem continue the indices of the factories of the domain, which must not grow afterwards.
+    domain_parser.materialize();
+    return ProblemParser(ProblemParser::parse_problem_ast(file_path, options.quiet),
+                         file_path,
+                         domain_parser,
+                         std::make_unique<PDDLFactories>(&domain_parser.get_factories()),
+                         options);
+}
+
+std::vector<ProblemParser> parse_problems(const std::vector<fs::path>& file_paths,
+                                          const DomainParser& domain_parser,
+                                          size_t num_threads,
+                                          const ProblemParserOptions& options)
+{
+    // The problem files are already parsed concurrently, hence, we parse the initial elements sequentially.
+    auto problem_options = options;
+    problem_options.num_threads = 1;
+    auto futures = std::vector<std::future<ProblemParser>>();
+    futures.reserve(file_paths.size());
+    {
+        auto thread_pool = ThreadPool(num_threads);
+        for (const auto& file_path : file_paths)
+        {
+            futures.push_back(thread_pool.submit(
+                [&file_path, &domain_parser, &problem_options] { return parse_problem(file_path, domain_parser, problem_options); }));
+        }
+        // The destructor of the thread pool waits until all problems are parsed.
+    }
+
+    auto problem_parsers = std::vector<ProblemParser>();
+    problem_parsers.reserve(file_paths.size());
+    for (auto& future : futures)
+    {
+        problem_parsers.push_back(future.get());
+    }
+    return problem_parsers;
+}
+
+AsyncParser::AsyncParser(const fs::path& domain_file_path,
+                         size_t num_threads,
+                         const DomainParserOptions& domain_options,
+                         const ProblemParserOptions& problem_options) :
+    m_problem_options(problem_options),
+    m_io_thread(1),
+    m_workers(num_threads),
+    m_domain()
+{
+    // The problem files are already parsed concurrently, hence, we parse the initial elements sequentially.
+    m_problem_options.num_threads = 1;
+    m_domain = m_workers
+                   .submit([domain_file_path, domain_options]
+                           { return std::shared_ptr<const DomainParser>(std::make_shared<DomainParser>(domain_file_path, domain_options)); })
+                   .share();
+}
+
+const std::shared_future<std::shared_ptr<const DomainParser>>& AsyncParser::get_domain() const { return m_domain; }
+
+std::future<ProblemParser> AsyncParser::parse_problem(const fs::path& problem_file_path)
+{
+    auto problem_ast = m_io_thread.submit([problem_file_path, quiet = m_problem_options.quiet] { return ProblemParser::parse_problem_ast(problem_file_path, quiet); });
+    return m_workers.submit(
+        [problem_ast = std::move(problem_ast), problem_file_path, domain = m_domain, options = m_problem_options]() mutable
+        {
+            const auto& domain_parser = *domain.get();
+            // The factories of the problem continue the indices of the factories of the domain, which must not grow afterwards.
+            domain_parser.materialize();
+            return ProblemParser(problem_ast.get(), problem_file_path, domain_parser, std::make_unique<PDDLFactories>(&domain_parser.get_factories()), options);
+        });
+}
+
+Validator::Validator(const DomainParserOptions& domain_options, const ProblemParserOptions& problem_options) :
+    m_domain_options(domain_options),
+    m_problem_options(problem_options),
+    m_source(),
+    m_domain_factories(),
+    m_problem_factories(nullptr)
+{
+}
+
+void Validator::validate_domain(const fs::path& file_path) { validate_domain(file_path, nullptr); }
+
+void Validator::validate_problem(const fs::path& file_path, const DomainParser& domain_parser) { validate_problem(file_path, domain_parser, nullptr); }
+
+/// @brief Record the exception that stopped the validation in the `diagnostics`.
+template<typename ValidateFunction>
+static void diagnose(DiagnosticSink& diagnostics, const ValidateFunction& validate_function)
+{
+    try
+    {
+        validate_function();
+    }
+    catch (const SkipStructureSignal&)
+    {
+        // The error was recorded but there was no enclosing structure to skip.
+    }
+    catch (const DiagnosticLimitSignal&)
+    {
+        // The sink is full.
+    }
+    catch (const std::runtime_error& error)
+    {
+        diagnostics.add(Diagnostic { DiagnosticSeverityEnum::ERROR, 0, 0, error.what() });
+    }
+}
+
+void Validator::diagnose_domain(const fs::path& file_path, DiagnosticSink& diagnostics)
+{
+    diagnose(diagnostics, [&] { validate_domain(file_path, &diagnostics); });
+}
+
+void Validator::diagnose_problem(const fs::path& file_path, const DomainParser& domain_parser, DiagnosticSink& diagnostics)
+{
+    diagnose(diagnostics, [&] { validate_problem(file_path, domain_parser, &diagnostics); });
+}
+
+void Validator::validate_domain(const fs::path& file_path, DiagnosticSink* diagnostics)
+{
+    read_file(file_path, m_source);
+
+    /* Parse the AST */
+    auto node = ast::Domain();
+    auto x3_error_handler = X3ErrorHandler(m_source.begin(), m_source.end(), file_path);
+    bool success = parse_ast(m_source, domain(), node, x3_error_handler.get_error_handler());
+    if (!success)
+    {
+        throw SyntaxParserError("", x3_error_handler.get_error_stream().str());
+    }
+
+    m_domain_factories.clear();
+    auto position_cache = PDDLPositionCache(x3_error_handler, file_path, 4, true);
+    auto scopes = ScopeStack(position_cache.get_error_handler());
+    auto context = Context(m_domain_factories, position_cache, scopes, m_domain_options.strict, true, diagnostics);
+    parse_domain(file_path, node, context, m_domain_options.num_threads);
+}
+
+void Validator::validate_problem(const fs::path& file_path, const DomainParser& domain_parser, DiagnosticSink* diagnostics)
+{
+    read_file(file_path, m_source);
+
+    /* Parse the AST */
+    auto node = ast::Problem();
+    auto x3_error_handler = X3ErrorHandler(m_source.begin(), m_source.end(), file_path);
+    bool success = parse_ast(m_source, problem(), node, x3_error_handler.get_error_handler());
+    if (!success)
+    {
+        throw SyntaxParserError("", x3_error_handler.get_error_stream().str());
+    }
+
+    domain_parser.materialize();
+    if (!m_problem_factories || m_problem_factories->get_parent() != &domain_parser.get_factories())
+    {
+        m_problem_factories = std::make_unique<PDDLFactories>(&domain_parser.get_factories());
+    }
+    m_problem_factories->clear();
+    auto position_cache = PDDLPositionCache(x3_error_handler, file_path, 4, true);
+    position_cache.set_index_offsets(*m_problem_factories);
+    auto scopes = ScopeStack(position_cache.get_error_handler(), domain_parser.m_scopes.get());
+    auto context = Context(*m_problem_factories, position_cache, scopes, m_problem_options.strict, true, diagnostics);
+
+    // Initialize global scope
+    context.scopes.open_scope();
+
+    parse(file_path, node, context, domain_parser.get_domain(), m_problem_options.num_threads);
+
+    // Only the global scope remains
+    assert(context.scopes.size() == 1);
+}
+
+}
@@ -24,32 +24,73 @@
 
 namespace loki
 {
+LazyActionBody::LazyActionBody(ParseFunction parse, std::mutex& mutex) : m_parse(std::move(parse)), m_mutex(mutex), m_is_materialized(false) {}
+
+void LazyActionBody::materialize(const ActionImpl& action)
+{
+    if (m_is_materialized.load(std::memory_order_acquire))
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_is_materialized.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    std::tie(action.m_condition, action.m_effect) = m_parse(action);
+    // Release the resources of the parse function, e.g., references to the AST.
+    m_parse = nullptr;
+    m_is_materialized.store(true, std::memory_order_release);
+}
+
+bool LazyActionBody::is_materialized() const { return m_is_materialized.load(std::memory_order_acquire); }
+
 ActionImpl::ActionImpl(size_t index,
-                       std::string name,
+                       std::string_view name,
                        size_t original_arity,
                        ParameterList parameters,
                        std::optional<Condition> condition,
-                       std::optional<Effect> effect) :
+                       std::optional<Effect> effect,
+                       std::unique_ptr<LazyActionBody> lazy_body) :
     m_index(index),
-    m_name(std::move(name)),
+    m_name(name),
     m_original_arity(original_arity),
     m_parameters(std::move(parameters)),
     m_condition(std::move(condition)),
-    m_effect(std::move(effect))
+    m_effect(std::move(effect)),
+    m_lazy_body(std::move(lazy_body))
 {
 }
 
 size_t ActionImpl::get_index() const { return m_index; }
 
-const std::string& ActionImpl::get_name() const { return m_name; }
+std::string_view ActionImpl::get_name() const { return m_name; }
 
 size_t ActionImpl::get_original_arity() const { return m_original_arity; }
 
 const ParameterList& ActionImpl::get_parameters() const { return m_parameters; }
 
-const std::optional<Condition>& ActionImpl::get_condition() const { return m_condition; }
+const std::optional<Condition>& ActionImpl::get_condition() const
+{
+    materialize();
+    return m_condition;
+}
 
-const std::optional<Effect>& ActionImpl::get_effect() const { return m_effect; }
+const std::optional<Effect>& ActionImpl::get_effect() const
+{
+    materialize();
+    return m_effect;
+}
+
+bool ActionImpl::is_lazy() const { return m_lazy_body != nullptr; }
+
+void ActionImpl::materialize() const
+{
+    if (m_lazy_body)
+    {
+        m_lazy_body->materialize(*this);
+    }
+}
 
 std::ostream& operator<<(std::ostream& out, const ActionImpl& element)
 {
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "loki/details/pddl/atom_index.hpp"
+
+#include "loki/details/pddl/atom.hpp"
+#include "loki/details/pddl/predicate.hpp"
+
+#include <algorithm>
+
+namespace loki
+{
+AtomIndex::AtomIndex() : m_atoms(), m_offsets(), m_contained() {}
+
+AtomIndex::AtomIndex(const AtomList& atoms) : m_atoms(atoms), m_offsets(), m_contained()
+{
+    // Group by predicate, and remove duplicates that occur if an atom is listed multiple times.
+    std::sort(m_atoms.begin(),
+              m_atoms.end(),
+              [](const Atom& lhs, const Atom& rhs)
+              {
+                  return std::make_pair(lhs->get_predicate()->get_index(), lhs->get_index())
+                         < std::make_pair(rhs->get_predicate()->get_index(), rhs->get_index());
+              });
+    m_atoms.erase(std::unique(m_atoms.begin(), m_atoms.end()), m_atoms.end());
+
+    if (m_atoms.empty())
+    {
+        return;
+    }
+
+    // Count atoms per predicate, then compute the prefix sums.
+    size_t max_atom_index = 0;
+    m_offsets.resize(m_atoms.back()->get_predicate()->get_index() + 2, 0);
+    for (const auto& atom : m_atoms)
+    {
+        ++m_offsets[atom->get_predicate()->get_index() + 1];
+        max_atom_index = std::max(max_atom_index, atom->get_index());
+    }
+    for (size_t i = 1; i < m_offsets.size(); ++i)
+    {
+        m_offsets[i] += m_offsets[i - 1];
+    }
+
+    m_contained.resize(max_atom_index + 1, false);
+    for (const auto& atom : m_atoms)
+    {
+        m_contained[atom->get_index()] = true;
+    }
+}
+
+bool AtomIndex::contains(const Atom& atom) const
+{
+    const auto index = atom->get_index();
+    return index < m_contained.size() && m_contained[index];
+}
+
+std::span<const Atom> AtomIndex::get_atoms(const Predicate& predicate) const
+{
+    const auto index = predicate->get_index();
+    if (index + 1 >= m_offsets.size())
+    {
+        return {};
+    }
+    return std::span<const Atom>(m_atoms.data() + m_offsets[index], m_offsets[index + 1] - m_offsets[index]);
+}
+
+const AtomList& AtomIndex::get_atoms() const { return m_atoms; }
+
+size_t AtomIndex::size() const { return m_atoms.size(); }
+
+}
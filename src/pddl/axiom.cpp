@@ -26,9 +26,9 @@
 
 namespace loki
 {
-AxiomImpl::AxiomImpl(size_t index, std::string derived_predicate_name, ParameterList parameters, Condition condition, size_t num_parameters_to_ground_head) :
+AxiomImpl::AxiomImpl(size_t index, std::string_view derived_predicate_name, ParameterList parameters, Condition condition, size_t num_parameters_to_ground_head) :
     m_index(index),
-    m_derived_predicate_name(std::move(derived_predicate_name)),
+    m_derived_predicate_name(derived_predicate_name),
     m_parameters(std::move(parameters)),
     m_condition(std::move(condition)),
     m_num_parameters_to_ground_head(num_parameters_to_ground_head)
@@ -37,7 +37,7 @@ AxiomImpl::AxiomImpl(size_t index, std::string derived_predicate_name, Parameter
 
 size_t AxiomImpl::get_index() const { return m_index; }
 
-const std::string& AxiomImpl::get_derived_predicate_name() const { return m_derived_predicate_name; }
+std::string_view AxiomImpl::get_derived_predicate_name() const { return m_derived_predicate_name; }
 
 const Condition& AxiomImpl::get_condition() const { return m_condition; }
 
@@ -143,7 +143,7 @@ std::ostream& operator<<(std::ostream& out, const ConditionForallImpl& element)
     return out;
 }
 
-std::ostream& operator<<(std::ostream& out, const ConditionImpl& element)
+std::ostream& operator<<(std::ostream& out, const Condition& element)
 {
     auto formatter = PDDLFormatter();
     formatter.write(element, out);
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "loki/details/pddl/diagnostics.hpp"
+
+#include <cassert>
+#include <unordered_map>
+
+namespace loki
+{
+
+static std::unordered_map<DiagnosticSeverityEnum, std::string> diagnostic_severity_enum_to_string = {
+    { DiagnosticSeverityEnum::ERROR, "error" },
+    { DiagnosticSeverityEnum::WARNING, "warning" },
+};
+
+const std::string& to_string(DiagnosticSeverityEnum severity)
+{
+    assert(diagnostic_severity_enum_to_string.count(severity));
+    return diagnostic_severity_enum_to_string.at(severity);
+}
+
+DiagnosticSink::DiagnosticSink(size_t max_num_diagnostics) : m_max_num_diagnostics(max_num_diagnostics), m_diagnostics(), m_num_errors(0), m_truncated(false) {}
+
+bool DiagnosticSink::add(Diagnostic diagnostic)
+{
+    if (is_full())
+    {
+        m_truncated = true;
+        return false;
+    }
+    if (diagnostic.severity == DiagnosticSeverityEnum::ERROR)
+    {
+        ++m_num_errors;
+    }
+    m_diagnostics.push_back(std::move(diagnostic));
+    return true;
+}
+
+void DiagnosticSink::clear()
+{
+    m_diagnostics.clear();
+    m_num_errors = 0;
+    m_truncated = false;
+}
+
+bool DiagnosticSink::is_full() const { return m_diagnostics.size() >= m_max_num_diagnostics; }
+
+bool DiagnosticSink::has_errors() const { return m_num_errors > 0; }
+
+size_t DiagnosticSink::get_max_num_diagnostics() const { return m_max_num_diagnostics; }
+
+const std::vector<Diagnostic>& DiagnosticSink::get_diagnostics() const { return m_diagnostics; }
+
+size_t DiagnosticSink::get_num_errors() const { return m_num_errors; }
+
+size_t DiagnosticSink::get_num_warnings() const { return m_diagnostics.size() - m_num_errors; }
+
+bool DiagnosticSink::is_truncated() const { return m_truncated; }
+
+std::ostream& operator<<(std::ostream& out, const Diagnostic& diagnostic)
+{
+    out << to_string(diagnostic.severity) << " at line " << diagnostic.line << ", column " << diagnostic.column << ": " << diagnostic.message;
+    return out;
+}
+
+}
@@ -51,7 +51,12 @@ DomainImpl::DomainImpl(size_t index,
     m_predicates(std::move(predicates)),
     m_functions(std::move(functions)),
     m_actions(std::move(actions)),
-    m_axioms(std::move(axioms))
+    m_axioms(std::move(axioms)),
+    m_types_by_name(m_types),
+    m_constants_by_name(m_constants),
+    m_predicates_by_name(m_predicates),
+    m_functions_by_name(m_functions),
+    m_actions_by_name(m_actions)
 {
 }
 
@@ -75,6 +80,16 @@ const ActionList& DomainImpl::get_actions() const { return m_actions; }
 
 const AxiomList& DomainImpl::get_axioms() const { return m_axioms; }
 
+std::optional<Type> DomainImpl::find_type(std::string_view name) const { return m_types_by_name.find(name); }
+
+std::optional<Object> DomainImpl::find_constant(std::string_view name) const { return m_constants_by_name.find(name); }
+
+std::optional<Predicate> DomainImpl::find_predicate(std::string_view name) const { return m_predicates_by_name.find(name); }
+
+std::optional<FunctionSkeleton> DomainImpl::find_function_skeleton(std::string_view name) const { return m_functions_by_name.find(name); }
+
+std::optional<Action> DomainImpl::find_action(std::string_view name) const { return m_actions_by_name.find(name); }
+
 std::ostream& operator<<(std::ostream& out, const DomainImpl& element)
 {
     auto formatter = PDDLFormatter();
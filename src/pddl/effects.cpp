@@ -134,7 +134,7 @@ std::ostream& operator<<(std::ostream& out, const EffectConditionalWhenImpl& ele
     return out;
 }
 
-std::ostream& operator<<(std::ostream& out, const EffectImpl& element)
+std::ostream& operator<<(std::ostream& out, const Effect& element)
 {
     auto formatter = PDDLFormatter();
     formatter.write(element, out);
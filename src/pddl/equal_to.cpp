@@ -45,6 +45,10 @@ namespace loki
 {
 bool UniquePDDLEqualTo<const ActionImpl*>::operator()(const ActionImpl* l, const ActionImpl* r) const
 {
+    if (l->is_lazy() || r->is_lazy())
+    {
+        return l == r;
+    }
     if (&l != &r)
     {
         return (l->get_name() == r->get_name()) && (get_sorted_vector(l->get_parameters()) == get_sorted_vector(r->get_parameters()))
@@ -72,74 +76,69 @@ bool UniquePDDLEqualTo<const AxiomImpl*>::operator()(const AxiomImpl* l, const A
     return true;
 }
 
-bool UniquePDDLEqualTo<const ConditionLiteralImpl&>::operator()(const ConditionLiteralImpl& l, const ConditionLiteralImpl& r) const
+bool UniquePDDLEqualTo<const ConditionLiteralImpl*>::operator()(const ConditionLiteralImpl* l, const ConditionLiteralImpl* r) const
 {
     if (&l != &r)
     {
-        return (l.get_literal() == r.get_literal());
+        return (l->get_literal() == r->get_literal());
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const ConditionAndImpl&>::operator()(const ConditionAndImpl& l, const ConditionAndImpl& r) const
+bool UniquePDDLEqualTo<const ConditionAndImpl*>::operator()(const ConditionAndImpl* l, const ConditionAndImpl* r) const
 {
     if (&l != &r)
     {
-        return (get_sorted_vector(l.get_conditions()) == get_sorted_vector(r.get_conditions()));
+        return (get_sorted_vector(l->get_conditions()) == get_sorted_vector(r->get_conditions()));
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const ConditionOrImpl&>::operator()(const ConditionOrImpl& l, const ConditionOrImpl& r) const
+bool UniquePDDLEqualTo<const ConditionOrImpl*>::operator()(const ConditionOrImpl* l, const ConditionOrImpl* r) const
 {
     if (&l != &r)
     {
-        return (get_sorted_vector(l.get_conditions()) == get_sorted_vector(r.get_conditions()));
+        return (get_sorted_vector(l->get_conditions()) == get_sorted_vector(r->get_conditions()));
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const ConditionNotImpl&>::operator()(const ConditionNotImpl& l, const ConditionNotImpl& r) const
+bool UniquePDDLEqualTo<const ConditionNotImpl*>::operator()(const ConditionNotImpl* l, const ConditionNotImpl* r) const
 {
     if (&l != &r)
     {
-        return (l.get_condition() == r.get_condition());
+        return (l->get_condition() == r->get_condition());
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const ConditionImplyImpl&>::operator()(const ConditionImplyImpl& l, const ConditionImplyImpl& r) const
+bool UniquePDDLEqualTo<const ConditionImplyImpl*>::operator()(const ConditionImplyImpl* l, const ConditionImplyImpl* r) const
 {
     if (&l != &r)
     {
-        return (l.get_condition_left() == r.get_condition_left()) && (l.get_condition_left() == r.get_condition_left());
+        return (l->get_condition_left() == r->get_condition_left()) && (l->get_condition_left() == r->get_condition_left());
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const ConditionExistsImpl&>::operator()(const ConditionExistsImpl& l, const ConditionExistsImpl& r) const
+bool UniquePDDLEqualTo<const ConditionExistsImpl*>::operator()(const ConditionExistsImpl* l, const ConditionExistsImpl* r) const
 {
     if (&l != &r)
     {
-        return (l.get_condition() == r.get_condition()) && (get_sorted_vector(l.get_parameters()) == get_sorted_vector(r.get_parameters()));
+        return (l->get_condition() == r->get_condition()) && (get_sorted_vector(l->get_parameters()) == get_sorted_vector(r->get_parameters()));
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const ConditionForallImpl&>::operator()(const ConditionForallImpl& l, const ConditionForallImpl& r) const
+bool UniquePDDLEqualTo<const ConditionForallImpl*>::operator()(const ConditionForallImpl* l, const ConditionForallImpl* r) const
 {
     if (&l != &r)
     {
-        return (l.get_condition() == r.get_condition()) && (get_sorted_vector(l.get_parameters()) == get_sorted_vector(r.get_parameters()));
+        return (l->get_condition() == r->get_condition()) && (get_sorted_vector(l->get_parameters()) == get_sorted_vector(r->get_parameters()));
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const ConditionImpl*>::operator()(const ConditionImpl* l, const ConditionImpl* r) const
-{
-    return UniquePDDLEqualTo<ConditionImpl>()(*l, *r);
-}
-
 bool UniquePDDLEqualTo<const DomainImpl*>::operator()(const DomainImpl* l, const DomainImpl* r) const
 {
     if (&l != &r)
@@ -155,109 +154,102 @@ bool UniquePDDLEqualTo<const DomainImpl*>::operator()(const DomainImpl* l, const
     return true;
 }
 
-bool UniquePDDLEqualTo<const EffectLiteralImpl&>::operator()(const EffectLiteralImpl& l, const EffectLiteralImpl& r) const
+bool UniquePDDLEqualTo<const EffectLiteralImpl*>::operator()(const EffectLiteralImpl* l, const EffectLiteralImpl* r) const
 {
     if (&l != &r)
     {
-        return (l.get_literal() == r.get_literal());
+        return (l->get_literal() == r->get_literal());
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const EffectAndImpl&>::operator()(const EffectAndImpl& l, const EffectAndImpl& r) const
+bool UniquePDDLEqualTo<const EffectAndImpl*>::operator()(const EffectAndImpl* l, const EffectAndImpl* r) const
 {
     if (&l != &r)
     {
-        return (get_sorted_vector(l.get_effects()) == get_sorted_vector(r.get_effects()));
+        return (get_sorted_vector(l->get_effects()) == get_sorted_vector(r->get_effects()));
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const EffectNumericImpl&>::operator()(const EffectNumericImpl& l, const EffectNumericImpl& r) const
+bool UniquePDDLEqualTo<const EffectNumericImpl*>::operator()(const EffectNumericImpl* l, const EffectNumericImpl* r) const
 {
     if (&l != &r)
     {
-        return (l.get_assign_operator() == r.get_assign_operator()) && (l.get_function() == r.get_function())
-               && (l.get_function_expression() == r.get_function_expression());
+        return (l->get_assign_operator() == r->get_assign_operator()) && (l->get_function() == r->get_function())
+               && (l->get_function_expression() == r->get_function_expression());
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const EffectConditionalForallImpl&>::operator()(const EffectConditionalForallImpl& l, const EffectConditionalForallImpl& r) const
+bool UniquePDDLEqualTo<const EffectConditionalForallImpl*>::operator()(const EffectConditionalForallImpl* l, const EffectConditionalForallImpl* r) const
 {
     if (&l != &r)
     {
-        return (l.get_effect() == r.get_effect()) && (get_sorted_vector(l.get_parameters()) == get_sorted_vector(r.get_parameters()));
+        return (l->get_effect() == r->get_effect()) && (get_sorted_vector(l->get_parameters()) == get_sorted_vector(r->get_parameters()));
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const EffectConditionalWhenImpl&>::operator()(const EffectConditionalWhenImpl& l, const EffectConditionalWhenImpl& r) const
+bool UniquePDDLEqualTo<const EffectConditionalWhenImpl*>::operator()(const EffectConditionalWhenImpl* l, const EffectConditionalWhenImpl* r) const
 {
     if (&l != &r)
     {
-        return (l.get_condition() == r.get_condition()) && (l.get_effect() == r.get_effect());
+        return (l->get_condition() == r->get_condition()) && (l->get_effect() == r->get_effect());
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const EffectImpl*>::operator()(const EffectImpl* l, const EffectImpl* r) const { return UniquePDDLEqualTo<EffectImpl>()(*l, *r); }
-
-bool UniquePDDLEqualTo<const FunctionExpressionNumberImpl&>::operator()(const FunctionExpressionNumberImpl& l, const FunctionExpressionNumberImpl& r) const
+bool UniquePDDLEqualTo<const FunctionExpressionNumberImpl*>::operator()(const FunctionExpressionNumberImpl* l, const FunctionExpressionNumberImpl* r) const
 {
     if (&l != &r)
     {
-        return (l.get_number() == r.get_number());
+        return (l->get_number() == r->get_number());
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const FunctionExpressionBinaryOperatorImpl&>::operator()(const FunctionExpressionBinaryOperatorImpl& l,
-                                                                                const FunctionExpressionBinaryOperatorImpl& r) const
+bool UniquePDDLEqualTo<const FunctionExpressionBinaryOperatorImpl*>::operator()(const FunctionExpressionBinaryOperatorImpl* l,
+                                                                                const FunctionExpressionBinaryOperatorImpl* r) const
 {
     if (&l != &r)
     {
-        return (l.get_binary_operator() == r.get_binary_operator()) && (l.get_left_function_expression() == r.get_left_function_expression())
-               && (l.get_right_function_expression() == r.get_right_function_expression());
+        return (l->get_binary_operator() == r->get_binary_operator()) && (l->get_left_function_expression() == r->get_left_function_expression())
+               && (l->get_right_function_expression() == r->get_right_function_expression());
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const FunctionExpressionMultiOperatorImpl&>::operator()(const FunctionExpressionMultiOperatorImpl& l,
-                                                                               const FunctionExpressionMultiOperatorImpl& r) const
+bool UniquePDDLEqualTo<const FunctionExpressionMultiOperatorImpl*>::operator()(const FunctionExpressionMultiOperatorImpl* l,
+                                                                               const FunctionExpressionMultiOperatorImpl* r) const
 {
     if (&l != &r)
     {
-        return (l.get_multi_operator() == r.get_multi_operator())
-               && (get_sorted_vector(l.get_function_expressions()) == get_sorted_vector(r.get_function_expressions()));
+        return (l->get_multi_operator() == r->get_multi_operator())
+               && (get_sorted_vector(l->get_function_expressions()) == get_sorted_vector(r->get_function_expressions()));
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const FunctionExpressionMinusImpl&>::operator()(const FunctionExpressionMinusImpl& l, const FunctionExpressionMinusImpl& r) const
+bool UniquePDDLEqualTo<const FunctionExpressionMinusImpl*>::operator()(const FunctionExpressionMinusImpl* l, const FunctionExpressionMinusImpl* r) const
 {
     if (&l != &r)
     {
-        return (l.get_function_expression() == r.get_function_expression());
+        return (l->get_function_expression() == r->get_function_expression());
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const FunctionExpressionFunctionImpl&>::operator()(const FunctionExpressionFunctionImpl& l,
-                                                                          const FunctionExpressionFunctionImpl& r) const
+bool UniquePDDLEqualTo<const FunctionExpressionFunctionImpl*>::operator()(const FunctionExpressionFunctionImpl* l,
+                                                                          const FunctionExpressionFunctionImpl* r) const
 {
     if (&l != &r)
     {
-        return (l.get_function() == r.get_function());
+        return (l->get_function() == r->get_function());
     }
     return true;
 }
 
-bool UniquePDDLEqualTo<const FunctionExpressionImpl*>::operator()(const FunctionExpressionImpl* l, const FunctionExpressionImpl* r) const
-{
-    return UniquePDDLEqualTo<FunctionExpressionImpl>()(*l, *r);
-}
-
 bool UniquePDDLEqualTo<const FunctionSkeletonImpl*>::operator()(const FunctionSkeletonImpl* l, const FunctionSkeletonImpl* r) const
 {
     if (&l != &r)
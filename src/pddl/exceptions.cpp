@@ -55,6 +55,21 @@ MultiDefinitionTypeError::MultiDefinitionTypeError(const std::string& name, cons
 {
 }
 
+static std::string cycle_to_string(const std::vector<std::string>& cycle)
+{
+    auto result = std::string();
+    for (const auto& type_name : cycle)
+    {
+        result += "\"" + type_name + "\" - ";
+    }
+    return result + "\"" + cycle.front() + "\"";
+}
+
+CyclicTypeHierarchyError::CyclicTypeHierarchyError(const std::vector<std::string>& cycle, const std::string& error_handler_output) :
+    SemanticParserError("The type hierarchy contains the cycle "s + cycle_to_string(cycle) + "."s, error_handler_output)
+{
+}
+
 /* Predicate */
 UnusedPredicateError::UnusedPredicateError(const std::string& name, const std::string& error_handler_output) :
     SemanticParserError("The predicate with name \""s + name + "\" was never referred to."s, error_handler_output)
@@ -222,8 +237,8 @@ IncompatibleArityError::IncompatibleArityError(const size_t arity_1, const size_
 IncompatibleVariableGroundingError::IncompatibleVariableGroundingError(const Object& object,
                                                                        const Variable& variable,
                                                                        const std::string& error_handler_output) :
-    SemanticParserError("The object with name \"" + object->get_name() + "\" does not satisfy the type requirement of variable with name \""
-                            + variable->get_name() + "\".",
+    SemanticParserError("The object with name \"" + std::string(object->get_name()) + "\" does not satisfy the type requirement of variable with name \""
+                            + std::string(variable->get_name()) + "\".",
                         error_handler_output)
 {
 }
@@ -17,6 +17,8 @@
 
 #include "loki/details/pddl/factories.hpp"
 
+#include "loki/details/exceptions.hpp"
+
 namespace loki
 {
 PDDLFactories::PDDLFactories() :
@@ -29,200 +31,308 @@ PDDLFactories::PDDLFactories() :
                 LiteralFactory(),
                 ParameterFactory(),
                 PredicateFactory(),
-                FunctionExpressionFactory(),
+                FunctionExpressionNumberFactory(),
+                FunctionExpressionBinaryOperatorFactory(),
+                FunctionExpressionMultiOperatorFactory(),
+                FunctionExpressionMinusFactory(),
+                FunctionExpressionFunctionFactory(),
                 FunctionFactory(),
                 FunctionSkeletonFactory(),
-                ConditionFactory(),
-                EffectFactory(),
+                ConditionLiteralFactory(),
+                ConditionAndFactory(),
+                ConditionOrFactory(),
+                ConditionNotFactory(),
+                ConditionImplyFactory(),
+                ConditionExistsFactory(),
+                ConditionForallFactory(),
+                EffectLiteralFactory(),
+                EffectAndFactory(),
+                EffectNumericFactory(),
+                EffectConditionalForallFactory(),
+                EffectConditionalWhenFactory(),
                 ActionFactory(),
                 AxiomFactory(),
                 OptimizationMetricFactory(),
                 NumericFluentFactory(),
                 DomainFactory(),
-                ProblemFactory())
+                ProblemFactory()),
+    m_names(),
+    m_parent(nullptr),
+    m_frozen(false)
 {
 }
 
+template<typename... Factories>
+static void continue_indexing(VariadicContainer<Factories...>& factories, const VariadicContainer<Factories...>& parent_factories)
+{
+    ((factories.template get<Factories>().set_index_offset(parent_factories.template get<Factories>().get_index_offset()
+                                                            + parent_factories.template get<Factories>().size())),
+     ...);
+}
+
+PDDLFactories::PDDLFactories(const PDDLFactories* parent) : PDDLFactories()
+{
+    m_parent = parent;
+    if (m_parent)
+    {
+        continue_indexing(m_factories, m_parent->m_factories);
+    }
+}
+
 PDDLFactories::PDDLFactories(PDDLFactories&& other) = default;
 
 PDDLFactories& PDDLFactories::operator=(PDDLFactories&& other) = default;
 
+template<typename Factory, typename HolderType>
+const HolderType* PDDLFactories::find_in_parent(const HolderType& element) const
+{
+    for (auto parent = m_parent; parent; parent = parent->m_parent)
+    {
+        if (const auto existing = parent->m_factories.get<Factory>().find(element))
+        {
+            return existing;
+        }
+    }
+    return nullptr;
+}
+
+template<typename Factory, typename SubType, typename... Args>
+auto PDDLFactories::get_or_create_impl(Args&&... args)
+{
+    auto& factory = m_factories.get<Factory>();
+    // The element is constructed once for the lookups in all parents and is moved into the factory if it does not exist.
+    auto element = factory.template create<SubType>(std::forward<Args>(args)...);
+    if (const auto existing = find_in_parent<Factory>(element))
+    {
+        return existing;
+    }
+    if (m_frozen)
+    {
+        // Looking up does not modify the factories.
+        if (const auto existing = factory.find(element))
+        {
+            return existing;
+        }
+        throw FrozenError("PDDLFactories::get_or_create: cannot create a PDDL object in frozen factories.");
+    }
+    return factory.get_or_create(std::move(element));
+}
+
+std::string_view PDDLFactories::get_or_create_name(std::string_view name)
+{
+    // Names of existing PDDL objects are compared by value, hence, frozen factories do not need to store the name.
+    if (m_frozen)
+    {
+        return name;
+    }
+    // Names that are stored in a parent, e.g., of PDDL objects of the parent, are not stored again.
+    for (auto parent = m_parent; parent; parent = parent->m_parent)
+    {
+        if (const auto parent_name = parent->m_names.find(name))
+        {
+            return parent_name.value();
+        }
+    }
+    return m_names.get_or_create(name);
+}
+
 Requirements PDDLFactories::get_or_create_requirements(RequirementEnumSet requirement_set)
 {
-    return m_factories.get<RequirementsFactory>().get_or_create<RequirementsImpl>(std::move(requirement_set));
+    return get_or_create_impl<RequirementsFactory, RequirementsImpl>(std::move(requirement_set));
 }
 
-Type PDDLFactories::get_or_create_type(std::string name, TypeList bases)
+Type PDDLFactories::get_or_create_type(std::string_view name, TypeList bases)
 {
-    return m_factories.get<TypeFactory>().get_or_create<TypeImpl>(std::move(name), std::move(bases));
+    return get_or_create_impl<TypeFactory, TypeImpl>(get_or_create_name(name), std::move(bases));
 }
 
-Variable PDDLFactories::get_or_create_variable(std::string name) { return m_factories.get<VariableFactory>().get_or_create<VariableImpl>(std::move(name)); }
+Variable PDDLFactories::get_or_create_variable(std::string_view name)
+{
+    return get_or_create_impl<VariableFactory, VariableImpl>(get_or_create_name(name));
+}
 
 Term PDDLFactories::get_or_create_term_variable(Variable variable)
 {
-    return m_factories.get<TermFactory>().get_or_create<TermVariableImpl>(std::move(variable));
+    return get_or_create_impl<TermFactory, TermVariableImpl>(std::move(variable));
 }
 
-Term PDDLFactories::get_or_create_term_object(Object object) { return m_factories.get<TermFactory>().get_or_create<TermObjectImpl>(std::move(object)); }
+Term PDDLFactories::get_or_create_term_object(Object object) { return get_or_create_impl<TermFactory, TermObjectImpl>(std::move(object)); }
 
-Object PDDLFactories::get_or_create_object(std::string name, TypeList types)
+Object PDDLFactories::get_or_create_object(std::string_view name, TypeList types)
 {
-    return m_factories.get<ObjectFactory>().get_or_create<ObjectImpl>(std::move(name), std::move(types));
+    return get_or_create_impl<ObjectFactory, ObjectImpl>(get_or_create_name(name), std::move(types));
 }
 
 Atom PDDLFactories::get_or_create_atom(Predicate predicate, TermList terms)
 {
-    return m_factories.get<AtomFactory>().get_or_create<AtomImpl>(std::move(predicate), std::move(terms));
+    return get_or_create_impl<AtomFactory, AtomImpl>(std::move(predicate), std::move(terms));
 }
 
 Literal PDDLFactories::get_or_create_literal(bool is_negated, Atom atom)
 {
-    return m_factories.get<LiteralFactory>().get_or_create<LiteralImpl>(std::move(is_negated), std::move(atom));
+    return get_or_create_impl<LiteralFactory, LiteralImpl>(std::move(is_negated), std::move(atom));
 }
 
 Parameter PDDLFactories::get_or_create_parameter(Variable variable, TypeList types)
 {
-    return m_factories.get<ParameterFactory>().get_or_create<ParameterImpl>(std::move(variable), std::move(types));
+    return get_or_create_impl<ParameterFactory, ParameterImpl>(std::move(variable), std::move(types));
 }
 
-Predicate PDDLFactories::get_or_create_predicate(std::string name, ParameterList parameters)
+Predicate PDDLFactories::get_or_create_predicate(std::string_view name, ParameterList parameters)
 {
-    return m_factories.get<PredicateFactory>().get_or_create<PredicateImpl>(std::move(name), std::move(parameters));
+    return get_or_create_impl<PredicateFactory, PredicateImpl>(get_or_create_name(name), std::move(parameters));
 }
 
 FunctionExpression PDDLFactories::get_or_create_function_expression_number(double number)
 {
-    return m_factories.get<FunctionExpressionFactory>().get_or_create<FunctionExpressionNumberImpl>(number);
+    return get_or_create_impl<FunctionExpressionNumberFactory, FunctionExpressionNumberImpl>(number);
 }
 
 FunctionExpression PDDLFactories::get_or_create_function_expression_binary_operator(BinaryOperatorEnum binary_operator,
                                                                                     FunctionExpression left_function_expression,
                                                                                     FunctionExpression right_function_expression)
 {
-    return m_factories.get<FunctionExpressionFactory>().get_or_create<FunctionExpressionBinaryOperatorImpl>(binary_operator,
-                                                                                                            std::move(left_function_expression),
-                                                                                                            std::move(right_function_expression));
+    return get_or_create_impl<FunctionExpressionBinaryOperatorFactory, FunctionExpressionBinaryOperatorImpl>(binary_operator,
+                                                                                                             std::move(left_function_expression),
+                                                                                                             std::move(right_function_expression));
 }
 
 FunctionExpression PDDLFactories::get_or_create_function_expression_multi_operator(MultiOperatorEnum multi_operator,
                                                                                    FunctionExpressionList function_expressions_)
 {
-    return m_factories.get<FunctionExpressionFactory>().get_or_create<FunctionExpressionMultiOperatorImpl>(multi_operator, std::move(function_expressions_));
+    return get_or_create_impl<FunctionExpressionMultiOperatorFactory, FunctionExpressionMultiOperatorImpl>(multi_operator, std::move(function_expressions_));
 }
 
 FunctionExpression PDDLFactories::get_or_create_function_expression_minus(FunctionExpression function_expression)
 {
-    return m_factories.get<FunctionExpressionFactory>().get_or_create<FunctionExpressionMinusImpl>(std::move(function_expression));
+    return get_or_create_impl<FunctionExpressionMinusFactory, FunctionExpressionMinusImpl>(std::move(function_expression));
 }
 
 FunctionExpression PDDLFactories::get_or_create_function_expression_function(Function function)
 {
-    return m_factories.get<FunctionExpressionFactory>().get_or_create<FunctionExpressionFunctionImpl>(std::move(function));
+    return get_or_create_impl<FunctionExpressionFunctionFactory, FunctionExpressionFunctionImpl>(std::move(function));
 }
 
 Function PDDLFactories::get_or_create_function(FunctionSkeleton function_skeleton, TermList terms)
 {
-    return m_factories.get<FunctionFactory>().get_or_create<FunctionImpl>(std::move(function_skeleton), std::move(terms));
+    return get_or_create_impl<FunctionFactory, FunctionImpl>(std::move(function_skeleton), std::move(terms));
 }
 
-FunctionSkeleton PDDLFactories::get_or_create_function_skeleton(std::string name, ParameterList parameters, Type type)
+FunctionSkeleton PDDLFactories::get_or_create_function_skeleton(std::string_view name, ParameterList parameters, Type type)
 {
-    return m_factories.get<FunctionSkeletonFactory>().get_or_create<FunctionSkeletonImpl>(std::move(name), std::move(parameters), std::move(type));
+    return get_or_create_impl<FunctionSkeletonFactory, FunctionSkeletonImpl>(get_or_create_name(name), std::move(parameters), std::move(type));
 }
 
 Condition PDDLFactories::get_or_create_condition_literal(Literal literal)
 {
-    return m_factories.get<ConditionFactory>().get_or_create<ConditionLiteralImpl>(std::move(literal));
+    return get_or_create_impl<ConditionLiteralFactory, ConditionLiteralImpl>(std::move(literal));
 }
 
 Condition PDDLFactories::get_or_create_condition_and(ConditionList conditions_)
 {
-    return m_factories.get<ConditionFactory>().get_or_create<ConditionAndImpl>(std::move(conditions_));
+    return get_or_create_impl<ConditionAndFactory, ConditionAndImpl>(std::move(conditions_));
 }
 
 Condition PDDLFactories::get_or_create_condition_or(ConditionList conditions_)
 {
-    return m_factories.get<ConditionFactory>().get_or_create<ConditionOrImpl>(std::move(conditions_));
+    return get_or_create_impl<ConditionOrFactory, ConditionOrImpl>(std::move(conditions_));
 }
 
 Condition PDDLFactories::get_or_create_condition_not(Condition condition)
 {
-    return m_factories.get<ConditionFactory>().get_or_create<ConditionNotImpl>(std::move(condition));
+    return get_or_create_impl<ConditionNotFactory, ConditionNotImpl>(std::move(condition));
 }
 
 Condition PDDLFactories::get_or_create_condition_imply(Condition condition_left, Condition condition_right)
 {
-    return m_factories.get<ConditionFactory>().get_or_create<ConditionImplyImpl>(std::move(condition_left), std::move(condition_right));
+    return get_or_create_impl<ConditionImplyFactory, ConditionImplyImpl>(std::move(condition_left), std::move(condition_right));
 }
 
 Condition PDDLFactories::get_or_create_condition_exists(ParameterList parameters, Condition condition)
 {
-    return m_factories.get<ConditionFactory>().get_or_create<ConditionExistsImpl>(std::move(parameters), std::move(condition));
+    return get_or_create_impl<ConditionExistsFactory, ConditionExistsImpl>(std::move(parameters), std::move(condition));
 }
 
 Condition PDDLFactories::get_or_create_condition_forall(ParameterList parameters, Condition condition)
 {
-    return m_factories.get<ConditionFactory>().get_or_create<ConditionForallImpl>(std::move(parameters), std::move(condition));
+    return get_or_create_impl<ConditionForallFactory, ConditionForallImpl>(std::move(parameters), std::move(condition));
 }
 
 Effect PDDLFactories::get_or_create_effect_literal(Literal literal)
 {
-    return m_factories.get<EffectFactory>().get_or_create<EffectLiteralImpl>(std::move(literal));
+    return get_or_create_impl<EffectLiteralFactory, EffectLiteralImpl>(std::move(literal));
 }
 
 Effect PDDLFactories::get_or_create_effect_and(EffectList effects_)
 {
-    return m_factories.get<EffectFactory>().get_or_create<EffectAndImpl>(std::move(effects_));
+    return get_or_create_impl<EffectAndFactory, EffectAndImpl>(std::move(effects_));
 }
 
 Effect PDDLFactories::get_or_create_effect_numeric(AssignOperatorEnum assign_operator, Function function, FunctionExpression function_expression)
 {
-    return m_factories.get<EffectFactory>().get_or_create<EffectNumericImpl>(std::move(assign_operator), std::move(function), std::move(function_expression));
+    return get_or_create_impl<EffectNumericFactory, EffectNumericImpl>(std::move(assign_operator),
+                                                                       std::move(function),
+                                                                       std::move(function_expression));
 }
 
 Effect PDDLFactories::get_or_create_effect_conditional_forall(ParameterList parameters, Effect effect)
 {
-    return m_factories.get<EffectFactory>().get_or_create<EffectConditionalForallImpl>(std::move(parameters), std::move(effect));
+    return get_or_create_impl<EffectConditionalForallFactory, EffectConditionalForallImpl>(std::move(parameters), std::move(effect));
 }
 
 Effect PDDLFactories::get_or_create_effect_conditional_when(Condition condition, Effect effect)
 {
-    return m_factories.get<EffectFactory>().get_or_create<EffectConditionalWhenImpl>(std::move(condition), std::move(effect));
+    return get_or_create_impl<EffectConditionalWhenFactory, EffectConditionalWhenImpl>(std::move(condition), std::move(effect));
 }
 
-Action PDDLFactories::get_or_create_action(std::string name,
+Action PDDLFactories::get_or_create_action(std::string_view name,
                                            size_t original_arity,
                                            ParameterList parameters,
                                            std::optional<Condition> condition,
                                            std::optional<Effect> effect)
 {
-    return m_factories.get<ActionFactory>().get_or_create<ActionImpl>(std::move(name),
-                                                                      std::move(original_arity),
+    return get_or_create_impl<ActionFactory, ActionImpl>(get_or_create_name(name),
+                                                         std::move(original_arity),
+                                                         std::move(parameters),
+                                                         std::move(condition),
+                                                         std::move(effect));
+}
+
+Action PDDLFactories::create_lazy_action(std::string_view name, ParameterList parameters, std::unique_ptr<LazyActionBody> lazy_body)
+{
+    if (m_frozen)
+    {
+        throw FrozenError("PDDLFactories::create_lazy_action: cannot create an action in frozen factories.");
+    }
+    // A lazy action is equal to no other action, hence, there is nothing to look up.
+    const auto original_arity = parameters.size();
+    return m_factories.get<ActionFactory>().get_or_create<ActionImpl>(get_or_create_name(name),
+                                                                      original_arity,
                                                                       std::move(parameters),
-                                                                      std::move(condition),
-                                                                      std::move(effect));
+                                                                      std::optional<Condition>(),
+                                                                      std::optional<Effect>(),
+                                                                      std::move(lazy_body));
 }
 
-Axiom PDDLFactories::get_or_create_axiom(std::string derived_predicate_name,
+Axiom PDDLFactories::get_or_create_axiom(std::string_view derived_predicate_name,
                                          ParameterList parameters,
                                          Condition condition,
                                          size_t num_parameters_to_ground_head)
 {
-    return m_factories.get<AxiomFactory>().get_or_create<AxiomImpl>(std::move(derived_predicate_name),
-                                                                    std::move(parameters),
-                                                                    std::move(condition),
-                                                                    num_parameters_to_ground_head);
+    return get_or_create_impl<AxiomFactory, AxiomImpl>(get_or_create_name(derived_predicate_name),
+                                                       std::move(parameters),
+                                                       std::move(condition),
+                                                       num_parameters_to_ground_head);
 }
 
 OptimizationMetric PDDLFactories::get_or_create_optimization_metric(OptimizationMetricEnum metric, FunctionExpression function_expression)
 {
-    return m_factories.get<OptimizationMetricFactory>().get_or_create<OptimizationMetricImpl>(std::move(metric), std::move(function_expression));
+    return get_or_create_impl<OptimizationMetricFactory, OptimizationMetricImpl>(std::move(metric), std::move(function_expression));
 }
 
 NumericFluent PDDLFactories::get_or_create_numeric_fluent(Function function, double number)
 {
-    return m_factories.get<NumericFluentFactory>().get_or_create<NumericFluentImpl>(std::move(function), std::move(number));
+    return get_or_create_impl<NumericFluentFactory, NumericFluentImpl>(std::move(function), std::move(number));
 }
 
 Domain PDDLFactories::get_or_create_domain(std::optional<fs::path> filepath,
@@ -235,6 +345,10 @@ Domain PDDLFactories::get_or_create_domain(std::optional<fs::path> filepath,
                                            ActionList actions,
                                            AxiomList axioms)
 {
+    if (m_frozen)
+    {
+        throw FrozenError("PDDLFactories::get_or_create_domain: cannot create a domain in frozen factories.");
+    }
     return m_factories.get<DomainFactory>().get_or_create<DomainImpl>(std::move(filepath),
                                                                       std::move(name),
                                                                       std::move(requirements),
@@ -258,6 +372,10 @@ Problem PDDLFactories::get_or_create_problem(std::optional<fs::path> filepath,
                                              std::optional<OptimizationMetric> optimization_metric,
                                              AxiomList axioms)
 {
+    if (m_frozen)
+    {
+        throw FrozenError("PDDLFactories::get_or_create_problem: cannot create a problem in frozen factories.");
+    }
     return m_factories.get<ProblemFactory>().get_or_create<ProblemImpl>(std::move(filepath),
                                                                         std::move(domain),
                                                                         std::move(name),
@@ -270,4 +388,55 @@ Problem PDDLFactories::get_or_create_problem(std::optional<fs::path> filepath,
                                                                         std::move(optimization_metric),
                                                                         std::move(axioms));
 }
+
+const StringArena& PDDLFactories::get_names() const { return m_names; }
+
+const PDDLFactories* PDDLFactories::get_parent() const { return m_parent; }
+
+template<typename... Factories>
+static void shrink_to_fit(VariadicContainer<Factories...>& factories)
+{
+    (factories.template get<Factories>().shrink_to_fit(), ...);
+}
+
+const PDDLFactories& PDDLFactories::freeze(bool shrink_to_fit)
+{
+    m_frozen = true;
+    if (shrink_to_fit)
+    {
+        loki::shrink_to_fit(m_factories);
+    }
+    return *this;
+}
+
+bool PDDLFactories::is_frozen() const { return m_frozen; }
+
+template<typename... Factories>
+static void clear(VariadicContainer<Factories...>& factories)
+{
+    (factories.template get<Factories>().clear(), ...);
+}
+
+void PDDLFactories::clear()
+{
+    if (m_frozen)
+    {
+        throw FrozenError("PDDLFactories::clear: cannot clear frozen factories.");
+    }
+    loki::clear(m_factories);
+    m_names.clear();
+    if (m_parent)
+    {
+        continue_indexing(m_factories, m_parent->m_factories);
+    }
+}
+
+template<typename... Factories>
+static size_t get_estimated_memory_usage(const VariadicContainer<Factories...>& factories)
+{
+    return (factories.template get<Factories>().get_estimated_memory_usage() + ...);
+}
+
+size_t PDDLFactories::get_estimated_memory_usage() const { return loki::get_estimated_memory_usage(m_factories) + m_names.num_bytes(); }
+
 }
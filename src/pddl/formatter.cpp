@@ -45,14 +45,14 @@ void PDDLFormatter::write(const ActionImpl& element, std::ostream& out)
     out << "\n";
     out << std::string(m_indent, ' ') << ":conditions ";
     if (element.get_condition().has_value())
-        write(*element.get_condition().value(), out);
+        write(element.get_condition().value(), out);
     else
         out << "()";
 
     out << "\n";
     out << std::string(m_indent, ' ') << ":effects ";
     if (element.get_effect().has_value())
-        write(*element.get_effect().value(), out);
+        write(element.get_effect().value(), out);
     else
         out << "()";
     out << ")\n";
@@ -84,7 +84,7 @@ void PDDLFormatter::write(const AxiomImpl& element, std::ostream& out)
     m_indent -= m_add_indent;
 
     out << std::string(m_indent, ' ');
-    write(*element.get_condition(), out);
+    write(element.get_condition(), out);
     out << ")\n";
 
     m_indent -= m_add_indent;
@@ -99,7 +99,7 @@ void PDDLFormatter::write(const ConditionAndImpl& element, std::ostream& out)
     {
         if (i != 0)
             out << " ";
-        write(*element.get_conditions()[i], out);
+        write(element.get_conditions()[i], out);
     }
     out << ")";
 }
@@ -111,7 +111,7 @@ void PDDLFormatter::write(const ConditionOrImpl& element, std::ostream& out)
     {
         if (i != 0)
             out << " ";
-        write(*element.get_conditions()[i], out);
+        write(element.get_conditions()[i], out);
     }
     out << ")";
 }
@@ -119,16 +119,16 @@ void PDDLFormatter::write(const ConditionOrImpl& element, std::ostream& out)
 void PDDLFormatter::write(const ConditionNotImpl& element, std::ostream& out)
 {
     out << "(not ";
-    write(*element.get_condition(), out);
+    write(element.get_condition(), out);
     out << ")";
 }
 
 void PDDLFormatter::write(const ConditionImplyImpl& element, std::ostream& out)
 {
     out << "(imply ";
-    write(*element.get_condition_left(), out);
+    write(element.get_condition_left(), out);
     out << " ";
-    write(*element.get_condition_right(), out);
+    write(element.get_condition_right(), out);
     out << ")";
 }
 
@@ -142,7 +142,7 @@ void PDDLFormatter::write(const ConditionExistsImpl& element, std::ostream& out)
         write(*element.get_parameters()[i], out);
     }
     out << ") ";
-    write(*element.get_condition(), out);
+    write(element.get_condition(), out);
     out << ")";
 }
 
@@ -156,13 +156,13 @@ void PDDLFormatter::write(const ConditionForallImpl& element, std::ostream& out)
         write(*element.get_parameters()[i], out);
     }
     out << ") ";
-    write(*element.get_condition(), out);
+    write(element.get_condition(), out);
     out << ")";
 }
 
-void PDDLFormatter::write(const ConditionImpl& element, std::ostream& out)
+void PDDLFormatter::write(const Condition& element, std::ostream& out)
 {
-    std::visit([this, &out](const auto& arg) { this->write(arg, out); }, element);
+    visit([this, &out](const auto& arg) { this->write(*arg, out); }, element);
 }
 
 void PDDLFormatter::write(const DomainImpl& element, std::ostream& out)
@@ -301,7 +301,7 @@ void PDDLFormatter::write(const EffectAndImpl& element, std::ostream& out)
     {
         if (i != 0)
             out << " ";
-        write(*element.get_effects()[i], out);
+        write(element.get_effects()[i], out);
     }
     out << ")";
 }
@@ -311,7 +311,7 @@ void PDDLFormatter::write(const EffectNumericImpl& element, std::ostream& out)
     out << "(" << to_string(element.get_assign_operator()) << " ";
     write(*element.get_function(), out);
     out << " ";
-    write(*element.get_function_expression(), out);
+    write(element.get_function_expression(), out);
     out << ")";
 }
 
@@ -325,22 +325,22 @@ void PDDLFormatter::write(const EffectConditionalForallImpl& element, std::ostre
         write(*element.get_parameters()[i], out);
     }
     out << ") ";
-    write(*element.get_effect(), out);
+    write(element.get_effect(), out);
     out << ")";
 }
 
 void PDDLFormatter::write(const EffectConditionalWhenImpl& element, std::ostream& out)
 {
     out << "(when ";
-    write(*element.get_condition(), out);
+    write(element.get_condition(), out);
     out << " ";
-    write(*element.get_effect(), out);
+    write(element.get_effect(), out);
     out << ")";
 }
 
-void PDDLFormatter::write(const EffectImpl& element, std::ostream& out)
+void PDDLFormatter::write(const Effect& element, std::ostream& out)
 {
-    std::visit([this, &out](const auto& arg) { this->write(arg, out); }, element);
+    visit([this, &out](const auto& arg) { this->write(*arg, out); }, element);
 }
 
 void PDDLFormatter::write(const FunctionExpressionNumberImpl& element, std::ostream& out) { out << element.get_number(); }
@@ -348,9 +348,9 @@ void PDDLFormatter::write(const FunctionExpressionNumberImpl& element, std::ostr
 void PDDLFormatter::write(const FunctionExpressionBinaryOperatorImpl& element, std::ostream& out)
 {
     out << "(" << to_string(element.get_binary_operator()) << " ";
-    write(*element.get_left_function_expression(), out);
+    write(element.get_left_function_expression(), out);
     out << " ";
-    write(*element.get_right_function_expression(), out);
+    write(element.get_right_function_expression(), out);
     out << ")";
 }
 
@@ -361,7 +361,7 @@ void PDDLFormatter::write(const FunctionExpressionMultiOperatorImpl& element, st
     for (const auto& function_expression : element.get_function_expressions())
     {
         out << " ";
-        write(*function_expression, out);
+        write(function_expression, out);
     }
     out << ")";
 }
@@ -369,15 +369,15 @@ void PDDLFormatter::write(const FunctionExpressionMultiOperatorImpl& element, st
 void PDDLFormatter::write(const FunctionExpressionMinusImpl& element, std::ostream& out)
 {
     out << "(- ";
-    write(*element.get_function_expression(), out);
+    write(element.get_function_expression(), out);
     out << ")";
 }
 
 void PDDLFormatter::write(const FunctionExpressionFunctionImpl& element, std::ostream& out) { write(*element.get_function(), out); }
 
-void PDDLFormatter::write(const FunctionExpressionImpl& element, std::ostream& out)
+void PDDLFormatter::write(const FunctionExpression& element, std::ostream& out)
 {
-    std::visit([this, &out](const auto& arg) { this->write(arg, out); }, element);
+    visit([this, &out](const auto& arg) { this->write(*arg, out); }, element);
 }
 
 void PDDLFormatter::write(const FunctionSkeletonImpl& element, std::ostream& out)
@@ -427,7 +427,7 @@ void PDDLFormatter::write(const LiteralImpl& element, std::ostream& out)
 void PDDLFormatter::write(const OptimizationMetricImpl& element, std::ostream& out)
 {
     out << "(" << to_string(element.get_optimization_metric()) << " ";
-    write(*element.get_function_expression(), out);
+    write(element.get_function_expression(), out);
     out << ")";
 }
 
@@ -588,7 +588,7 @@ void PDDLFormatter::write(const ProblemImpl& element, std::ostream& out)
     if (element.get_goal_condition().has_value())
     {
         out << std::string(m_indent, ' ') << "(:goal ";
-        write(*element.get_goal_condition().value(), out);
+        write(element.get_goal_condition().value(), out);
         out << ")\n";
     }
 
@@ -66,20 +66,20 @@ public:
     void write(const ConditionImplyImpl& element, std::ostream& out);
     void write(const ConditionExistsImpl& element, std::ostream& out);
     void write(const ConditionForallImpl& element, std::ostream& out);
-    void write(const ConditionImpl& element, std::ostream& out);
+    void write(const Condition& element, std::ostream& out);
     void write(const DomainImpl& element, std::ostream& out);
     void write(const EffectLiteralImpl& element, std::ostream& out);
     void write(const EffectAndImpl& element, std::ostream& out);
     void write(const EffectNumericImpl& element, std::ostream& out);
     void write(const EffectConditionalForallImpl& element, std::ostream& out);
     void write(const EffectConditionalWhenImpl& element, std::ostream& out);
-    void write(const EffectImpl& element, std::ostream& out);
+    void write(const Effect& element, std::ostream& out);
     void write(const FunctionExpressionNumberImpl& element, std::ostream& out);
     void write(const FunctionExpressionBinaryOperatorImpl& element, std::ostream& out);
     void write(const FunctionExpressionMultiOperatorImpl& element, std::ostream& out);
     void write(const FunctionExpressionMinusImpl& element, std::ostream& out);
     void write(const FunctionExpressionFunctionImpl& element, std::ostream& out);
-    void write(const FunctionExpressionImpl& element, std::ostream& out);
+    void write(const FunctionExpression& element, std::ostream& out);
     void write(const FunctionSkeletonImpl& element, std::ostream& out);
     void write(const FunctionImpl& element, std::ostream& out);
     void write(const LiteralImpl& element, std::ostream& out);
@@ -145,7 +145,7 @@ std::ostream& operator<<(std::ostream& out, const FunctionExpressionFunctionImpl
     return out;
 }
 
-std::ostream& operator<<(std::ostream& out, const FunctionExpressionImpl& element)
+std::ostream& operator<<(std::ostream& out, const FunctionExpression& element)
 {
     auto formatter = PDDLFormatter();
     formatter.write(element, out);
@@ -22,9 +22,9 @@
 
 namespace loki
 {
-FunctionSkeletonImpl::FunctionSkeletonImpl(size_t index, std::string name, ParameterList parameters, Type type) :
+FunctionSkeletonImpl::FunctionSkeletonImpl(size_t index, std::string_view name, ParameterList parameters, Type type) :
     m_index(index),
-    m_name(std::move(name)),
+    m_name(name),
     m_parameters(parameters),
     m_type(std::move(type))
 {
@@ -32,7 +32,7 @@ FunctionSkeletonImpl::FunctionSkeletonImpl(size_t index, std::string name, Param
 
 size_t FunctionSkeletonImpl::get_index() const { return m_index; }
 
-const std::string& FunctionSkeletonImpl::get_name() const { return m_name; }
+std::string_view FunctionSkeletonImpl::get_name() const { return m_name; }
 
 const ParameterList& FunctionSkeletonImpl::get_parameters() const { return m_parameters; }
 
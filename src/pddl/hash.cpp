@@ -43,8 +43,23 @@
 
 namespace loki
 {
+size_t UniquePDDLHasher<Condition>::operator()(const Condition& condition) const
+{
+    return UniquePDDLHashCombiner()(condition.index(), std::hash<const void*>()(condition.get_address()));
+}
+
+size_t UniquePDDLHasher<Effect>::operator()(const Effect& effect) const
+{
+    return UniquePDDLHashCombiner()(effect.index(), std::hash<const void*>()(effect.get_address()));
+}
+
 size_t UniquePDDLHasher<const ActionImpl*>::operator()(const ActionImpl* e) const
 {
+    if (e->is_lazy())
+    {
+        // Lazy actions are only equal to themselves and the hash must not parse their bodies.
+        return UniquePDDLHashCombiner()(e->get_name(), get_sorted_vector(e->get_parameters()));
+    }
     return UniquePDDLHashCombiner()(e->get_name(), get_sorted_vector(e->get_parameters()), e->get_condition(), e->get_effect());
 }
 
@@ -55,38 +70,33 @@ size_t UniquePDDLHasher<const AxiomImpl*>::operator()(const AxiomImpl* e) const
     return UniquePDDLHashCombiner()(e->get_derived_predicate_name(), get_sorted_vector(e->get_parameters()), e->get_condition());
 }
 
-size_t UniquePDDLHasher<const ConditionLiteralImpl&>::operator()(const ConditionLiteralImpl& e) const { return UniquePDDLHashCombiner()(e.get_literal()); }
+size_t UniquePDDLHasher<const ConditionLiteralImpl*>::operator()(const ConditionLiteralImpl* e) const { return UniquePDDLHashCombiner()(e->get_literal()); }
 
-size_t UniquePDDLHasher<const ConditionAndImpl&>::operator()(const ConditionAndImpl& e) const
+size_t UniquePDDLHasher<const ConditionAndImpl*>::operator()(const ConditionAndImpl* e) const
 {
-    return UniquePDDLHashCombiner()(get_sorted_vector(e.get_conditions()));
+    return UniquePDDLHashCombiner()(get_sorted_vector(e->get_conditions()));
 }
 
-size_t UniquePDDLHasher<const ConditionOrImpl&>::operator()(const ConditionOrImpl& e) const
+size_t UniquePDDLHasher<const ConditionOrImpl*>::operator()(const ConditionOrImpl* e) const
 {
-    return UniquePDDLHashCombiner()(get_sorted_vector(e.get_conditions()));
+    return UniquePDDLHashCombiner()(get_sorted_vector(e->get_conditions()));
 }
 
-size_t UniquePDDLHasher<const ConditionNotImpl&>::operator()(const ConditionNotImpl& e) const { return UniquePDDLHashCombiner()(e.get_condition()); }
-
-size_t UniquePDDLHasher<const ConditionImplyImpl&>::operator()(const ConditionImplyImpl& e) const
-{
-    return UniquePDDLHashCombiner()(e.get_condition_left(), e.get_condition_right());
-}
+size_t UniquePDDLHasher<const ConditionNotImpl*>::operator()(const ConditionNotImpl* e) const { return UniquePDDLHashCombiner()(e->get_condition()); }
 
-size_t UniquePDDLHasher<const ConditionExistsImpl&>::operator()(const ConditionExistsImpl& e) const
+size_t UniquePDDLHasher<const ConditionImplyImpl*>::operator()(const ConditionImplyImpl* e) const
 {
-    return UniquePDDLHashCombiner()(get_sorted_vector(e.get_parameters()), e.get_condition());
+    return UniquePDDLHashCombiner()(e->get_condition_left(), e->get_condition_right());
 }
 
-size_t UniquePDDLHasher<const ConditionForallImpl&>::operator()(const ConditionForallImpl& e) const
+size_t UniquePDDLHasher<const ConditionExistsImpl*>::operator()(const ConditionExistsImpl* e) const
 {
-    return UniquePDDLHashCombiner()(get_sorted_vector(e.get_parameters()), e.get_condition());
+    return UniquePDDLHashCombiner()(get_sorted_vector(e->get_parameters()), e->get_condition());
 }
 
-size_t UniquePDDLHasher<const ConditionImpl*>::operator()(const ConditionImpl* e) const
+size_t UniquePDDLHasher<const ConditionForallImpl*>::operator()(const ConditionForallImpl* e) const
 {
-    return std::visit([](const auto& arg) { return UniquePDDLHasher<decltype(arg)>()(arg); }, *e);
+    return UniquePDDLHashCombiner()(get_sorted_vector(e->get_parameters()), e->get_condition());
 }
 
 size_t UniquePDDLHasher<const DomainImpl*>::operator()(const DomainImpl* e) const
@@ -101,58 +111,51 @@ size_t UniquePDDLHasher<const DomainImpl*>::operator()(const DomainImpl* e) cons
                                     get_sorted_vector(e->get_axioms()));
 }
 
-size_t UniquePDDLHasher<const EffectLiteralImpl&>::operator()(const EffectLiteralImpl& e) const { return UniquePDDLHashCombiner()(e.get_literal()); }
-
-size_t UniquePDDLHasher<const EffectAndImpl&>::operator()(const EffectAndImpl& e) const { return UniquePDDLHashCombiner()(get_sorted_vector(e.get_effects())); }
-
-size_t UniquePDDLHasher<const EffectNumericImpl&>::operator()(const EffectNumericImpl& e) const
-{
-    return UniquePDDLHashCombiner()(e.get_assign_operator(), e.get_function(), e.get_function_expression());
-}
+size_t UniquePDDLHasher<const EffectLiteralImpl*>::operator()(const EffectLiteralImpl* e) const { return UniquePDDLHashCombiner()(e->get_literal()); }
 
-size_t UniquePDDLHasher<const EffectConditionalForallImpl&>::operator()(const EffectConditionalForallImpl& e) const
+size_t UniquePDDLHasher<const EffectAndImpl*>::operator()(const EffectAndImpl* e) const
 {
-    return UniquePDDLHashCombiner()(e.get_effect(), get_sorted_vector(e.get_parameters()));
+    return UniquePDDLHashCombiner()(get_sorted_vector(e->get_effects()));
 }
 
-size_t UniquePDDLHasher<const EffectConditionalWhenImpl&>::operator()(const EffectConditionalWhenImpl& e) const
+size_t UniquePDDLHasher<const EffectNumericImpl*>::operator()(const EffectNumericImpl* e) const
 {
-    return UniquePDDLHashCombiner()(e.get_condition(), e.get_effect());
+    return UniquePDDLHashCombiner()(e->get_assign_operator(), e->get_function(), e->get_function_expression());
 }
 
-size_t UniquePDDLHasher<const EffectImpl*>::operator()(const EffectImpl* e) const
+size_t UniquePDDLHasher<const EffectConditionalForallImpl*>::operator()(const EffectConditionalForallImpl* e) const
 {
-    return std::visit([](const auto& arg) { return UniquePDDLHasher<decltype(arg)>()(arg); }, *e);
+    return UniquePDDLHashCombiner()(e->get_effect(), get_sorted_vector(e->get_parameters()));
 }
 
-size_t UniquePDDLHasher<const FunctionExpressionNumberImpl&>::operator()(const FunctionExpressionNumberImpl& e) const
+size_t UniquePDDLHasher<const EffectConditionalWhenImpl*>::operator()(const EffectConditionalWhenImpl* e) const
 {
-    return UniquePDDLHashCombiner()(e.get_number());
+    return UniquePDDLHashCombiner()(e->get_condition(), e->get_effect());
 }
 
-size_t UniquePDDLHasher<const FunctionExpressionBinaryOperatorImpl&>::operator()(const FunctionExpressionBinaryOperatorImpl& e) const
+size_t UniquePDDLHasher<const FunctionExpressionNumberImpl*>::operator()(const FunctionExpressionNumberImpl* e) const
 {
-    return UniquePDDLHashCombiner()(e.get_binary_operator(), e.get_left_function_expression(), e.get_right_function_expression());
+    return UniquePDDLHashCombiner()(e->get_number());
 }
 
-size_t UniquePDDLHasher<const FunctionExpressionMultiOperatorImpl&>::operator()(const FunctionExpressionMultiOperatorImpl& e) const
+size_t UniquePDDLHasher<const FunctionExpressionBinaryOperatorImpl*>::operator()(const FunctionExpressionBinaryOperatorImpl* e) const
 {
-    return UniquePDDLHashCombiner()(e.get_multi_operator(), get_sorted_vector(e.get_function_expressions()));
+    return UniquePDDLHashCombiner()(e->get_binary_operator(), e->get_left_function_expression(), e->get_right_function_expression());
 }
 
-size_t UniquePDDLHasher<const FunctionExpressionMinusImpl&>::operator()(const FunctionExpressionMinusImpl& e) const
+size_t UniquePDDLHasher<const FunctionExpressionMultiOperatorImpl*>::operator()(const FunctionExpressionMultiOperatorImpl* e) const
 {
-    return UniquePDDLHashCombiner()(e.get_function_expression());
+    return UniquePDDLHashCombiner()(e->get_multi_operator(), get_sorted_vector(e->get_function_expressions()));
 }
 
-size_t UniquePDDLHasher<const FunctionExpressionFunctionImpl&>::operator()(const FunctionExpressionFunctionImpl& e) const
+size_t UniquePDDLHasher<const FunctionExpressionMinusImpl*>::operator()(const FunctionExpressionMinusImpl* e) const
 {
-    return UniquePDDLHashCombiner()(e.get_function());
+    return UniquePDDLHashCombiner()(e->get_function_expression());
 }
 
-size_t UniquePDDLHasher<const FunctionExpressionImpl*>::operator()(const FunctionExpressionImpl* e) const
+size_t UniquePDDLHasher<const FunctionExpressionFunctionImpl*>::operator()(const FunctionExpressionFunctionImpl* e) const
 {
-    return std::visit([](const auto& arg) { return UniquePDDLHasher<decltype(arg)>()(arg); }, *e);
+    return UniquePDDLHashCombiner()(e->get_function());
 }
 
 size_t UniquePDDLHasher<const FunctionSkeletonImpl*>::operator()(const FunctionSkeletonImpl* e) const
@@ -0,0 +1,375 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "merger.hpp"
+
+#include <algorithm>
+
+namespace loki
+{
+
+template<typename T>
+static const UniqueFactory<T, UniquePDDLHasher<const T*>, UniquePDDLEqualTo<const T*>>& get_factory(const PDDLFactories& factories)
+{
+    return factories.get_factory<UniqueFactory<T, UniquePDDLHasher<const T*>, UniquePDDLEqualTo<const T*>>>();
+}
+
+PDDLMerger::PDDLMerger(const PDDLFactories& source, PDDLFactories& target) : m_source(source), m_target(target), m_merged()
+{
+    std::apply([this](auto&... merged) { ((merged.index_offset = m_source.get_index_offset<typename std::decay_t<decltype(merged)>::ElementType>()), ...); },
+               m_merged);
+}
+
+template<typename T, typename CreateFunction>
+const T* PDDLMerger::merge_impl(const T* element, CreateFunction&& create)
+{
+    auto& merged = std::get<MergedPDDLObjects<T>>(m_merged);
+    const auto index = get_position_index(*element);
+    if (index < merged.index_offset)
+    {
+        // The PDDL object was created in the parent factories.
+        return element;
+    }
+    const auto pos = index - merged.index_offset;
+    if (pos < merged.elements.size() && merged.elements[pos])
+    {
+        return merged.elements[pos];
+    }
+    // Merge the preceding PDDL objects of the same type first, even if they are not referenced, e.g., removed unused parameters.
+    // Hence, the PDDL objects are created in the order of the child factories, which is the order of parsing sequentially.
+    const auto& factory = get_factory<T>(m_source);
+    while (merged.num_ordered < pos)
+    {
+        merge(factory[merged.num_ordered++]);
+    }
+    merged.num_ordered = std::max(merged.num_ordered, pos + 1);
+    // Creating the PDDL object might merge nested PDDL objects of the same type, hence, we resize afterwards.
+    const auto result = create();
+    if (pos >= merged.elements.size())
+    {
+        merged.elements.resize(pos + 1, nullptr);
+    }
+    merged.elements[pos] = result;
+    return result;
+}
+
+template<typename T>
+void PDDLMerger::merge_remaining_impl()
+{
+    const auto& factory = get_factory<T>(m_source);
+    auto& merged = std::get<MergedPDDLObjects<T>>(m_merged);
+    while (merged.num_ordered < factory.size())
+    {
+        merge(factory[merged.num_ordered++]);
+    }
+}
+
+void PDDLMerger::merge_remaining()
+{
+    std::apply([this](const auto&... merged) { (merge_remaining_impl<typename std::decay_t<decltype(merged)>::ElementType>(), ...); }, m_merged);
+}
+
+Requirements PDDLMerger::merge(const Requirements& requirements)
+{
+    return merge_impl(requirements, [&] { return m_target.get_or_create_requirements(requirements->get_requirements()); });
+}
+
+Type PDDLMerger::merge(const Type& type)
+{
+    return merge_impl(type, [&] { return m_target.get_or_create_type(type->get_name(), merge(type->get_bases())); });
+}
+
+Variable PDDLMerger::merge(const Variable& variable)
+{
+    return merge_impl(variable, [&] { return m_target.get_or_create_variable(variable->get_name()); });
+}
+
+Term PDDLMerger::merge(const Term& term)
+{
+    return merge_impl(term,
+                      [&]
+                      {
+                          if (const auto term_object = std::get_if<TermObjectImpl>(term))
+                          {
+                              return m_target.get_or_create_term_object(merge(term_object->get_object()));
+                          }
+                          return m_target.get_or_create_term_variable(merge(std::get<TermVariableImpl>(*term).get_variable()));
+                      });
+}
+
+Object PDDLMerger::merge(const Object& object)
+{
+    return merge_impl(object, [&] { return m_target.get_or_create_object(object->get_name(), merge(object->get_bases())); });
+}
+
+Atom PDDLMerger::merge(const Atom& atom)
+{
+    return merge_impl(atom, [&] { return m_target.get_or_create_atom(merge(atom->get_predicate()), merge(atom->get_terms())); });
+}
+
+Literal PDDLMerger::merge(const Literal& literal)
+{
+    return merge_impl(literal, [&] { return m_target.get_or_create_literal(literal->is_negated(), merge(literal->get_atom())); });
+}
+
+Parameter PDDLMerger::merge(const Parameter& parameter)
+{
+    return merge_impl(parameter, [&] { return m_target.get_or_create_parameter(merge(parameter->get_variable()), merge(parameter->get_bases())); });
+}
+
+Predicate PDDLMerger::merge(const Predicate& predicate)
+{
+    return merge_impl(predicate, [&] { return m_target.get_or_create_predicate(predicate->get_name(), merge(predicate->get_parameters())); });
+}
+
+FunctionExpressionNumber PDDLMerger::merge(const FunctionExpressionNumber& function_expression)
+{
+    return merge_impl(function_expression,
+                      [&] { return get<FunctionExpressionNumber>(m_target.get_or_create_function_expression_number(function_expression->get_number())); });
+}
+
+FunctionExpressionBinaryOperator PDDLMerger::merge(const FunctionExpressionBinaryOperator& function_expression)
+{
+    return merge_impl(function_expression,
+                      [&]
+                      {
+                          return get<FunctionExpressionBinaryOperator>(
+                              m_target.get_or_create_function_expression_binary_operator(function_expression->get_binary_operator(),
+                                                                                          merge(function_expression->get_left_function_expression()),
+                                                                                          merge(function_expression->get_right_function_expression())));
+                      });
+}
+
+FunctionExpressionMultiOperator PDDLMerger::merge(const FunctionExpressionMultiOperator& function_expression)
+{
+    return merge_impl(function_expression,
+                      [&]
+                      {
+                          return get<FunctionExpressionMultiOperator>(
+                              m_target.get_or_create_function_expression_multi_operator(function_expression->get_multi_operator(),
+                                                                                         merge(function_expression->get_function_expressions())));
+                      });
+}
+
+FunctionExpressionMinus PDDLMerger::merge(const FunctionExpressionMinus& function_expression)
+{
+    return merge_impl(function_expression,
+                      [&]
+                      {
+                          return get<FunctionExpressionMinus>(
+                              m_target.get_or_create_function_expression_minus(merge(function_expression->get_function_expression())));
+                      });
+}
+
+FunctionExpressionFunction PDDLMerger::merge(const FunctionExpressionFunction& function_expression)
+{
+    return merge_impl(
+        function_expression,
+        [&] { return get<FunctionExpressionFunction>(m_target.get_or_create_function_expression_function(merge(function_expression->get_function()))); });
+}
+
+FunctionExpression PDDLMerger::merge(const FunctionExpression& function_expression)
+{
+    return visit([this](const auto& arg) -> FunctionExpression { return merge(arg); }, function_expression);
+}
+
+Function PDDLMerger::merge(const Function& function)
+{
+    return merge_impl(function,
+                      [&] { return m_target.get_or_create_function(merge(function->get_function_skeleton()), merge(function->get_terms())); });
+}
+
+FunctionSkeleton PDDLMerger::merge(const FunctionSkeleton& function_skeleton)
+{
+    return merge_impl(function_skeleton,
+                      [&]
+                      {
+                          return m_target.get_or_create_function_skeleton(function_skeleton->get_name(),
+                                                                          merge(function_skeleton->get_parameters()),
+                                                                          merge(function_skeleton->get_type()));
+                      });
+}
+
+ConditionLiteral PDDLMerger::merge(const ConditionLiteral& condition)
+{
+    return merge_impl(condition, [&] { return get<ConditionLiteral>(m_target.get_or_create_condition_literal(merge(condition->get_literal()))); });
+}
+
+ConditionAnd PDDLMerger::merge(const ConditionAnd& condition)
+{
+    return merge_impl(condition, [&] { return get<ConditionAnd>(m_target.get_or_create_condition_and(merge(condition->get_conditions()))); });
+}
+
+ConditionOr PDDLMerger::merge(const ConditionOr& condition)
+{
+    return merge_impl(condition, [&] { return get<ConditionOr>(m_target.get_or_create_condition_or(merge(condition->get_conditions()))); });
+}
+
+ConditionNot PDDLMerger::merge(const ConditionNot& condition)
+{
+    return merge_impl(condition, [&] { return get<ConditionNot>(m_target.get_or_create_condition_not(merge(condition->get_condition()))); });
+}
+
+ConditionImply PDDLMerger::merge(const ConditionImply& condition)
+{
+    return merge_impl(
+        condition,
+        [&]
+        {
+            return get<ConditionImply>(m_target.get_or_create_condition_imply(merge(condition->get_condition_left()), merge(condition->get_condition_right())));
+        });
+}
+
+ConditionExists PDDLMerger::merge(const ConditionExists& condition)
+{
+    return merge_impl(
+        condition,
+        [&]
+        { return get<ConditionExists>(m_target.get_or_create_condition_exists(merge(condition->get_parameters()), merge(condition->get_condition()))); });
+}
+
+ConditionForall PDDLMerger::merge(const ConditionForall& condition)
+{
+    return merge_impl(
+        condition,
+        [&]
+        { return get<ConditionForall>(m_target.get_or_create_condition_forall(merge(condition->get_parameters()), merge(condition->get_condition()))); });
+}
+
+Condition PDDLMerger::merge(const Condition& condition)
+{
+    return visit([this](const auto& arg) -> Condition { return merge(arg); }, condition);
+}
+
+EffectLiteral PDDLMerger::merge(const EffectLiteral& effect)
+{
+    return merge_impl(effect, [&] { return get<EffectLiteral>(m_target.get_or_create_effect_literal(merge(effect->get_literal()))); });
+}
+
+EffectAnd PDDLMerger::merge(const EffectAnd& effect)
+{
+    return merge_impl(effect, [&] { return get<EffectAnd>(m_target.get_or_create_effect_and(merge(effect->get_effects()))); });
+}
+
+EffectNumeric PDDLMerger::merge(const EffectNumeric& effect)
+{
+    return merge_impl(effect,
+                      [&]
+                      {
+                          return get<EffectNumeric>(m_target.get_or_create_effect_numeric(effect->get_assign_operator(),
+                                                                                               merge(effect->get_function()),
+                                                                                               merge(effect->get_function_expression())));
+                      });
+}
+
+EffectConditionalForall PDDLMerger::merge(const EffectConditionalForall& effect)
+{
+    return merge_impl(
+        effect,
+        [&]
+        { return get<EffectConditionalForall>(m_target.get_or_create_effect_conditional_forall(merge(effect->get_parameters()), merge(effect->get_effect()))); });
+}
+
+EffectConditionalWhen PDDLMerger::merge(const EffectConditionalWhen& effect)
+{
+    return merge_impl(
+        effect,
+        [&] { return get<EffectConditionalWhen>(m_target.get_or_create_effect_conditional_when(merge(effect->get_condition()), merge(effect->get_effect()))); });
+}
+
+Effect PDDLMerger::merge(const Effect& effect)
+{
+    return visit([this](const auto& arg) -> Effect { return merge(arg); }, effect);
+}
+
+Action PDDLMerger::merge(const Action& action)
+{
+    return merge_impl(action,
+                      [&]
+                      {
+                          auto parameters = merge(action->get_parameters());
+                          auto condition = std::optional<Condition>();
+                          if (action->get_condition().has_value())
+                          {
+                              condition = merge(action->get_condition().value());
+                          }
+                          auto effect = std::optional<Effect>();
+                          if (action->get_effect().has_value())
+                          {
+                              effect = merge(action->get_effect().value());
+                          }
+                          return m_target.get_or_create_action(action->get_name(), action->get_original_arity(), parameters, condition, effect);
+                      });
+}
+
+Axiom PDDLMerger::merge(const Axiom& axiom)
+{
+    return merge_impl(axiom,
+                      [&]
+                      {
+                          auto parameters = merge(axiom->get_parameters());
+                          auto condition = merge(axiom->get_condition());
+                          return m_target.get_or_create_axiom(axiom->get_derived_predicate_name(), parameters, condition, axiom->get_num_parameters_to_ground_head());
+                      });
+}
+
+OptimizationMetric PDDLMerger::merge(const OptimizationMetric& optimization_metric)
+{
+    return merge_impl(optimization_metric,
+                      [&]
+                      {
+                          return m_target.get_or_create_optimization_metric(optimization_metric->get_optimization_metric(),
+                                                                            merge(optimization_metric->get_function_expression()));
+                      });
+}
+
+NumericFluent PDDLMerger::merge(const NumericFluent& numeric_fluent)
+{
+    return merge_impl(numeric_fluent,
+                      [&] { return m_target.get_or_create_numeric_fluent(merge(numeric_fluent->get_function()), numeric_fluent->get_number()); });
+}
+
+template<typename T>
+void PDDLMerger::merge_positions_impl(const PDDLPositionCache& source_positions, PDDLPositionCache& target_positions) const
+{
+    const auto& merged = std::get<MergedPDDLObjects<T>>(m_merged);
+    auto& target_storage = target_positions.get_storage<T>();
+    source_positions.get_storage<T>().for_each(
+        [&merged, &target_storage](size_t index, const SourcePosition& position)
+        {
+            if (index < merged.index_offset)
+            {
+                target_storage.push_back(index, position);
+                return;
+            }
+            const auto pos = index - merged.index_offset;
+            if (pos < merged.elements.size() && merged.elements[pos])
+            {
+                target_storage.push_back(get_position_index(*merged.elements[pos]), position);
+            }
+        });
+}
+
+void PDDLMerger::merge_positions(const PDDLPositionCache& source_positions, PDDLPositionCache& target_positions) const
+{
+    std::apply(
+        [&](const auto&... merged)
+        { (merge_positions_impl<typename std::decay_t<decltype(merged)>::ElementType>(source_positions, target_positions), ...); },
+        m_merged);
+}
+
+}
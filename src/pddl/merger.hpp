@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOKI_SRC_PDDL_MERGER_HPP_
+#define LOKI_SRC_PDDL_MERGER_HPP_
+
+#include "loki/details/pddl/factories.hpp"
+
+#include <tuple>
+#include <vector>
+
+namespace loki
+{
+
+/// @brief `PDDLMerger` recreates PDDL objects that were created in child factories in the factories that they extend,
+///        e.g., after parts of a file were parsed concurrently into separate child factories.
+///
+///        PDDL objects that were created in the parent factories are returned as is.
+///        PDDL objects of the child factories are recreated once and in the order of the child factories, i.e.,
+///        merging a PDDL object first merges all PDDL objects of the same type that were created before it in the child factories.
+///        Hence, PDDL objects that were parsed concurrently get the same indices as if they were parsed sequentially,
+///        provided that the child factories are merged in the order of the parsed nodes and `merge_remaining` is called for each of them.
+///        The child factories must not be modified while merging.
+class PDDLMerger
+{
+private:
+    // The recreated PDDL objects of type T indexed by their index in the child factories minus the index offset.
+    template<typename T>
+    struct MergedPDDLObjects
+    {
+        using ElementType = T;
+
+        size_t index_offset;
+        std::vector<const T*> elements;
+        // The number of PDDL objects at the start of the child factory that were merged.
+        size_t num_ordered;
+    };
+
+    const PDDLFactories& m_source;
+    PDDLFactories& m_target;
+
+    std::tuple<MergedPDDLObjects<RequirementsImpl>,
+               MergedPDDLObjects<TypeImpl>,
+               MergedPDDLObjects<VariableImpl>,
+               MergedPDDLObjects<TermImpl>,
+               MergedPDDLObjects<ObjectImpl>,
+               MergedPDDLObjects<AtomImpl>,
+               MergedPDDLObjects<LiteralImpl>,
+               MergedPDDLObjects<ParameterImpl>,
+               MergedPDDLObjects<PredicateImpl>,
+               MergedPDDLObjects<FunctionExpressionNumberImpl>,
+               MergedPDDLObjects<FunctionExpressionBinaryOperatorImpl>,
+               MergedPDDLObjects<FunctionExpressionMultiOperatorImpl>,
+               MergedPDDLObjects<FunctionExpressionMinusImpl>,
+               MergedPDDLObjects<FunctionExpressionFunctionImpl>,
+               MergedPDDLObjects<FunctionImpl>,
+               MergedPDDLObjects<FunctionSkeletonImpl>,
+               MergedPDDLObjects<ConditionLiteralImpl>,
+               MergedPDDLObjects<ConditionAndImpl>,
+               MergedPDDLObjects<ConditionOrImpl>,
+               MergedPDDLObjects<ConditionNotImpl>,
+               MergedPDDLObjects<ConditionImplyImpl>,
+               MergedPDDLObjects<ConditionExistsImpl>,
+               MergedPDDLObjects<ConditionForallImpl>,
+               MergedPDDLObjects<EffectLiteralImpl>,
+               MergedPDDLObjects<EffectAndImpl>,
+               MergedPDDLObjects<EffectNumericImpl>,
+               MergedPDDLObjects<EffectConditionalForallImpl>,
+               MergedPDDLObjects<EffectConditionalWhenImpl>,
+               MergedPDDLObjects<ActionImpl>,
+               MergedPDDLObjects<AxiomImpl>,
+               MergedPDDLObjects<OptimizationMetricImpl>,
+               MergedPDDLObjects<NumericFluentImpl>>
+        m_merged;
+
+    template<typename T, typename CreateFunction>
+    const T* merge_impl(const T* element, CreateFunction&& create);
+
+    template<typename T>
+    void merge_remaining_impl();
+
+    template<typename T>
+    void merge_positions_impl(const PDDLPositionCache& source_positions, PDDLPositionCache& target_positions) const;
+
+public:
+    /// @brief Merge PDDL objects of the `source` factories into the `target` factories that `source` extends.
+    PDDLMerger(const PDDLFactories& source, PDDLFactories& target);
+
+    Requirements merge(const Requirements& requirements);
+    Type merge(const Type& type);
+    Variable merge(const Variable& variable);
+    Term merge(const Term& term);
+    Object merge(const Object& object);
+    Atom merge(const Atom& atom);
+    Literal merge(const Literal& literal);
+    Parameter merge(const Parameter& parameter);
+    Predicate merge(const Predicate& predicate);
+    FunctionExpressionNumber merge(const FunctionExpressionNumber& function_expression);
+    FunctionExpressionBinaryOperator merge(const FunctionExpressionBinaryOperator& function_expression);
+    FunctionExpressionMultiOperator merge(const FunctionExpressionMultiOperator& function_expression);
+    FunctionExpressionMinus merge(const FunctionExpressionMinus& function_expression);
+    FunctionExpressionFunction merge(const FunctionExpressionFunction& function_expression);
+    FunctionExpression merge(const FunctionExpression& function_expression);
+    Function merge(const Function& function);
+    FunctionSkeleton merge(const FunctionSkeleton& function_skeleton);
+    ConditionLiteral merge(const ConditionLiteral& condition);
+    ConditionAnd merge(const ConditionAnd& condition);
+    ConditionOr merge(const ConditionOr& condition);
+    ConditionNot merge(const ConditionNot& condition);
+    ConditionImply merge(const ConditionImply& condition);
+    ConditionExists merge(const ConditionExists& condition);
+    ConditionForall merge(const ConditionForall& condition);
+    Condition merge(const Condition& condition);
+    EffectLiteral merge(const EffectLiteral& effect);
+    EffectAnd merge(const EffectAnd& effect);
+    EffectNumeric merge(const EffectNumeric& effect);
+    EffectConditionalForall merge(const EffectConditionalForall& effect);
+    EffectConditionalWhen merge(const EffectConditionalWhen& effect);
+    Effect merge(const Effect& effect);
+    Action merge(const Action& action);
+    Axiom merge(const Axiom& axiom);
+    OptimizationMetric merge(const OptimizationMetric& optimization_metric);
+    NumericFluent merge(const NumericFluent& numeric_fluent);
+
+    template<typename T>
+    std::vector<T> merge(const std::vector<T>& elements)
+    {
+        auto result = std::vector<T>();
+        result.reserve(elements.size());
+        for (const auto& element : elements)
+        {
+            result.push_back(merge(element));
+        }
+        return result;
+    }
+
+    /// @brief Merge the PDDL objects of the child factories that were not merged yet, e.g., unused parameters that were removed from an action.
+    void merge_remaining();
+
+    /// @brief Copy the positions of the `source_positions` to the `target_positions`.
+    ///        Positions of PDDL objects of the child factories that were not merged are dropped.
+    void merge_positions(const PDDLPositionCache& source_positions, PDDLPositionCache& target_positions) const;
+};
+
+}
+
+#endif
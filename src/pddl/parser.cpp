@@ -24,6 +24,8 @@
 #include "loki/details/pddl/parameter.hpp"
 #include "loki/details/pddl/predicate.hpp"
 #include "loki/details/pddl/type.hpp"
+#include "loki/details/utils/thread_pool.hpp"
+#include "merger.hpp"
 #include "parser/common.hpp"
 #include "parser/constants.hpp"
 #include "parser/error_handling.hpp"
@@ -45,7 +47,105 @@ using namespace std;
 namespace loki
 {
 
-Domain parse(const fs::path& filepath, const ast::Domain& domain_node, Context& context)
+/// @brief The results of parsing a contiguous range of nodes into child factories.
+template<typename Result>
+struct ChunkResults
+{
+    std::unique_ptr<PDDLFactories> factories;
+    std::unique_ptr<PDDLPositionCache> positions;
+    ReferencedPDDLObjects references;
+    // The diagnostics of the chunk if the context has a diagnostic sink and nullptr otherwise.
+    std::unique_ptr<DiagnosticSink> diagnostics;
+    // std::nullopt for each node that was skipped after an error.
+    std::vector<std::optional<Result>> results;
+};
+
+template<typename Result, typename Iterator, typename ParseFunction>
+static ChunkResults<Result> parse_chunk(Iterator first, Iterator last, const Context& context, const ParseFunction& parse_function)
+{
+    auto chunk = ChunkResults<Result> { std::make_unique<PDDLFactories>(&context.factories),
+                                        std::make_unique<PDDLPositionCache>(context.positions.get_shared_error_handler()),
+                                        ReferencedPDDLObjects(),
+                                        nullptr,
+                                        {} };
+    if (context.diagnostics)
+    {
+        // One more than the remaining capacity such that the diagnostic that fills the sink of the context is kept when the chunk stops.
+        chunk.diagnostics =
+            std::make_unique<DiagnosticSink>(context.diagnostics->get_max_num_diagnostics() - context.diagnostics->get_diagnostics().size() + 1);
+    }
+    auto scopes = ScopeStack(chunk.positions->get_error_handler(), &context.scopes);
+    auto chunk_context = Context(*chunk.factories, *chunk.positions, scopes, context.strict, context.quiet, chunk.diagnostics.get());
+    chunk_context.references = context.references;
+    chunk_context.requirements = context.requirements;
+    scopes.open_scope();
+    chunk.results.reserve(std::distance(first, last));
+    try
+    {
+        for (auto it = first; it != last; ++it)
+        {
+            chunk.results.push_back(parse_or_skip(chunk_context, [&] { return parse_function(*it, chunk_context); }));
+        }
+    }
+    catch (const DiagnosticLimitSignal&)
+    {
+        // The sink of the context overflows when the diagnostics of the chunk are added.
+    }
+    chunk.references = std::move(chunk_context.references);
+    return chunk;
+}
+
+/// @brief Parses the nodes in contiguous chunks, one per worker thread, into child factories.
+///        The results are merged into the factories of the `context` and passed to `merge_function` in the order of the nodes
+///        such that the result depends neither on the scheduling nor on the number of threads.
+///        If parsing fails, then the exception of the first failing chunk is rethrown.
+///        If the `context` has a diagnostic sink, then each chunk records into its own sink, skips nodes after errors as `parse_or_skip`,
+///        and its diagnostics are added to the sink of the `context` in the order of the nodes.
+template<typename Node, typename ParseFunction, typename MergeFunction>
+static void parse_concurrently(const std::vector<Node>& nodes, Context& context, size_t num_threads, const ParseFunction& parse_function, const MergeFunction& merge_function)
+{
+    using Result = std::invoke_result_t<ParseFunction, const Node&, Context&>;
+
+    auto futures = std::vector<std::future<ChunkResults<Result>>>();
+    {
+        auto thread_pool = ThreadPool(num_threads);
+        const auto num_chunks = std::min(thread_pool.size(), nodes.size());
+        for (size_t i = 0; i < num_chunks; ++i)
+        {
+            const auto first = nodes.begin() + i * nodes.size() / num_chunks;
+            const auto last = nodes.begin() + (i + 1) * nodes.size() / num_chunks;
+            futures.push_back(thread_pool.submit([first, last, &context, &parse_function] { return parse_chunk<Result>(first, last, context, parse_function); }));
+        }
+    }
+    // The parent factories must not be modified before all workers finished.
+    for (auto& future : futures)
+    {
+        const auto chunk = future.get();
+        auto merger = PDDLMerger(*chunk.factories, context.factories);
+        for (const auto& result : chunk.results)
+        {
+            if (result.has_value())
+            {
+                merge_function(merger, result.value());
+            }
+        }
+        merger.merge_remaining();
+        merger.merge_positions(*chunk.positions, context.positions);
+        context.references.intersect(chunk.references);
+        if (chunk.diagnostics)
+        {
+            for (const auto& diagnostic : chunk.diagnostics->get_diagnostics())
+            {
+                if (!context.diagnostics->add(diagnostic))
+                {
+                    throw DiagnosticLimitSignal();
+                }
+            }
+        }
+    }
+}
+
+Domain parse(const fs::path& filepath, const ast::Domain& domain_node, Context& context, size_t num_threads, const LazyActionBodyFunction& lazy_action_body)
 {
     const auto domain_name = parse(domain_node.domain_name.name);
     /* Requirements section */
@@ -66,11 +166,8 @@ Domain parse(const fs::path& filepath, const ast::Domain& domain_node, Context&
     auto types = TypeList();
     if (domain_node.types.has_value())
     {
-        if (!context.requirements->test(RequirementEnum::TYPING))
-        {
-            throw UndefinedRequirementError(RequirementEnum::TYPING, context.scopes.top().get_error_handler()(domain_node.types.value(), ""));
-        }
-        types = parse(domain_node.types.value(), context);
+        test_undefined_requirement(RequirementEnum::TYPING, domain_node.types.value(), context);
+        types = parse_or_skip(context, [&] { return parse(domain_node.types.value(), context); }).value_or(TypeList {});
     }
     /* Constants section */
     auto constants = ObjectList();
@@ -95,14 +192,52 @@ Domain parse(const fs::path& filepath, const ast::Domain& domain_node, Context&
     /* Structure section */
     auto axiom_list = AxiomList();
     auto action_list = ActionList();
-    for (const auto& structure_node : domain_node.structures)
+    if (lazy_action_body)
     {
-        auto variant = boost::apply_visitor(StructureVisitor(context), structure_node);
-        boost::apply_visitor(UnpackingVisitor(action_list, axiom_list), variant);
+        for (const auto& structure_node : domain_node.structures)
+        {
+            if (const auto action_node = boost::get<ast::Action>(&structure_node.get()))
+            {
+                if (const auto action = parse_or_skip(context, [&] { return parse(*action_node, context, lazy_action_body(*action_node)); }))
+                {
+                    action_list.push_back(action.value());
+                }
+            }
+            else if (const auto axiom = parse_or_skip(context, [&] { return parse(boost::get<ast::Axiom>(structure_node.get()), context); }))
+            {
+                axiom_list.push_back(axiom.value());
+            }
+        }
+    }
+    else if (num_threads == 1)
+    {
+        for (const auto& structure_node : domain_node.structures)
+        {
+            if (const auto variant = parse_or_skip(context, [&] { return boost::apply_visitor(StructureVisitor(context), structure_node); }))
+            {
+                boost::apply_visitor(UnpackingVisitor(action_list, axiom_list), variant.value());
+            }
+        }
+    }
+    else
+    {
+        parse_concurrently(
+            domain_node.structures,
+            context,
+            num_threads,
+            [](const ast::Structure& node, Context& structure_context) { return boost::apply_visitor(StructureVisitor(structure_context), node); },
+            [&action_list, &axiom_list](PDDLMerger& merger, const boost::variant<Axiom, Action>& structure)
+            {
+                auto variant = boost::apply_visitor([&merger](const auto& arg) -> boost::variant<Axiom, Action> { return merger.merge(arg); }, structure);
+                boost::apply_visitor(UnpackingVisitor(action_list, axiom_list), variant);
+            });
+    }
+    // Check references, which are only known if the conditions and effects were parsed.
+    if (!lazy_action_body)
+    {
+        test_predicate_references(predicates, context);
+        test_function_skeleton_references(function_skeletons, context);
     }
-    // Check references
-    test_predicate_references(predicates, context);
-    test_function_skeleton_references(function_skeletons, context);
 
     const auto domain =
         context.factories.get_or_create_domain(filepath, domain_name, requirements, types, constants, predicates, function_skeletons, action_list, axiom_list);
@@ -110,14 +245,11 @@ Domain parse(const fs::path& filepath, const ast::Domain& domain_node, Context&
     return domain;
 }
 
-Problem parse(const fs::path& filepath, const ast::Problem& problem_node, Context& context, const Domain& domain)
+Problem parse(const fs::path& filepath, const ast::Problem& problem_node, Context& context, const Domain& domain, size_t num_threads)
 {
     /* Domain name section */
     const auto domain_name = parse(problem_node.domain_name.name);
-    if (domain_name != domain->get_name())
-    {
-        throw MismatchedDomainError(domain, domain_name, context.scopes.top().get_error_handler()(problem_node.domain_name, ""));
-    }
+    test_mismatched_domain(domain, domain_name, problem_node.domain_name, context);
 
     /* Problem name section */
     const auto problem_name = parse(problem_node.problem_name.name);
@@ -163,10 +295,26 @@ Problem parse(const fs::path& filepath, const ast::Problem& problem_node, Contex
     auto numeric_fluents = NumericFluentList();
     if (problem_node.initial.has_value())
     {
-        const auto initial_elements = parse(problem_node.initial.value(), context);
-        for (const auto& initial_element : initial_elements)
+        if (num_threads == 1)
+        {
+            const auto initial_elements = parse(problem_node.initial.value(), context);
+            for (const auto& initial_element : initial_elements)
+            {
+                std::visit(UnpackingVisitor(initial_literals, numeric_fluents), initial_element);
+            }
+        }
+        else
         {
-            std::visit(UnpackingVisitor(initial_literals, numeric_fluents), initial_element);
+            parse_concurrently(
+                problem_node.initial.value().initial_elements,
+                context,
+                num_threads,
+                [](const ast::InitialElement& node, Context& initial_context) { return boost::apply_visitor(InitialElementVisitor(initial_context), node); },
+                [&initial_literals, &numeric_fluents](PDDLMerger& merger, const std::variant<Literal, NumericFluent>& initial_element)
+                {
+                    auto visitor = UnpackingVisitor(initial_literals, numeric_fluents);
+                    std::visit([&merger, &visitor](const auto& arg) { visitor(merger.merge(arg)); }, initial_element);
+                });
         }
     }
 
@@ -174,14 +322,14 @@ Problem parse(const fs::path& filepath, const ast::Problem& problem_node, Contex
     auto goal_condition = std::optional<Condition>();
     if (problem_node.goal.has_value())
     {
-        goal_condition = parse(problem_node.goal.value(), context);
+        goal_condition = parse_or_skip(context, [&] { return parse(problem_node.goal.value(), context); });
     }
 
     /* Metric section */
     auto optimization_metric = std::optional<OptimizationMetric>();
     if (problem_node.metric_specification.has_value())
     {
-        optimization_metric = parse(problem_node.metric_specification.value(), context);
+        optimization_metric = parse_or_skip(context, [&] { return parse(problem_node.metric_specification.value(), context); });
     }
 
     // Check references
@@ -194,7 +342,10 @@ Problem parse(const fs::path& filepath, const ast::Problem& problem_node, Contex
     {
         for (const auto& axiom_node : problem_node.axioms.value())
         {
-            axioms.push_back(parse(axiom_node, context));
+            if (const auto axiom = parse_or_skip(context, [&] { return parse(axiom_node, context); }))
+            {
+                axioms.push_back(axiom.value());
+            }
         }
     }
 
@@ -25,21 +25,337 @@
 #include "parameters.hpp"
 #include "reference_utils.hpp"
 
+#include <optional>
+#include <utility>
+#include <variant>
+#include <vector>
+
 namespace loki
 {
-// parse a vector of goal descriptors
-template<typename T>
-static ConditionList parse(const std::vector<T>& nodes, Context& context)
+namespace
 {
-    auto condition_list = ConditionList();
-    for (const auto& node : nodes)
+/// @brief `NestedConditionParser` parses nested goal descriptors with an explicit stack of frames instead of recursing once per level
+///        of nesting, such that deeply nested goals and preconditions do not overflow the native stack.
+///
+///        Each frame holds an inner node of the formula, i.e., a connective or a quantifier, and the conditions of its children
+///        that were parsed so far. Leaves are parsed directly. Children of conjunctions and disjunctions that are skipped
+///        after an error are dropped, the same as with `parse_or_skip`.
+class NestedConditionParser
+{
+private:
+    using InnerNode = std::variant<const ast::GoalDescriptorAnd*,
+                                   const ast::GoalDescriptorOr*,
+                                   const ast::GoalDescriptorNot*,
+                                   const ast::GoalDescriptorImply*,
+                                   const ast::GoalDescriptorExists*,
+                                   const ast::GoalDescriptorForall*,
+                                   const ast::PreconditionGoalDescriptorAnd*,
+                                   const ast::PreconditionGoalDescriptorForall*>;
+
+    struct Frame
+    {
+        InnerNode node;
+        bool is_skippable;
+        size_t num_visited_children;
+        ConditionList children;
+        ParameterList parameter_list;
+    };
+
+    Context& m_context;
+    std::vector<Frame> m_frames;
+    // The number of frames below each skippable child and the state to restore if it is skipped.
+    std::vector<std::pair<size_t, SkipPoint>> m_skip_points;
+    std::optional<Condition> m_result;
+
+    /* Visit nodes */
+
+    void visit(const ast::GoalDescriptor& node, bool is_skippable)
+    {
+        if (is_skippable)
+        {
+            m_skip_points.emplace_back(m_frames.size(), SkipPoint(m_context));
+        }
+        begin(node, is_skippable);
+    }
+
+    void visit(const ast::PreconditionGoalDescriptor& node, bool is_skippable)
+    {
+        if (is_skippable)
+        {
+            m_skip_points.emplace_back(m_frames.size(), SkipPoint(m_context));
+        }
+        begin(node, is_skippable);
+    }
+
+    void begin(const ast::GoalDescriptor& node, bool is_skippable)
+    {
+        boost::apply_visitor([&](const auto& child_node) { begin(child_node, is_skippable); }, node);
+    }
+
+    void begin(const ast::PreconditionGoalDescriptor& node, bool is_skippable)
+    {
+        boost::apply_visitor([&](const auto& child_node) { begin(child_node, is_skippable); }, node);
+    }
+
+    template<typename Node>
+    void begin(const boost::spirit::x3::forward_ast<Node>& node, bool is_skippable)
+    {
+        begin(node.get(), is_skippable);
+    }
+
+    void begin(const ast::PreconditionGoalDescriptorSimple& node, bool is_skippable) { begin(node.goal_descriptor, is_skippable); }
+
+    template<typename Node>
+    void begin(const Node& node, bool is_skippable)
+    {
+        if constexpr (std::is_constructible_v<InnerNode, const Node*>)
+        {
+            m_frames.push_back(Frame { &node, is_skippable, 0, ConditionList(), ParameterList() });
+            enter(node, m_frames.back());
+        }
+        else
+        {
+            finish(loki::parse(node, m_context), is_skippable);
+        }
+    }
+
+    void finish(Condition condition, bool is_skippable)
+    {
+        if (is_skippable)
+        {
+            m_skip_points.pop_back();
+        }
+        if (m_frames.empty())
+        {
+            m_result = condition;
+        }
+        else
+        {
+            m_frames.back().children.push_back(condition);
+        }
+    }
+
+    /* Enter inner nodes */
+
+    void enter(const ast::GoalDescriptorAnd&, Frame&) {}
+
+    void enter(const ast::GoalDescriptorOr& node, Frame&)
+    {
+        // requires :disjunctive-preconditions
+        test_undefined_requirement(RequirementEnum::DISJUNCTIVE_PRECONDITIONS, node, m_context);
+        m_context.references.untrack(RequirementEnum::DISJUNCTIVE_PRECONDITIONS);
+    }
+
+    void enter(const ast::GoalDescriptorNot& node, Frame&)
+    {
+        // requires :disjunctive-preconditions
+        test_undefined_requirement(RequirementEnum::NEGATIVE_PRECONDITIONS, node, m_context);
+        m_context.references.untrack(RequirementEnum::NEGATIVE_PRECONDITIONS);
+    }
+
+    void enter(const ast::GoalDescriptorImply& node, Frame&)
+    {
+        test_undefined_requirement(RequirementEnum::DISJUNCTIVE_PRECONDITIONS, node, m_context);
+        m_context.references.untrack(RequirementEnum::DISJUNCTIVE_PRECONDITIONS);
+    }
+
+    void enter(const ast::GoalDescriptorExists& node, Frame& frame)
     {
-        condition_list.push_back(parse(node, context));
+        test_undefined_requirement(RequirementEnum::EXISTENTIAL_PRECONDITIONS, node, m_context);
+        m_context.references.untrack(RequirementEnum::EXISTENTIAL_PRECONDITIONS);
+        enter_quantifier(node.typed_list_of_variables, frame);
     }
-    return condition_list;
+
+    void enter(const ast::GoalDescriptorForall& node, Frame& frame)
+    {
+        test_undefined_requirement(RequirementEnum::UNIVERSAL_PRECONDITIONS, node, m_context);
+        m_context.references.untrack(RequirementEnum::UNIVERSAL_PRECONDITIONS);
+        enter_quantifier(node.typed_list_of_variables, frame);
+    }
+
+    void enter(const ast::PreconditionGoalDescriptorAnd&, Frame&) {}
+
+    void enter(const ast::PreconditionGoalDescriptorForall& node, Frame& frame)
+    {
+        test_undefined_requirement(RequirementEnum::UNIVERSAL_PRECONDITIONS, node, m_context);
+        m_context.references.untrack(RequirementEnum::UNIVERSAL_PRECONDITIONS);
+        enter_quantifier(node.typed_list_of_variables, frame);
+    }
+
+    void enter_quantifier(const ast::TypedListOfVariables& parameters_node, Frame& frame)
+    {
+        m_context.scopes.open_scope();
+        frame.parameter_list = boost::apply_visitor(ParameterListVisitor(m_context), parameters_node);
+        track_variable_references(frame.parameter_list, m_context);
+    }
+
+    /* Visit the next child of inner nodes */
+
+    template<typename Node>
+    bool visit_next_child(const std::vector<Node>& child_nodes, Frame& frame)
+    {
+        if (frame.num_visited_children == child_nodes.size())
+        {
+            return false;
+        }
+        visit(child_nodes[frame.num_visited_children++], true);
+        return true;
+    }
+
+    template<typename Node>
+    bool visit_next_child(const Node& child_node, Frame& frame)
+    {
+        if (frame.num_visited_children == 1)
+        {
+            return false;
+        }
+        ++frame.num_visited_children;
+        visit(child_node, false);
+        return true;
+    }
+
+    bool visit_next_child(const ast::GoalDescriptorAnd& node, Frame& frame) { return visit_next_child(node.goal_descriptors, frame); }
+
+    bool visit_next_child(const ast::GoalDescriptorOr& node, Frame& frame) { return visit_next_child(node.goal_descriptors, frame); }
+
+    bool visit_next_child(const ast::GoalDescriptorNot& node, Frame& frame) { return visit_next_child(node.goal_descriptor, frame); }
+
+    bool visit_next_child(const ast::GoalDescriptorImply& node, Frame& frame)
+    {
+        if (frame.num_visited_children == 2)
+        {
+            return false;
+        }
+        visit((frame.num_visited_children++ == 0) ? node.goal_descriptor_left : node.goal_descriptor_right, false);
+        return true;
+    }
+
+    bool visit_next_child(const ast::GoalDescriptorExists& node, Frame& frame) { return visit_next_child(node.goal_descriptor, frame); }
+
+    bool visit_next_child(const ast::GoalDescriptorForall& node, Frame& frame) { return visit_next_child(node.goal_descriptor, frame); }
+
+    bool visit_next_child(const ast::PreconditionGoalDescriptorAnd& node, Frame& frame)
+    {
+        return visit_next_child(node.precondition_goal_descriptors, frame);
+    }
+
+    bool visit_next_child(const ast::PreconditionGoalDescriptorForall& node, Frame& frame)
+    {
+        return visit_next_child(node.precondition_goal_descriptor, frame);
+    }
+
+    /* Exit inner nodes */
+
+    Condition exit(const ast::GoalDescriptorAnd& node, Frame& frame)
+    {
+        const auto condition = m_context.factories.get_or_create_condition_and(frame.children);
+        m_context.positions.push_back(condition, node);
+        return condition;
+    }
+
+    Condition exit(const ast::GoalDescriptorOr& node, Frame& frame)
+    {
+        const auto condition = m_context.factories.get_or_create_condition_or(frame.children);
+        m_context.positions.push_back(condition, node);
+        return condition;
+    }
+
+    Condition exit(const ast::GoalDescriptorNot& node, Frame& frame)
+    {
+        const auto condition = m_context.factories.get_or_create_condition_not(frame.children.front());
+        m_context.positions.push_back(condition, node);
+        return condition;
+    }
+
+    Condition exit(const ast::GoalDescriptorImply& node, Frame& frame)
+    {
+        const auto condition = m_context.factories.get_or_create_condition_imply(frame.children.at(0), frame.children.at(1));
+        m_context.positions.push_back(condition, node);
+        return condition;
+    }
+
+    Condition exit(const ast::GoalDescriptorExists& node, Frame& frame)
+    {
+        test_variable_references(frame.parameter_list, m_context);
+        m_context.scopes.close_scope();
+        const auto condition = m_context.factories.get_or_create_condition_exists(frame.parameter_list, frame.children.front());
+        m_context.positions.push_back(condition, node);
+        return condition;
+    }
+
+    Condition exit(const ast::GoalDescriptorForall& node, Frame& frame) { return exit_forall(node.goal_descriptor, frame); }
+
+    Condition exit(const ast::PreconditionGoalDescriptorAnd& node, Frame& frame)
+    {
+        const auto condition = m_context.factories.get_or_create_condition_and(frame.children);
+        m_context.positions.push_back(condition, node);
+        return condition;
+    }
+
+    Condition exit(const ast::PreconditionGoalDescriptorForall& node, Frame& frame) { return exit_forall(node.precondition_goal_descriptor, frame); }
+
+    template<typename ConditionNode>
+    Condition exit_forall(const ConditionNode& condition_node, Frame& frame)
+    {
+        test_variable_references(frame.parameter_list, m_context);
+        m_context.scopes.close_scope();
+        const auto condition = m_context.factories.get_or_create_condition_forall(frame.parameter_list, frame.children.front());
+        m_context.positions.push_back(condition, condition_node);
+        return condition;
+    }
+
+    /* Drive the parse */
+
+    void step()
+    {
+        auto& frame = m_frames.back();
+        if (std::visit([&](const auto* node) { return visit_next_child(*node, frame); }, frame.node))
+        {
+            return;
+        }
+        const auto condition = std::visit([&](const auto* node) { return exit(*node, frame); }, frame.node);
+        const auto is_skippable = frame.is_skippable;
+        m_frames.pop_back();
+        finish(condition, is_skippable);
+    }
+
+    template<typename Function>
+    void run_or_skip(Function&& function)
+    {
+        try
+        {
+            function();
+        }
+        catch (const SkipStructureSignal&)
+        {
+            if (m_skip_points.empty())
+            {
+                throw;
+            }
+            const auto [num_frames, skip_point] = m_skip_points.back();
+            m_skip_points.pop_back();
+            m_frames.erase(m_frames.begin() + num_frames, m_frames.end());
+            skip_point.restore(m_context);
+        }
+    }
+
+public:
+    explicit NestedConditionParser(Context& context) : m_context(context), m_frames(), m_skip_points(), m_result() {}
+
+    template<typename Node>
+    Condition parse(const Node& node)
+    {
+        run_or_skip([&] { begin(node, false); });
+        while (!m_result.has_value())
+        {
+            run_or_skip([&] { step(); });
+        }
+        return m_result.value();
+    }
+};
 }
 
-Condition parse(const ast::GoalDescriptor& node, Context& context) { return boost::apply_visitor(ConditionVisitor(context), node); }
+Condition parse(const ast::GoalDescriptor& node, Context& context) { return NestedConditionParser(context).parse(node); }
 
 Condition parse(const ast::GoalDescriptorAtom& node, Context& context)
 {
@@ -58,61 +374,15 @@ Condition parse(const ast::GoalDescriptorLiteral& node, Context& context)
     return condition;
 }
 
-Condition parse(const ast::GoalDescriptorAnd& node, Context& context)
-{
-    auto condition_list = parse(node.goal_descriptors, context);
-    const auto condition = context.factories.get_or_create_condition_and(condition_list);
-    context.positions.push_back(condition, node);
-    return condition;
-}
+Condition parse(const ast::GoalDescriptorAnd& node, Context& context) { return NestedConditionParser(context).parse(node); }
 
-Condition parse(const ast::GoalDescriptorOr& node, Context& context)
-{
-    // requires :disjunctive-preconditions
-    test_undefined_requirement(RequirementEnum::DISJUNCTIVE_PRECONDITIONS, node, context);
-    context.references.untrack(RequirementEnum::DISJUNCTIVE_PRECONDITIONS);
-    auto condition_list = parse(node.goal_descriptors, context);
-    const auto condition = context.factories.get_or_create_condition_or(condition_list);
-    context.positions.push_back(condition, node);
-    return condition;
-}
+Condition parse(const ast::GoalDescriptorOr& node, Context& context) { return NestedConditionParser(context).parse(node); }
 
-Condition parse(const ast::GoalDescriptorNot& node, Context& context)
-{
-    // requires :disjunctive-preconditions
-    test_undefined_requirement(RequirementEnum::NEGATIVE_PRECONDITIONS, node, context);
-    context.references.untrack(RequirementEnum::NEGATIVE_PRECONDITIONS);
-    auto child_condition = parse(node.goal_descriptor, context);
-    const auto condition = context.factories.get_or_create_condition_not(child_condition);
-    context.positions.push_back(condition, node);
-    return condition;
-}
+Condition parse(const ast::GoalDescriptorNot& node, Context& context) { return NestedConditionParser(context).parse(node); }
 
-Condition parse(const ast::GoalDescriptorImply& node, Context& context)
-{
-    test_undefined_requirement(RequirementEnum::DISJUNCTIVE_PRECONDITIONS, node, context);
-    context.references.untrack(RequirementEnum::DISJUNCTIVE_PRECONDITIONS);
-    auto condition_left = parse(node.goal_descriptor_left, context);
-    auto condition_right = parse(node.goal_descriptor_right, context);
-    const auto condition = context.factories.get_or_create_condition_imply(condition_left, condition_right);
-    context.positions.push_back(condition, node);
-    return condition;
-}
+Condition parse(const ast::GoalDescriptorImply& node, Context& context) { return NestedConditionParser(context).parse(node); }
 
-Condition parse(const ast::GoalDescriptorExists& node, Context& context)
-{
-    test_undefined_requirement(RequirementEnum::EXISTENTIAL_PRECONDITIONS, node, context);
-    context.references.untrack(RequirementEnum::EXISTENTIAL_PRECONDITIONS);
-    context.scopes.open_scope();
-    auto parameter_list = boost::apply_visitor(ParameterListVisitor(context), node.typed_list_of_variables);
-    track_variable_references(parameter_list, context);
-    auto child_condition = parse(node.goal_descriptor, context);
-    test_variable_references(parameter_list, context);
-    context.scopes.close_scope();
-    auto condition = context.factories.get_or_create_condition_exists(parameter_list, child_condition);
-    context.positions.push_back(condition, node);
-    return condition;
-}
+Condition parse(const ast::GoalDescriptorExists& node, Context& context) { return NestedConditionParser(context).parse(node); }
 
 template<typename ConditionNode>
 Condition parse_condition_forall(const ast::TypedListOfVariables& parameters_node, const ConditionNode& condition_node, Context& context)
@@ -128,12 +398,7 @@ Condition parse_condition_forall(const ast::TypedListOfVariables& parameters_nod
     return condition;
 }
 
-Condition parse(const ast::GoalDescriptorForall& node, Context& context)
-{
-    test_undefined_requirement(RequirementEnum::UNIVERSAL_PRECONDITIONS, node, context);
-    context.references.untrack(RequirementEnum::UNIVERSAL_PRECONDITIONS);
-    return parse_condition_forall(node.typed_list_of_variables, node.goal_descriptor, context);
-}
+Condition parse(const ast::GoalDescriptorForall& node, Context& context) { return NestedConditionParser(context).parse(node); }
 
 Condition parse(const ast::GoalDescriptorFunctionComparison& node, Context& context)
 {
@@ -215,21 +480,11 @@ Condition parse(const ast::ConstraintGoalDescriptorHoldAfter& /*node*/, Context&
     throw NotImplementedError("parse(const ast::ConstraintGoalDescriptorHoldAfter& node, Context& context)");
 }
 
-Condition parse(const ast::PreconditionGoalDescriptor& node, Context& context) { return boost::apply_visitor(ConditionVisitor(context), node); }
+Condition parse(const ast::PreconditionGoalDescriptor& node, Context& context) { return NestedConditionParser(context).parse(node); }
 
-Condition parse(const ast::PreconditionGoalDescriptorSimple& node, Context& context) { return parse(node.goal_descriptor, context); }
+Condition parse(const ast::PreconditionGoalDescriptorSimple& node, Context& context) { return NestedConditionParser(context).parse(node); }
 
-Condition parse(const ast::PreconditionGoalDescriptorAnd& node, Context& context)
-{
-    auto condition_list = ConditionList();
-    for (const auto& child_node : node.precondition_goal_descriptors)
-    {
-        condition_list.push_back(parse(child_node, context));
-    }
-    const auto condition = context.factories.get_or_create_condition_and(condition_list);
-    context.positions.push_back(condition, node);
-    return condition;
-}
+Condition parse(const ast::PreconditionGoalDescriptorAnd& node, Context& context) { return NestedConditionParser(context).parse(node); }
 
 Condition parse(const ast::PreconditionGoalDescriptorPreference& node, Context& context)
 {
@@ -237,12 +492,7 @@ Condition parse(const ast::PreconditionGoalDescriptorPreference& node, Context&
     throw NotImplementedError("parse(const ast::PreconditionGoalDescriptorPreference& node, Context& context)");
 }
 
-Condition parse(const ast::PreconditionGoalDescriptorForall& node, Context& context)
-{
-    test_undefined_requirement(RequirementEnum::UNIVERSAL_PRECONDITIONS, node, context);
-    context.references.untrack(RequirementEnum::UNIVERSAL_PRECONDITIONS);
-    return parse_condition_forall(node.typed_list_of_variables, node.precondition_goal_descriptor, context);
-}
+Condition parse(const ast::PreconditionGoalDescriptorForall& node, Context& context) { return NestedConditionParser(context).parse(node); }
 
 ConditionVisitor::ConditionVisitor(Context& context_) : context(context_) {}
 
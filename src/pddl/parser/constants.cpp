@@ -46,7 +46,10 @@ static ObjectList parse_constant_definitions(const std::vector<ast::Name>& nodes
     auto constant_list = ObjectList();
     for (const auto& node : nodes)
     {
-        constant_list.push_back(parse_constant_definition(node, type_list, context));
+        if (const auto constant = parse_or_skip(context, [&] { return parse_constant_definition(node, type_list, context); }))
+        {
+            constant_list.push_back(constant.value());
+        }
     }
     return constant_list;
 }
@@ -70,8 +73,11 @@ ObjectList ConstantListVisitor::operator()(const ast::TypedListOfNamesRecursivel
 {
     test_undefined_requirement(RequirementEnum::TYPING, typed_list_of_names_recursively_node, context);
     context.references.untrack(RequirementEnum::TYPING);
-    const auto type_list = boost::apply_visitor(TypeReferenceTypeVisitor(context), typed_list_of_names_recursively_node.type);
-    // TypedListOfNamesRecursively has user defined base types
+    // TypedListOfNamesRecursively has user defined base types.
+    // If they are undefined, we continue with base type "object" to avoid follow-up errors of undefined constants.
+    const auto type_list = parse_or_skip(context,
+                                         [&] { return boost::apply_visitor(TypeReferenceTypeVisitor(context), typed_list_of_names_recursively_node.type); })
+                               .value_or(TypeList { std::get<0>(context.scopes.top().get_type("object").value()) });
     auto constant_list = parse_constant_definitions(typed_list_of_names_recursively_node.names, type_list, context);
     // Recursively add objects.
     auto additional_objects = boost::apply_visitor(*this, typed_list_of_names_recursively_node.typed_list_of_names.get());
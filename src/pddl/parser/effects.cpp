@@ -26,9 +26,234 @@
 #include "parameters.hpp"
 #include "reference_utils.hpp"
 
+#include <optional>
+#include <utility>
+#include <variant>
+#include <vector>
+
 namespace loki
 {
 
+namespace
+{
+/// @brief `NestedEffectParser` parses nested effects with an explicit stack of frames instead of recursing once per level of nesting,
+///        such that deeply nested effects do not overflow the native stack. Conditions of conditional effects are parsed
+///        with the `NestedConditionParser`, see conditions.cpp.
+///
+///        Each frame holds a conjunction, a conditional effect, or a quantified effect, and the effects of its children that
+///        were parsed so far. Productions are parsed directly. Children of conjunctions that are skipped after an error are dropped,
+///        the same as with `parse_or_skip`.
+class NestedEffectParser
+{
+private:
+    using InnerNode =
+        std::variant<const std::vector<ast::Effect>*, const ast::EffectConditional*, const ast::EffectConditionalForall*, const ast::EffectConditionalWhen*>;
+
+    struct Frame
+    {
+        InnerNode node;
+        bool is_skippable;
+        size_t num_visited_children;
+        EffectList children;
+        ParameterList parameter_list;
+        std::optional<Condition> condition;
+    };
+
+    Context& m_context;
+    std::vector<Frame> m_frames;
+    // The number of frames below each skippable child and the state to restore if it is skipped.
+    std::vector<std::pair<size_t, SkipPoint>> m_skip_points;
+    std::optional<Effect> m_result;
+
+    /* Visit nodes */
+
+    void visit(const ast::Effect& node, bool is_skippable)
+    {
+        if (is_skippable)
+        {
+            m_skip_points.emplace_back(m_frames.size(), SkipPoint(m_context));
+        }
+        begin(node, is_skippable);
+    }
+
+    void begin(const ast::Effect& node, bool is_skippable)
+    {
+        boost::apply_visitor([&](const auto& child_node) { begin(child_node, is_skippable); }, node);
+    }
+
+    template<typename Node>
+    void begin(const boost::spirit::x3::forward_ast<Node>& node, bool is_skippable)
+    {
+        begin(node.get(), is_skippable);
+    }
+
+    template<typename Node>
+    void begin(const Node& node, bool is_skippable)
+    {
+        if constexpr (std::is_constructible_v<InnerNode, const Node*>)
+        {
+            m_frames.push_back(Frame { &node, is_skippable, 0, EffectList(), ParameterList(), std::nullopt });
+            enter(node, m_frames.back());
+        }
+        else
+        {
+            finish(loki::parse(node, m_context), is_skippable);
+        }
+    }
+
+    void finish(Effect effect, bool is_skippable)
+    {
+        if (is_skippable)
+        {
+            m_skip_points.pop_back();
+        }
+        if (m_frames.empty())
+        {
+            m_result = effect;
+        }
+        else
+        {
+            m_frames.back().children.push_back(effect);
+        }
+    }
+
+    /* Enter inner nodes */
+
+    void enter(const std::vector<ast::Effect>&, Frame&) {}
+
+    void enter(const ast::EffectConditional& node, Frame&)
+    {
+        test_undefined_requirement(RequirementEnum::CONDITIONAL_EFFECTS, node, m_context);
+        m_context.references.untrack(RequirementEnum::CONDITIONAL_EFFECTS);
+    }
+
+    void enter(const ast::EffectConditionalForall& node, Frame& frame)
+    {
+        m_context.scopes.open_scope();
+        frame.parameter_list = boost::apply_visitor(ParameterListVisitor(m_context), node.typed_list_of_variables);
+        track_variable_references(frame.parameter_list, m_context);
+    }
+
+    void enter(const ast::EffectConditionalWhen& node, Frame& frame)
+    {
+        m_context.scopes.open_scope();
+        frame.condition = loki::parse(node.goal_descriptor, m_context);
+    }
+
+    /* Visit the next child of inner nodes */
+
+    bool visit_next_child(const std::vector<ast::Effect>& node, Frame& frame)
+    {
+        if (frame.num_visited_children == node.size())
+        {
+            return false;
+        }
+        visit(node[frame.num_visited_children++], true);
+        return true;
+    }
+
+    bool visit_next_child(const ast::EffectConditional& node, Frame& frame)
+    {
+        if (frame.num_visited_children == 1)
+        {
+            return false;
+        }
+        ++frame.num_visited_children;
+        boost::apply_visitor([&](const auto& child_node) { begin(child_node, false); }, node);
+        return true;
+    }
+
+    template<typename Node>
+    bool visit_next_child(const Node& node, Frame& frame)
+    {
+        if (frame.num_visited_children == 1)
+        {
+            return false;
+        }
+        ++frame.num_visited_children;
+        visit(node.effect, false);
+        return true;
+    }
+
+    /* Exit inner nodes */
+
+    Effect exit(const std::vector<ast::Effect>&, Frame& frame) { return m_context.factories.get_or_create_effect_and(frame.children); }
+
+    Effect exit(const ast::EffectConditional& node, Frame& frame)
+    {
+        const auto effect = frame.children.front();
+        m_context.positions.push_back(effect, node);
+        return effect;
+    }
+
+    Effect exit(const ast::EffectConditionalForall& node, Frame& frame)
+    {
+        test_variable_references(frame.parameter_list, m_context);
+        m_context.scopes.close_scope();
+        const auto effect = m_context.factories.get_or_create_effect_conditional_forall(frame.parameter_list, frame.children.front());
+        m_context.positions.push_back(effect, node);
+        return effect;
+    }
+
+    Effect exit(const ast::EffectConditionalWhen& node, Frame& frame)
+    {
+        m_context.scopes.close_scope();
+        const auto effect = m_context.factories.get_or_create_effect_conditional_when(frame.condition.value(), frame.children.front());
+        m_context.positions.push_back(effect, node);
+        return effect;
+    }
+
+    /* Drive the parse */
+
+    void step()
+    {
+        auto& frame = m_frames.back();
+        if (std::visit([&](const auto* node) { return visit_next_child(*node, frame); }, frame.node))
+        {
+            return;
+        }
+        const auto effect = std::visit([&](const auto* node) { return exit(*node, frame); }, frame.node);
+        const auto is_skippable = frame.is_skippable;
+        m_frames.pop_back();
+        finish(effect, is_skippable);
+    }
+
+    template<typename Function>
+    void run_or_skip(Function&& function)
+    {
+        try
+        {
+            function();
+        }
+        catch (const SkipStructureSignal&)
+        {
+            if (m_skip_points.empty())
+            {
+                throw;
+            }
+            const auto [num_frames, skip_point] = m_skip_points.back();
+            m_skip_points.pop_back();
+            m_frames.erase(m_frames.begin() + num_frames, m_frames.end());
+            skip_point.restore(m_context);
+        }
+    }
+
+public:
+    explicit NestedEffectParser(Context& context) : m_context(context), m_frames(), m_skip_points(), m_result() {}
+
+    template<typename Node>
+    Effect parse(const Node& node)
+    {
+        run_or_skip([&] { begin(node, false); });
+        while (!m_result.has_value())
+        {
+            run_or_skip([&] { step(); });
+        }
+        return m_result.value();
+    }
+};
+}
+
 AssignOperatorEnum parse(const ast::AssignOperatorAssign&) { return AssignOperatorEnum::ASSIGN; }
 
 AssignOperatorEnum parse(const ast::AssignOperatorScaleUp&) { return AssignOperatorEnum::SCALE_UP; }
@@ -51,19 +276,11 @@ Effect parse(const std::vector<ast::EffectNumericFluentTotalCostOrEffect>& effec
     return context.factories.get_or_create_effect_and(effect_list);
 }
 
-Effect parse(const std::vector<ast::Effect>& effect_nodes, Context& context)
-{
-    auto effect_list = EffectList();
-    for (const auto& effect_node : effect_nodes)
-    {
-        effect_list.push_back(parse(effect_node, context));
-    }
-    return context.factories.get_or_create_effect_and(effect_list);
-}
+Effect parse(const std::vector<ast::Effect>& effect_nodes, Context& context) { return NestedEffectParser(context).parse(effect_nodes); }
 
 Effect parse(const ast::EffectRoot& node, Context& context) { return boost::apply_visitor(EffectVisitor(context), node); }
 
-Effect parse(const ast::Effect& node, Context& context) { return boost::apply_visitor(EffectVisitor(context), node); }
+Effect parse(const ast::Effect& node, Context& context) { return NestedEffectParser(context).parse(node); }
 
 Effect parse(const ast::EffectProductionLiteral& node, Context& context)
 {
@@ -107,38 +324,11 @@ Effect parse(const ast::EffectProductionNumericFluentGeneral& node, Context& con
 
 Effect parse(const ast::EffectProduction& node, Context& context) { return boost::apply_visitor(EffectVisitor(context), node); }
 
-Effect parse(const ast::EffectConditionalForall& node, Context& context)
-{
-    context.scopes.open_scope();
-    const auto parameter_list = boost::apply_visitor(ParameterListVisitor(context), node.typed_list_of_variables);
-    track_variable_references(parameter_list, context);
-    const auto child_effect = parse(node.effect, context);
-    test_variable_references(parameter_list, context);
-    context.scopes.close_scope();
-    const auto effect = context.factories.get_or_create_effect_conditional_forall(parameter_list, child_effect);
-    context.positions.push_back(effect, node);
-    return effect;
-}
+Effect parse(const ast::EffectConditionalForall& node, Context& context) { return NestedEffectParser(context).parse(node); }
 
-Effect parse(const ast::EffectConditionalWhen& node, Context& context)
-{
-    context.scopes.open_scope();
-    const auto condition = parse(node.goal_descriptor, context);
-    const auto child_effect = parse(node.effect, context);
-    context.scopes.close_scope();
-    const auto effect = context.factories.get_or_create_effect_conditional_when(condition, child_effect);
-    context.positions.push_back(effect, node);
-    return effect;
-}
+Effect parse(const ast::EffectConditionalWhen& node, Context& context) { return NestedEffectParser(context).parse(node); }
 
-Effect parse(const ast::EffectConditional& node, Context& context)
-{
-    test_undefined_requirement(RequirementEnum::CONDITIONAL_EFFECTS, node, context);
-    context.references.untrack(RequirementEnum::CONDITIONAL_EFFECTS);
-    const auto effect = boost::apply_visitor(EffectVisitor(context), node);
-    context.positions.push_back(effect, node);
-    return effect;
-}
+Effect parse(const ast::EffectConditional& node, Context& context) { return NestedEffectParser(context).parse(node); }
 
 EffectVisitor::EffectVisitor(Context& context_) : context(context_) {}
 
@@ -18,12 +18,77 @@
 #include "error_handling.hpp"
 
 #include "loki/details/ast/ast.hpp"
+#include "loki/details/pddl/domain.hpp"
 #include "loki/details/pddl/exceptions.hpp"
 #include "loki/details/pddl/type.hpp"
 
 namespace loki
 {
 
+/**
+ * Diagnostics
+ */
+
+template<typename Error, typename PositionType>
+static void
+record(const Error& error, DiagnosticSeverityEnum severity, const PDDLErrorHandler& error_handler, const PositionType& position, const Context& context)
+{
+    const auto [line, column] = error_handler.get_line_and_column(position);
+    if (!context.diagnostics->add(Diagnostic { severity, line, column, error.what() }))
+    {
+        throw DiagnosticLimitSignal();
+    }
+}
+
+/// @brief Throws the error if there is no diagnostic sink and records it otherwise.
+///        The caller can continue parsing because the error does not invalidate the parsed structure.
+template<typename Error, typename PositionType>
+static void report(const Error& error, const PDDLErrorHandler& error_handler, const PositionType& position, const Context& context)
+{
+    if (!context.diagnostics)
+    {
+        throw error;
+    }
+    record(error, DiagnosticSeverityEnum::ERROR, error_handler, position, context);
+}
+
+template<typename Error>
+static void report(const Error& error, const Position& position, const Context& context)
+{
+    report(error, context.scopes.top().get_error_handler(), position, context);
+}
+
+/// @brief Throws the error if there is no diagnostic sink and records it and skips the structure otherwise.
+template<typename Error>
+[[noreturn]] static void report_and_skip(const Error& error, const Position& position, const Context& context)
+{
+    report(error, position, context);
+    throw SkipStructureSignal();
+}
+
+void report_warning(const std::string& message, const SourcePosition& position, const Context& context)
+{
+    if (context.diagnostics)
+    {
+        record(std::runtime_error(context.scopes.top().get_error_handler()(position, message)),
+               DiagnosticSeverityEnum::WARNING,
+               context.scopes.top().get_error_handler(),
+               position,
+               context);
+    }
+}
+
+SkipPoint::SkipPoint(const Context& context) : num_scopes(context.scopes.size()), allow_free_variables(context.allow_free_variables) {}
+
+void SkipPoint::restore(Context& context) const
+{
+    while (context.scopes.size() > num_scopes)
+    {
+        context.scopes.close_scope();
+    }
+    context.allow_free_variables = allow_free_variables;
+}
+
 /**
  * Test requirement
  */
@@ -32,7 +97,7 @@ void test_undefined_requirement(RequirementEnum requirement, const Position& pos
 {
     if (!context.requirements->test(requirement))
     {
-        throw UndefinedRequirementError(requirement, context.scopes.top().get_error_handler()(position, ""));
+        report(UndefinedRequirementError(requirement, context.scopes.top().get_error_handler()(position, "")), position, context);
     }
 }
 
@@ -48,7 +113,19 @@ void test_undefined_requirements(RequirementEnumList requirements, const Positio
     }
     if (!found)
     {
-        throw UndefinedRequirementError(requirements, context.scopes.top().get_error_handler()(position, ""));
+        report(UndefinedRequirementError(requirements, context.scopes.top().get_error_handler()(position, "")), position, context);
+    }
+}
+
+/**
+ * Test domain
+ */
+
+void test_mismatched_domain(const Domain& domain, const std::string& domain_name, const Position& position, const Context& context)
+{
+    if (domain_name != domain->get_name())
+    {
+        report(MismatchedDomainError(domain, domain_name, context.scopes.top().get_error_handler()(position, "")), position, context);
     }
 }
 
@@ -61,7 +138,7 @@ void test_undefined_constant(const std::string& constant_name, const Position& p
     const auto binding = context.scopes.top().get_object(constant_name);
     if (!binding.has_value())
     {
-        throw UndefinedConstantError(constant_name, context.scopes.top().get_error_handler()(position, ""));
+        report_and_skip(UndefinedConstantError(constant_name, context.scopes.top().get_error_handler()(position, "")), position, context);
     }
 }
 
@@ -70,7 +147,7 @@ void test_undefined_object(const std::string& object_name, const Position& posit
     const auto binding = context.scopes.top().get_object(object_name);
     if (!binding.has_value())
     {
-        throw UndefinedObjectError(object_name, context.scopes.top().get_error_handler()(position, ""));
+        report_and_skip(UndefinedObjectError(object_name, context.scopes.top().get_error_handler()(position, "")), position, context);
     }
 }
 
@@ -79,7 +156,7 @@ void test_undefined_variable(const Variable& variable, const Position& position,
     const auto binding = context.scopes.top().get_variable(variable->get_name());
     if (!binding.has_value())
     {
-        throw UndefinedVariableError(variable->get_name(), context.scopes.top().get_error_handler()(position, ""));
+        report_and_skip(UndefinedVariableError(std::string(variable->get_name()), context.scopes.top().get_error_handler()(position, "")), position, context);
     }
 }
 
@@ -88,7 +165,7 @@ void test_undefined_function_skeleton(const std::string& function_name, const Po
     auto binding = context.scopes.top().get_function_skeleton(function_name);
     if (!binding.has_value())
     {
-        throw UndefinedFunctionSkeletonError(function_name, context.scopes.top().get_error_handler()(position, ""));
+        report_and_skip(UndefinedFunctionSkeletonError(function_name, context.scopes.top().get_error_handler()(position, "")), position, context);
     }
 }
 
@@ -97,7 +174,7 @@ void test_undefined_predicate(const std::string& predicate_name, const Position&
     const auto binding = context.scopes.top().get_predicate(predicate_name);
     if (!binding.has_value())
     {
-        throw UndefinedPredicateError(predicate_name, context.scopes.top().get_error_handler()(position, ""));
+        report_and_skip(UndefinedPredicateError(predicate_name, context.scopes.top().get_error_handler()(position, "")), position, context);
     }
 }
 
@@ -106,7 +183,7 @@ void test_undefined_type(const std::string& type_name, const Position& position,
     auto binding = context.scopes.top().get_type(type_name);
     if (!binding.has_value())
     {
-        throw UndefinedTypeError(type_name, context.scopes.top().get_error_handler()(position, ""));
+        report_and_skip(UndefinedTypeError(type_name, context.scopes.top().get_error_handler()(position, "")), position, context);
     }
 }
 
@@ -120,16 +197,16 @@ void test_multiple_definition_variable(const Variable& variable, const Position&
     if (binding.has_value())
     {
         const auto message_1 = context.scopes.top().get_error_handler()(position, "Defined here:");
-        const auto [_constant, position, error_handler] = binding.value();
-        assert(position.has_value());
-        const auto message_2 = error_handler(position.value(), "First defined here:");
-        throw MultiDefinitionVariableError(variable->get_name(), message_1 + message_2);
+        const auto [_constant, first_position, error_handler] = binding.value();
+        assert(first_position.has_value());
+        const auto message_2 = error_handler(first_position.value(), "First defined here:");
+        report_and_skip(MultiDefinitionVariableError(std::string(variable->get_name()), message_1 + message_2), position, context);
     }
 }
 
 void test_multiple_definition_constant(const Object& constant, const Position& node, const Context& context)
 {
-    const auto constant_name = constant->get_name();
+    const auto constant_name = std::string(constant->get_name());
     const auto binding = context.scopes.top().get_object(constant_name);
     if (binding.has_value())
     {
@@ -140,13 +217,13 @@ void test_multiple_definition_constant(const Object& constant, const Position& n
         {
             message_2 = error_handler(position.value(), "First defined here:");
         }
-        throw MultiDefinitionConstantError(constant_name, message_1 + message_2);
+        report_and_skip(MultiDefinitionConstantError(constant_name, message_1 + message_2), node, context);
     }
 }
 
 void test_multiple_definition_object(const Object& object, const Position& node, const Context& context)
 {
-    const auto object_name = object->get_name();
+    const auto object_name = std::string(object->get_name());
     const auto binding = context.scopes.top().get_object(object_name);
     if (binding.has_value())
     {
@@ -157,13 +234,13 @@ void test_multiple_definition_object(const Object& object, const Position& node,
         {
             message_2 = error_handler(position.value(), "First defined here:");
         }
-        throw MultiDefinitionObjectError(object_name, message_1 + message_2);
+        report_and_skip(MultiDefinitionObjectError(object_name, message_1 + message_2), node, context);
     }
 }
 
 void test_multiple_definition_predicate(const Predicate& predicate, const Position& node, const Context& context)
 {
-    const auto predicate_name = predicate->get_name();
+    const auto predicate_name = std::string(predicate->get_name());
     const auto binding = context.scopes.top().get_predicate(predicate_name);
     if (binding.has_value())
     {
@@ -174,13 +251,13 @@ void test_multiple_definition_predicate(const Predicate& predicate, const Positi
         {
             message_2 = error_handler(position.value(), "First defined here:");
         }
-        throw MultiDefinitionPredicateError(predicate_name, message_1 + message_2);
+        report_and_skip(MultiDefinitionPredicateError(predicate_name, message_1 + message_2), node, context);
     }
 }
 
 void test_multiple_definition_function_skeleton(const FunctionSkeleton& function_skeleton, const Position& node, const Context& context)
 {
-    const auto function_name = function_skeleton->get_name();
+    const auto function_name = std::string(function_skeleton->get_name());
     const auto binding = context.scopes.top().get_function_skeleton(function_name);
     if (binding.has_value())
     {
@@ -191,7 +268,7 @@ void test_multiple_definition_function_skeleton(const FunctionSkeleton& function
         {
             message_2 = error_handler(position.value(), "First defined here:");
         }
-        throw MultiDefinitionFunctionSkeletonError(function_name, message_1 + message_2);
+        report_and_skip(MultiDefinitionFunctionSkeletonError(function_name, message_1 + message_2), node, context);
     }
 }
 
@@ -203,13 +280,25 @@ void test_reserved_type(const std::string& type_name, const Position& node, cons
 {
     if (type_name == "object")
     {
-        throw ReservedTypeError("object", context.scopes.top().get_error_handler()(node, ""));
+        report_and_skip(ReservedTypeError("object", context.scopes.top().get_error_handler()(node, "")), node, context);
     }
     // We also reserve type name number although PDDL specification allows it.
     // However, this allows using regular types as function types for simplicity.
     if (type_name == "number")
     {
-        throw ReservedTypeError("number", context.scopes.top().get_error_handler()(node, ""));
+        report_and_skip(ReservedTypeError("number", context.scopes.top().get_error_handler()(node, "")), node, context);
+    }
+}
+
+/**
+ * Test type hierarchy
+ */
+
+void test_acyclic_type_hierarchy(const std::vector<std::string>& cycle, const Position& position, const Context& context)
+{
+    if (!cycle.empty())
+    {
+        report(CyclicTypeHierarchyError(cycle, context.scopes.top().get_error_handler()(position, "")), position, context);
     }
 }
 
@@ -221,7 +310,7 @@ void test_arity_compatibility(size_t arity_1, size_t arity_2, const Position& po
 {
     if (arity_1 != arity_2)
     {
-        throw IncompatibleArityError(arity_1, arity_2, context.scopes.top().get_error_handler()(position, ""));
+        report_and_skip(IncompatibleArityError(arity_1, arity_2, context.scopes.top().get_error_handler()(position, "")), position, context);
     }
 }
 
@@ -232,7 +321,9 @@ void test_parameter_type_compatibility(const Parameter& specialized_parameter,
 {
     if (!is_specialized_parameter(specialized_parameter, generalized_parameter))
     {
-        throw IncompatibleParameterTypesError(specialized_parameter, generalized_parameter, context.scopes.top().get_error_handler()(position, ""));
+        report(IncompatibleParameterTypesError(specialized_parameter, generalized_parameter, context.scopes.top().get_error_handler()(position, "")),
+               position,
+               context);
     }
 }
 
@@ -244,7 +335,7 @@ void test_nonnegative_number(double number, const Position& position, const Cont
 {
     if (number < 0)
     {
-        throw NegativeCostError(context.positions.get_error_handler()(position, ""));
+        report(NegativeCostError(context.positions.get_error_handler()(position, "")), context.positions.get_error_handler(), position, context);
     }
 }
 
@@ -267,7 +358,9 @@ static void test_incompatible_grounding(const Parameter& parameter, const Object
     }
     if (!is_consistent)
     {
-        throw IncompatibleVariableGroundingError(object, parameter->get_variable(), context.scopes.top().get_error_handler()(position, ""));
+        report(IncompatibleVariableGroundingError(object, parameter->get_variable(), context.scopes.top().get_error_handler()(position, "")),
+               position,
+               context);
     }
 }
 
@@ -297,7 +390,7 @@ void test_variable_references(const ParameterList& parameter_list, const Context
             if (context.references.exists(parameter->get_variable()))
             {
                 const auto [variable, position, error_handler] = context.scopes.top().get_variable(parameter->get_variable()->get_name()).value();
-                throw UnusedVariableError(variable->get_name(), error_handler(position.value(), ""));
+                report(UnusedVariableError(std::string(variable->get_name()), error_handler(position.value(), "")), error_handler, position.value(), context);
             }
         }
     }
@@ -312,7 +405,7 @@ void test_object_references(const ObjectList& object_list, const Context& contex
             if (context.references.exists(object))
             {
                 const auto [_object, position, error_handler] = context.scopes.top().get_object(object->get_name()).value();
-                throw UnusedObjectError(object->get_name(), error_handler(position.value(), ""));
+                report(UnusedObjectError(std::string(object->get_name()), error_handler(position.value(), "")), error_handler, position.value(), context);
             }
         }
     }
@@ -327,7 +420,7 @@ void test_predicate_references(const PredicateList& predicate_list, const Contex
             if (context.references.exists(predicate))
             {
                 const auto [_predicate, position, error_handler] = context.scopes.top().get_predicate(predicate->get_name()).value();
-                throw UnusedPredicateError(predicate->get_name(), error_handler(position.value(), ""));
+                report(UnusedPredicateError(std::string(predicate->get_name()), error_handler(position.value(), "")), error_handler, position.value(), context);
             }
         }
     }
@@ -342,7 +435,10 @@ void test_function_skeleton_references(const FunctionSkeletonList& function_skel
             if (context.references.exists(function_skeleton))
             {
                 const auto [_function_skeleton, position, error_handler] = context.scopes.top().get_function_skeleton(function_skeleton->get_name()).value();
-                throw UnusedFunctionSkeletonError(function_skeleton->get_name(), error_handler(position.value(), ""));
+                report(UnusedFunctionSkeletonError(std::string(function_skeleton->get_name()), error_handler(position.value(), "")),
+                       error_handler,
+                       position.value(),
+                       context);
             }
         }
     }
@@ -22,9 +22,60 @@
 #include "loki/details/pddl/declarations.hpp"
 #include "loki/details/pddl/parameter.hpp"
 
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 namespace loki
 {
 
+/**
+ * Diagnostics
+ */
+
+/// @brief Thrown after an error was recorded in the diagnostic sink of the context to skip the offending structure.
+struct SkipStructureSignal
+{
+};
+
+/// @brief Thrown when the diagnostic sink of the context is full to stop the parse.
+struct DiagnosticLimitSignal
+{
+};
+
+/// @brief Records a warning in the diagnostic sink of the context if there is one.
+extern void report_warning(const std::string& message, const SourcePosition& position, const Context& context);
+
+/// @brief `SkipPoint` records the state that is restored when the structure that is parsed after it is skipped after an error.
+struct SkipPoint
+{
+    size_t num_scopes;
+    bool allow_free_variables;
+
+    explicit SkipPoint(const Context& context);
+
+    /// @brief Closes the scopes that were opened after the skip point and restores whether free variables are allowed.
+    void restore(Context& context) const;
+};
+
+/// @brief Returns the result of `function` or std::nullopt if it skipped the structure that it parses after an error.
+///        Scopes that were opened by `function` are closed.
+template<typename Function>
+std::optional<std::invoke_result_t<Function>> parse_or_skip(Context& context, Function&& function)
+{
+    const auto skip_point = SkipPoint(context);
+    try
+    {
+        return function();
+    }
+    catch (const SkipStructureSignal&)
+    {
+        skip_point.restore(context);
+        return std::nullopt;
+    }
+}
+
 /**
  * Test requirement
  */
@@ -33,6 +84,12 @@ extern void test_undefined_requirement(RequirementEnum requirement, const Positi
 
 extern void test_undefined_requirements(RequirementEnumList requirements, const Position& position, const Context& context);
 
+/**
+ * Test domain
+ */
+
+extern void test_mismatched_domain(const Domain& domain, const std::string& domain_name, const Position& position, const Context& context);
+
 /**
  * Test missing definitions
  */
@@ -69,6 +126,13 @@ extern void test_multiple_definition_function_skeleton(const FunctionSkeleton& f
 
 extern void test_reserved_type(const std::string& type_name, const Position& node, const Context& context);
 
+/**
+ * Test type hierarchy
+ */
+
+/// @brief Reports an error if the `cycle` of types is not empty. The caller can continue by breaking the cycle.
+extern void test_acyclic_type_hierarchy(const std::vector<std::string>& cycle, const Position& position, const Context& context);
+
 /**
  * Test variable initialization
  */
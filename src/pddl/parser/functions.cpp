@@ -164,8 +164,10 @@ static FunctionSkeletonList parse_function_skeleton_definitions(const std::vecto
     auto function_skeleton_list = FunctionSkeletonList();
     for (const auto& node : nodes)
     {
-        auto function_skeleton = boost::apply_visitor(AtomicFunctionSkeletonVisitor(context), node);
-        function_skeleton_list.push_back(function_skeleton);
+        if (const auto function_skeleton = parse_or_skip(context, [&] { return boost::apply_visitor(AtomicFunctionSkeletonVisitor(context), node); }))
+        {
+            function_skeleton_list.push_back(function_skeleton.value());
+        }
     }
     return function_skeleton_list;
 }
@@ -35,7 +35,10 @@ std::vector<std::variant<Literal, NumericFluent>> parse(const ast::Initial& init
     auto initial_element_list = std::vector<std::variant<Literal, NumericFluent>>();
     for (const auto& initial_element : initial_node.initial_elements)
     {
-        initial_element_list.push_back(boost::apply_visitor(InitialElementVisitor(context), initial_element));
+        if (auto element = parse_or_skip(context, [&] { return boost::apply_visitor(InitialElementVisitor(context), initial_element); }))
+        {
+            initial_element_list.push_back(std::move(element.value()));
+        }
     }
     return initial_element_list;
 }
@@ -29,10 +29,10 @@ namespace loki
 /* Init */
 extern std::vector<std::variant<Literal, NumericFluent>> parse(const ast::Initial& initial_node, Context& context);
 
-extern std::variant<Literal, NumericFluent> parse(const ast::InitialElementLiteral& node);
-extern std::variant<Literal, NumericFluent> parse(const ast::InitialElementTimedLiterals& node);
-extern std::variant<Literal, NumericFluent> parse(const ast::InitialElementNumericFluentsTotalCost& node);
-extern std::variant<Literal, NumericFluent> parse(const ast::InitialElementNumericFluentsGeneral& node);
+extern std::variant<Literal, NumericFluent> parse(const ast::InitialElementLiteral& node, Context& context);
+extern std::variant<Literal, NumericFluent> parse(const ast::InitialElementTimedLiterals& node, Context& context);
+extern std::variant<Literal, NumericFluent> parse(const ast::InitialElementNumericFluentsTotalCost& node, Context& context);
+extern std::variant<Literal, NumericFluent> parse(const ast::InitialElementNumericFluentsGeneral& node, Context& context);
 
 class InitialElementVisitor : boost::static_visitor<std::variant<Literal, NumericFluent>>
 {
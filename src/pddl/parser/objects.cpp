@@ -59,7 +59,10 @@ static ObjectList parse_object_definitions(const std::vector<ast::Name>& name_no
     auto object_list = ObjectList();
     for (const auto& name_node : name_nodes)
     {
-        object_list.emplace_back(parse_object_definition(name_node, type_list, context));
+        if (const auto object = parse_or_skip(context, [&] { return parse_object_definition(name_node, type_list, context); }))
+        {
+            object_list.push_back(object.value());
+        }
     }
     return object_list;
 }
@@ -77,8 +80,10 @@ ObjectList ObjectListVisitor::operator()(const ast::TypedListOfNamesRecursively&
 {
     test_undefined_requirement(RequirementEnum::TYPING, node, context);
     context.references.untrack(RequirementEnum::TYPING);
-    // TypedListOfNamesRecursively has user defined base types
-    const auto type_list = boost::apply_visitor(TypeReferenceTypeVisitor(context), node.type);
+    // TypedListOfNamesRecursively has user defined base types.
+    // If they are undefined, we continue with base type "object" to avoid follow-up errors of undefined objects.
+    const auto type_list = parse_or_skip(context, [&] { return boost::apply_visitor(TypeReferenceTypeVisitor(context), node.type); })
+                               .value_or(TypeList { std::get<0>(context.scopes.top().get_type("object").value()) });
     auto object_list = parse_object_definitions(node.names, type_list, context);
     // Recursively add objects.
     auto additional_objects = boost::apply_visitor(*this, node.typed_list_of_names.get());
@@ -47,7 +47,10 @@ static PredicateList parse_predicate_definitions(const std::vector<ast::AtomicFo
     auto predicate_list = PredicateList();
     for (const auto& node : nodes)
     {
-        predicate_list.push_back(parse_predicate_definition(node, context));
+        if (const auto predicate = parse_or_skip(context, [&] { return parse_predicate_definition(node, context); }))
+        {
+            predicate_list.push_back(predicate.value());
+        }
     }
     return predicate_list;
 }
@@ -70,6 +70,8 @@ Action parse(const ast::Action& node, Context& context)
             {
                 std::cout << "Removed unused parameter " << *parameter << " from action " << name << std::endl;
             }
+            const auto [_variable, position, _error_handler] = context.scopes.top().get_variable(parameter->get_variable()->get_name()).value();
+            report_warning("Removed unused parameter " + std::string(parameter->get_variable()->get_name()) + " from action " + name, position.value(), context);
         }
     }
     context.scopes.close_scope();
@@ -79,6 +81,31 @@ Action parse(const ast::Action& node, Context& context)
     return action;
 }
 
+Action parse(const ast::Action& node, Context& context, std::unique_ptr<LazyActionBody> lazy_body)
+{
+    context.scopes.open_scope();
+    auto name = parse(node.action_symbol.name);
+    auto parameter_list = boost::apply_visitor(ParameterListVisitor(context), node.typed_list_of_variables);
+    context.scopes.close_scope();
+
+    const auto action = context.factories.create_lazy_action(name, parameter_list, std::move(lazy_body));
+    context.positions.push_back(action, node);
+    return action;
+}
+
+std::tuple<std::optional<Condition>, std::optional<Effect>> parse_lazy_body(const ast::Action& node, Context& context)
+{
+    context.scopes.open_scope();
+    // Bind the parameters again, whose positions were stored when the action was created.
+    auto parameter_positions = PDDLPositionCache(context.positions.get_shared_error_handler());
+    auto parameter_context = Context(context.factories, parameter_positions, context.scopes, context.strict, context.quiet, context.diagnostics);
+    parameter_context.requirements = context.requirements;
+    boost::apply_visitor(ParameterListVisitor(parameter_context), node.typed_list_of_variables);
+    auto body = parse(node.action_body, context);
+    context.scopes.close_scope();
+    return body;
+}
+
 Axiom parse(const ast::Axiom& node, Context& context)
 {
     test_undefined_requirement(RequirementEnum::DERIVED_PREDICATES, node, context);
@@ -101,7 +128,7 @@ Axiom parse(const ast::Axiom& node, Context& context)
     context.scopes.close_scope();
 
     // Free variables and literal variables become explicit parameters
-    auto variables = collect_free_variables(*condition);
+    auto variables = collect_free_variables(condition);
     // Check whether axiom parameters match derived predicate and
     // subtract axiom parameter variables from free variables
     for (size_t i = 0; i < parameters.size(); ++i)
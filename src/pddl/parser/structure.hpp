@@ -23,6 +23,8 @@
 #include "loki/details/pddl/declarations.hpp"
 #include "loki/details/pddl/parser.hpp"
 
+#include <memory>
+
 namespace loki
 {
 
@@ -30,6 +32,13 @@ extern std::tuple<std::optional<Condition>, std::optional<Effect>> parse(const a
 
 extern Action parse(const ast::Action& node, Context& context);
 
+/// @brief Parses the name and the parameters of the action and creates a lazy action whose condition and effect are parsed by the `lazy_body`,
+///        e.g., with `parse_lazy_body`. Unused parameters are kept since they are only known after the condition and the effect were parsed.
+extern Action parse(const ast::Action& node, Context& context, std::unique_ptr<LazyActionBody> lazy_body);
+
+/// @brief Parses the condition and the effect of the action that was created by parsing the `node` lazily.
+extern std::tuple<std::optional<Condition>, std::optional<Effect>> parse_lazy_body(const ast::Action& node, Context& context);
+
 extern Axiom parse(const ast::Axiom& node, Context& context);
 
 struct StructureVisitor : boost::static_visitor<boost::variant<Axiom, Action>>
@@ -109,16 +109,24 @@ TypeList TypeReferenceTypeVisitor::operator()(const ast::TypeEither& node)
 
 /* TypeDeclarationTypedListOfNamesVisitor */
 
-CollectParentTypesHierarchyVisitor::CollectParentTypesHierarchyVisitor(Context& context_, std::unordered_map<std::string, Position>& type_last_occurrence_) :
+CollectParentTypesHierarchyVisitor::CollectParentTypesHierarchyVisitor(Context& context_,
+                                                                       std::unordered_map<std::string, Position>& type_last_occurrence_,
+                                                                       std::vector<std::string>& type_occurrences_) :
     context(context_),
-    type_last_occurrence(type_last_occurrence_)
+    type_last_occurrence(type_last_occurrence_),
+    type_occurrences(type_occurrences_)
 {
 }
 
-std::unordered_set<std::string> CollectParentTypesHierarchyVisitor::operator()(const ast::TypeObject&) { return std::unordered_set<std::string> { "object" }; }
+std::unordered_set<std::string> CollectParentTypesHierarchyVisitor::operator()(const ast::TypeObject&)
+{
+    type_occurrences.push_back("object");
+    return std::unordered_set<std::string> { "object" };
+}
 
 std::unordered_set<std::string> CollectParentTypesHierarchyVisitor::operator()(const ast::TypeNumber&)
-{  //
+{
+    type_occurrences.push_back("number");
     return std::unordered_set<std::string> { "number" };
 }
 
@@ -130,6 +138,7 @@ std::unordered_set<std::string> CollectParentTypesHierarchyVisitor::operator()(c
     test_reserved_type(type_name, node, context);
 
     type_last_occurrence[type_name] = node;
+    type_occurrences.push_back(type_name);
 
     return std::unordered_set<std::string> { parse(node) };
 }
@@ -139,7 +148,7 @@ std::unordered_set<std::string> CollectParentTypesHierarchyVisitor::operator()(c
     auto type_names = std::unordered_set<std::string> {};
     for (const auto& type_node : node.types)
     {
-        const auto nested_type_names = boost::apply_visitor(CollectParentTypesHierarchyVisitor(context, type_last_occurrence), type_node);
+        const auto nested_type_names = boost::apply_visitor(CollectParentTypesHierarchyVisitor(context, type_last_occurrence, type_occurrences), type_node);
 
         type_names.insert(nested_type_names.begin(), nested_type_names.end());
     }
@@ -149,10 +158,12 @@ std::unordered_set<std::string> CollectParentTypesHierarchyVisitor::operator()(c
 
 CollectTypesHierarchyVisitor::CollectTypesHierarchyVisitor(Context& context_,
                                                            std::unordered_map<std::string, std::unordered_set<std::string>>& parent_types_,
-                                                           std::unordered_map<std::string, Position>& type_last_occurrence_) :
+                                                           std::unordered_map<std::string, Position>& type_last_occurrence_,
+                                                           std::vector<std::string>& type_occurrences_) :
     context(context_),
     child_types(parent_types_),
-    type_last_occurrence(type_last_occurrence_)
+    type_last_occurrence(type_last_occurrence_),
+    type_occurrences(type_occurrences_)
 {
 }
 
@@ -167,6 +178,12 @@ void CollectTypesHierarchyVisitor::operator()(const std::vector<ast::Name>& node
         test_reserved_type(child_type, name_node, context);
 
         type_last_occurrence[child_type] = name_node;
+        type_occurrences.push_back(child_type);
+    }
+    // The implicit base type follows the names that it applies to.
+    if (!nodes.empty())
+    {
+        type_occurrences.push_back("object");
     }
 }
 
@@ -176,7 +193,13 @@ void CollectTypesHierarchyVisitor::operator()(const ast::TypedListOfNamesRecursi
     test_undefined_requirement(RequirementEnum::TYPING, node, context);
     context.references.untrack(RequirementEnum::TYPING);
 
-    const auto parent_types = boost::apply_visitor(CollectParentTypesHierarchyVisitor(context, type_last_occurrence), node.type);
+    // The names occur before their base types.
+    for (const auto& name_node : node.names)
+    {
+        type_occurrences.push_back(parse(name_node));
+    }
+
+    const auto parent_types = boost::apply_visitor(CollectParentTypesHierarchyVisitor(context, type_last_occurrence, type_occurrences), node.type);
 
     for (const auto& parent_type : parent_types)
     {
@@ -192,109 +215,135 @@ void CollectTypesHierarchyVisitor::operator()(const ast::TypedListOfNamesRecursi
         }
     }
 
-    boost::apply_visitor(CollectTypesHierarchyVisitor(context, child_types, type_last_occurrence), node.typed_list_of_names.get());
+    boost::apply_visitor(CollectTypesHierarchyVisitor(context, child_types, type_last_occurrence, type_occurrences), node.typed_list_of_names.get());
 }
 
 /* Other functions */
 
-template<typename T>
-bool is_subseteq(const std::unordered_set<T>& set1, const std::unordered_set<T>& set2)
+/// @brief Returns a cycle of types that are not instantiated yet, following the edges to uninstantiated base types.
+static std::vector<size_t> find_type_cycle(const std::vector<std::vector<size_t>>& base_type_ids, const TypeList& types)
 {
-    for (const auto& element1 : set1)
+    const auto is_uninstantiated = [&types](size_t type_id) { return types[type_id] == nullptr; };
+
+    const auto start = std::find_if(types.begin(), types.end(), [](const auto& type) { return type == nullptr; });
+    assert(start != types.end());
+
+    // Every uninstantiated type has an uninstantiated base type, hence, the walk eventually revisits a type.
+    auto walk = std::vector<size_t> {};
+    auto position_in_walk = std::unordered_map<size_t, size_t> {};
+    auto type_id = static_cast<size_t>(std::distance(types.begin(), start));
+    while (!position_in_walk.count(type_id))
     {
-        if (!set2.count(element1))
-        {
-            return false;
-        }
+        position_in_walk.emplace(type_id, walk.size());
+        walk.push_back(type_id);
+        const auto& base_ids = base_type_ids[type_id];
+        type_id = *std::find_if(base_ids.begin(), base_ids.end(), is_uninstantiated);
     }
-    return true;
+    return std::vector<size_t>(walk.begin() + position_in_walk.at(type_id), walk.end());
 }
 
 TypeList parse(const ast::Types& types_node, Context& context)
 {
     auto child_types = std::unordered_map<std::string, std::unordered_set<std::string>> {};
     auto type_last_occurrence = std::unordered_map<std::string, Position> {};
+    auto type_occurrences = std::vector<std::string> {};
 
-    boost::apply_visitor(CollectTypesHierarchyVisitor(context, child_types, type_last_occurrence), types_node.typed_list_of_names);
+    boost::apply_visitor(CollectTypesHierarchyVisitor(context, child_types, type_last_occurrence, type_occurrences), types_node.typed_list_of_names);
 
-    auto all_types = std::unordered_set<std::string> {};
-    for (const auto& [parent, childs] : child_types)
+    // Assign dense ids to the types in the order of their first occurrence such that the hierarchy can be stored in adjacency lists
+    // and the resulting order of the types does not depend on the order of hashing.
+    auto type_ids = std::unordered_map<std::string, size_t> {};
+    auto type_names = std::vector<std::string> {};
+    const auto get_or_create_type_id = [&type_ids, &type_names](const std::string& type_name)
     {
-        for (const auto& child : childs)
+        const auto [it, inserted] = type_ids.emplace(type_name, type_names.size());
+        if (inserted)
         {
-            all_types.insert(child);
+            type_names.push_back(type_name);
         }
-        all_types.insert(parent);
-    }
-
-    auto parent_types = std::unordered_map<std::string, std::unordered_set<std::string>> {};
-    for (const auto& type : all_types)
+        return it->second;
+    };
+    for (const auto& type_name : type_occurrences)
     {
-        parent_types.emplace(type, std::unordered_set<std::string> {});
+        get_or_create_type_id(type_name);
     }
 
+    const auto num_types = type_names.size();
+    auto child_type_ids = std::vector<std::vector<size_t>>(num_types);
+    auto base_type_ids = std::vector<std::vector<size_t>>(num_types);
     for (const auto& [parent, childs] : child_types)
     {
+        const auto parent_id = type_ids.at(parent);
         for (const auto& child : childs)
         {
-            parent_types[child].insert(parent);
+            const auto child_id = type_ids.at(child);
+            child_type_ids[parent_id].push_back(child_id);
+            base_type_ids[child_id].push_back(parent_id);
         }
     }
-
-    const auto original_parent_types = parent_types;
-
-    auto instantiated_types = std::unordered_map<std::string, Type> {};
-
-    auto remaining = all_types;
-
-    while (!remaining.empty())
+    for (size_t type_id = 0; type_id < num_types; ++type_id)
     {
-        // Find types for which all base types are instantiated.
-        auto selected = std::vector<std::string> {};
+        std::sort(child_type_ids[type_id].begin(), child_type_ids[type_id].end());
+        std::sort(base_type_ids[type_id].begin(), base_type_ids[type_id].end());
+    }
 
-        bool found = false;
+    // Instantiate the types in topological order such that the base types of a type are instantiated before the type (Kahn's algorithm).
+    auto num_uninstantiated_base_types = std::vector<size_t>(num_types);
+    auto queue = std::vector<size_t> {};
+    queue.reserve(num_types);
+    for (size_t type_id = 0; type_id < num_types; ++type_id)
+    {
+        num_uninstantiated_base_types[type_id] = base_type_ids[type_id].size();
+        if (num_uninstantiated_base_types[type_id] == 0)
+        {
+            queue.push_back(type_id);
+        }
+    }
 
-        for (const auto& type : remaining)
+    auto instantiated_types = TypeList(num_types, nullptr);
+    auto result = TypeList {};
+    result.reserve(num_types);
+    for (size_t next = 0; result.size() < num_types; ++next)
+    {
+        if (next == queue.size())
         {
-            if (parent_types.at(type).empty())
+            // All remaining types lie on or below a cycle.
+            const auto cycle_ids = find_type_cycle(base_type_ids, instantiated_types);
+            auto cycle = std::vector<std::string> {};
+            for (const auto type_id : cycle_ids)
             {
-                selected.push_back(type);
-
-                found = true;
+                cycle.push_back(type_names[type_id]);
             }
-        }
+            test_acyclic_type_hierarchy(cycle, type_last_occurrence.at(cycle.front()), context);
 
-        if (!found)
-        {
-            throw std::runtime_error("Types hierarchy contains a circular dependency!");
+            // Break the cycle by instantiating one of its types without its uninstantiated base types.
+            num_uninstantiated_base_types[cycle_ids.front()] = 0;
+            queue.push_back(cycle_ids.front());
         }
 
-        // Instantiate the type
-        for (const auto& type_name : selected)
+        const auto type_id = queue[next];
+        auto base_types = TypeList {};
+        for (const auto base_type_id : base_type_ids[type_id])
         {
-            remaining.erase(type_name);
-            for (const auto& child_type : all_types)
+            if (instantiated_types[base_type_id])
             {
-                parent_types[child_type].erase(type_name);
+                base_types.push_back(instantiated_types[base_type_id]);
             }
+        }
+        const auto type = context.factories.get_or_create_type(type_names[type_id], base_types);
+        instantiated_types[type_id] = type;
+        result.push_back(type);
 
-            auto base_types = TypeList {};
-            for (const auto& base_type_name : original_parent_types.at(type_name))
+        for (const auto child_type_id : child_type_ids[type_id])
+        {
+            if (num_uninstantiated_base_types[child_type_id] > 0 && --num_uninstantiated_base_types[child_type_id] == 0)
             {
-                base_types.push_back(instantiated_types.at(base_type_name));
+                queue.push_back(child_type_id);
             }
-            auto instantiated_type = context.factories.get_or_create_type(type_name, base_types);
-
-            instantiated_types.emplace(type_name, instantiated_type);
         }
-    }
-
-    auto result = TypeList {};
-    for (const auto& [type_name, type] : instantiated_types)
-    {
-        result.push_back(type);
 
         // Base types were already added to the context.
+        const auto& type_name = type_names[type_id];
         if (type_name != "object" && type_name != "number")
         {
             context.scopes.top().insert_type(type_name, type, type_last_occurrence.at(type_name));
@@ -64,9 +64,13 @@ class CollectParentTypesHierarchyVisitor : boost::static_visitor<std::unordered_
 private:
     Context& context;
     std::unordered_map<std::string, Position>& type_last_occurrence;
+    // The names of the types in the order of their occurrence, possibly with duplicates.
+    std::vector<std::string>& type_occurrences;
 
 public:
-    CollectParentTypesHierarchyVisitor(Context& context_, std::unordered_map<std::string, Position>& type_last_occurrence_);
+    CollectParentTypesHierarchyVisitor(Context& context_,
+                                       std::unordered_map<std::string, Position>& type_last_occurrence_,
+                                       std::vector<std::string>& type_occurrences_);
 
     std::unordered_set<std::string> operator()(const ast::TypeObject& node);
 
@@ -83,11 +87,14 @@ private:
     Context& context;
     std::unordered_map<std::string, std::unordered_set<std::string>>& child_types;
     std::unordered_map<std::string, Position>& type_last_occurrence;
+    // The names of the types in the order of their occurrence, possibly with duplicates.
+    std::vector<std::string>& type_occurrences;
 
 public:
     CollectTypesHierarchyVisitor(Context& context_,
                                  std::unordered_map<std::string, std::unordered_set<std::string>>& parent_types_,
-                                 std::unordered_map<std::string, Position>& type_last_occurrence_);
+                                 std::unordered_map<std::string, Position>& type_last_occurrence_,
+                                 std::vector<std::string>& type_occurrences_);
 
     void operator()(const std::vector<ast::Name>& nodes);
 
@@ -27,16 +27,16 @@
 
 namespace loki
 {
-PredicateImpl::PredicateImpl(size_t index, std::string name, ParameterList parameters) :
+PredicateImpl::PredicateImpl(size_t index, std::string_view name, ParameterList parameters) :
     m_index(index),
-    m_name(std::move(name)),
+    m_name(name),
     m_parameters(std::move(parameters))
 {
 }
 
 size_t PredicateImpl::get_index() const { return m_index; }
 
-const std::string& PredicateImpl::get_name() const { return m_name; }
+std::string_view PredicateImpl::get_name() const { return m_name; }
 
 const ParameterList& PredicateImpl::get_parameters() const { return m_parameters; }
 
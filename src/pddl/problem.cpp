@@ -60,8 +60,31 @@ ProblemImpl::ProblemImpl(size_t index,
     m_numeric_fluents(std::move(numeric_fluents)),
     m_goal_condition(std::move(goal_condition)),
     m_optimization_metric(std::move(optimization_metric)),
-    m_axioms(std::move(axioms))
+    m_axioms(std::move(axioms)),
+    m_positive_initial_literals(),
+    m_negative_initial_literals(),
+    m_positive_initial_atoms(),
+    m_negative_initial_atoms(),
+    m_objects_by_name(m_objects),
+    m_derived_predicates_by_name(m_derived_predicates)
 {
+    auto positive_initial_atoms = AtomList();
+    auto negative_initial_atoms = AtomList();
+    for (const auto& literal : m_initial_literals)
+    {
+        if (literal->is_negated())
+        {
+            m_negative_initial_literals.push_back(literal);
+            negative_initial_atoms.push_back(literal->get_atom());
+        }
+        else
+        {
+            m_positive_initial_literals.push_back(literal);
+            positive_initial_atoms.push_back(literal->get_atom());
+        }
+    }
+    m_positive_initial_atoms = AtomIndex(positive_initial_atoms);
+    m_negative_initial_atoms = AtomIndex(negative_initial_atoms);
 }
 
 size_t ProblemImpl::get_index() const { return m_index; }
@@ -88,6 +111,26 @@ const std::optional<OptimizationMetric>& ProblemImpl::get_optimization_metric()
 
 const AxiomList& ProblemImpl::get_axioms() const { return m_axioms; }
 
+const LiteralList& ProblemImpl::get_positive_initial_literals() const { return m_positive_initial_literals; }
+
+const LiteralList& ProblemImpl::get_negative_initial_literals() const { return m_negative_initial_literals; }
+
+const AtomIndex& ProblemImpl::get_positive_initial_atoms() const { return m_positive_initial_atoms; }
+
+const AtomIndex& ProblemImpl::get_negative_initial_atoms() const { return m_negative_initial_atoms; }
+
+std::optional<Object> ProblemImpl::find_object(std::string_view name) const
+{
+    const auto object = m_objects_by_name.find(name);
+    if (object.has_value())
+    {
+        return object;
+    }
+    return m_domain->find_constant(name);
+}
+
+std::optional<Predicate> ProblemImpl::find_derived_predicate(std::string_view name) const { return m_derived_predicates_by_name.find(name); }
+
 std::ostream& operator<<(std::ostream& out, const ProblemImpl& element)
 {
     auto formatter = PDDLFormatter();
@@ -17,129 +17,168 @@
 
 #include "loki/details/pddl/scope.hpp"
 
+#include <limits>
+
 namespace loki
 {
-Scope::Scope(const PDDLErrorHandler& error_handler, const Scope* parent_scope) : m_error_handler(error_handler), m_parent_scope(parent_scope) {}
+Scope::Scope(ScopeStack& scope_stack, size_t depth) : m_scope_stack(scope_stack), m_depth(depth) {}
+
+std::optional<BindingSearchResult<Type>> Scope::get_type(std::string_view name) const { return m_scope_stack.get<Type>(name, m_depth); }
+
+std::optional<BindingSearchResult<Object>> Scope::get_object(std::string_view name) const { return m_scope_stack.get<Object>(name, m_depth); }
 
-std::optional<BindingSearchResult<Type>> Scope::get_type(const std::string& name) const
+std::optional<BindingSearchResult<FunctionSkeleton>> Scope::get_function_skeleton(std::string_view name) const
 {
-    const auto it = m_types.find(name);
-    if (it != m_types.end())
-        return std::make_tuple(it->second.first, it->second.second, std::cref(m_error_handler));
-    if (m_parent_scope)
-    {
-        return m_parent_scope->get_type(name);
-    }
-    return std::nullopt;
+    return m_scope_stack.get<FunctionSkeleton>(name, m_depth);
 }
 
-std::optional<BindingSearchResult<Object>> Scope::get_object(const std::string& name) const
+std::optional<BindingSearchResult<Variable>> Scope::get_variable(std::string_view name) const { return m_scope_stack.get<Variable>(name, m_depth); }
+
+std::optional<BindingSearchResult<Predicate>> Scope::get_predicate(std::string_view name) const { return m_scope_stack.get<Predicate>(name, m_depth); }
+
+void Scope::insert_type(std::string_view name, const Type& element, const std::optional<Position>& position)
 {
-    const auto it = m_objects.find(name);
-    if (it != m_objects.end())
-        return std::make_tuple(it->second.first, it->second.second, std::cref(m_error_handler));
-    if (m_parent_scope)
-    {
-        return m_parent_scope->get_object(name);
-    }
-    return std::nullopt;
+    assert(m_depth + 1 == m_scope_stack.size());
+    assert(!this->get_type(name));
+    m_scope_stack.insert(name, element, position);
 }
 
-std::optional<BindingSearchResult<FunctionSkeleton>> Scope::get_function_skeleton(const std::string& name) const
+void Scope::insert_object(std::string_view name, const Object& element, const std::optional<Position>& position)
 {
-    const auto it = m_function_skeletons.find(name);
-    if (it != m_function_skeletons.end())
-        return std::make_tuple(it->second.first, it->second.second, std::cref(m_error_handler));
-    if (m_parent_scope)
-    {
-        return m_parent_scope->get_function_skeleton(name);
-    }
-    return std::nullopt;
+    assert(m_depth + 1 == m_scope_stack.size());
+    assert(!this->get_object(name));
+    m_scope_stack.insert(name, element, position);
 }
 
-std::optional<BindingSearchResult<Variable>> Scope::get_variable(const std::string& name) const
+void Scope::insert_function_skeleton(std::string_view name, const FunctionSkeleton& element, const std::optional<Position>& position)
 {
-    const auto it = m_variables.find(name);
-    if (it != m_variables.end())
-        return std::make_tuple(it->second.first, it->second.second, std::cref(m_error_handler));
-    if (m_parent_scope)
-    {
-        return m_parent_scope->get_variable(name);
-    }
-    return std::nullopt;
+    assert(m_depth + 1 == m_scope_stack.size());
+    assert(!this->get_function_skeleton(name));
+    m_scope_stack.insert(name, element, position);
 }
 
-std::optional<BindingSearchResult<Predicate>> Scope::get_predicate(const std::string& name) const
+void Scope::insert_variable(std::string_view name, const Variable& element, const std::optional<Position>& position)
 {
-    const auto it = m_predicates.find(name);
-    if (it != m_predicates.end())
-        return std::make_tuple(it->second.first, it->second.second, std::cref(m_error_handler));
-    if (m_parent_scope)
-    {
-        return m_parent_scope->get_predicate(name);
-    }
-    return std::nullopt;
+    assert(m_depth + 1 == m_scope_stack.size());
+    assert(!this->get_variable(name));
+    m_scope_stack.insert(name, element, position);
 }
 
-void Scope::insert_type(const std::string& name, const Type& element, const std::optional<Position>& position)
+void Scope::insert_predicate(std::string_view name, const Predicate& element, const std::optional<Position>& position)
 {
-    assert(!this->get_type(name));
-    m_types.emplace(name, BindingValueType<Type>(element, position));
+    assert(m_depth + 1 == m_scope_stack.size());
+    assert(!this->get_predicate(name));
+    m_scope_stack.insert(name, element, position);
 }
 
-void Scope::insert_object(const std::string& name, const Object& element, const std::optional<Position>& position)
+const PDDLErrorHandler& Scope::get_error_handler() const { return m_scope_stack.m_error_handler; }
+
+ScopeStack::ScopeStack(const PDDLErrorHandler& error_handler, const ScopeStack* parent) :
+    m_error_handler(error_handler),
+    m_parent(parent),
+    m_name_ids(),
+    m_symbol_tables(),
+    m_undo_log(),
+    m_undo_log_marks(),
+    m_scopes()
 {
-    assert(!this->get_object(name));
-    m_objects.emplace(name, BindingValueType<Object>(element, position));
 }
 
-void Scope::insert_function_skeleton(const std::string& name, const FunctionSkeleton& element, const std::optional<Position>& position)
+static constexpr size_t NO_BINDING = std::numeric_limits<size_t>::max();
+
+template<typename T>
+std::optional<BindingSearchResult<T>> ScopeStack::get(std::string_view name, size_t depth) const
 {
-    assert(!this->get_function_skeleton(name));
-    m_function_skeletons.emplace(name, BindingValueType<FunctionSkeleton>(element, position));
+    const auto it = m_name_ids.find(name);
+    if (it != m_name_ids.end())
+    {
+        const auto& symbol_table = std::get<SymbolTable<T>>(m_symbol_tables);
+        if (it->second < symbol_table.innermost.size())
+        {
+            // Skip bindings of deeper scopes, which are only visible when looking up from a scope below the top.
+            auto index = symbol_table.innermost[it->second];
+            while (index != NO_BINDING && symbol_table.entries[index].depth > depth)
+            {
+                index = symbol_table.entries[index].shadowed;
+            }
+            if (index != NO_BINDING)
+            {
+                const auto& binding = symbol_table.entries[index].binding;
+                return std::make_tuple(binding.first, binding.second, std::cref(m_error_handler));
+            }
+        }
+    }
+    if (m_parent)
+    {
+        return m_parent->get<T>(name, m_parent->size() - 1);
+    }
+    return std::nullopt;
 }
 
-void Scope::insert_variable(const std::string& name, const Variable& element, const std::optional<Position>& position)
+template<typename T>
+void ScopeStack::insert(std::string_view name, const T& element, const std::optional<Position>& position)
 {
-    assert(!this->get_variable(name));
-    m_variables.emplace(name, BindingValueType<Variable>(element, position));
+    assert(!m_scopes.empty());
+    auto it = m_name_ids.find(name);
+    if (it == m_name_ids.end())
+    {
+        it = m_name_ids.emplace(std::string(name), m_name_ids.size()).first;
+    }
+    const auto name_id = it->second;
+    auto& symbol_table = std::get<SymbolTable<T>>(m_symbol_tables);
+    if (name_id >= symbol_table.innermost.size())
+    {
+        symbol_table.innermost.resize(name_id + 1, NO_BINDING);
+    }
+    // The binding keeps the byte offsets of the position since the error handler releases the matched positions after parsing.
+    const auto source_position = position.has_value() ? std::optional<SourcePosition>(m_error_handler.get_source_position(position.value())) : std::nullopt;
+    symbol_table.entries.push_back(SymbolTableEntry<T> { BindingValueType<T>(element, source_position), size() - 1, symbol_table.innermost[name_id] });
+    symbol_table.innermost[name_id] = symbol_table.entries.size() - 1;
+    m_undo_log.emplace_back(&ScopeStack::undo<T>, name_id);
 }
 
-void Scope::insert_predicate(const std::string& name, const Predicate& element, const std::optional<Position>& position)
+template<typename T>
+void ScopeStack::undo(size_t name_id)
 {
-    assert(!this->get_predicate(name));
-    m_predicates.emplace(name, BindingValueType<Predicate>(element, position));
+    auto& symbol_table = std::get<SymbolTable<T>>(m_symbol_tables);
+    assert(!symbol_table.entries.empty() && symbol_table.innermost[name_id] == symbol_table.entries.size() - 1);
+    symbol_table.innermost[name_id] = symbol_table.entries.back().shadowed;
+    symbol_table.entries.pop_back();
 }
 
-const PDDLErrorHandler& Scope::get_error_handler() const { return m_error_handler; }
-
-ScopeStack::ScopeStack(const PDDLErrorHandler& error_handler, const ScopeStack* parent) : m_error_handler(error_handler), m_parent(parent) {}
-
 void ScopeStack::open_scope()
 {
-    // Link to parent Scope across parent ScopeStacks.
-    m_stack.push_back(m_stack.empty() ?
-                          (m_parent ? std::make_unique<Scope>(m_error_handler, m_parent->m_stack.back().get()) : std::make_unique<Scope>(m_error_handler)) :
-                          std::make_unique<Scope>(m_error_handler, m_stack.back().get()));
+    if (m_undo_log_marks.size() == m_scopes.size())
+    {
+        m_scopes.emplace_back(*this, m_scopes.size());
+    }
+    m_undo_log_marks.push_back(m_undo_log.size());
 }
 
 void ScopeStack::close_scope()
 {
-    assert(!m_stack.empty());
-    m_stack.pop_back();
+    assert(!m_undo_log_marks.empty());
+    const auto mark = m_undo_log_marks.back();
+    while (m_undo_log.size() > mark)
+    {
+        const auto [undo_function, name_id] = m_undo_log.back();
+        (this->*undo_function)(name_id);
+        m_undo_log.pop_back();
+    }
+    m_undo_log_marks.pop_back();
 }
 
 Scope& ScopeStack::top()
 {
-    assert(!m_stack.empty());
-    return *m_stack.back();
+    assert(!m_undo_log_marks.empty());
+    return m_scopes[m_undo_log_marks.size() - 1];
 }
 const Scope& ScopeStack::top() const
 {
-    assert(!m_stack.empty());
-    return *m_stack.back();
+    assert(!m_undo_log_marks.empty());
+    return m_scopes[m_undo_log_marks.size() - 1];
 }
 
-const std::deque<std::unique_ptr<Scope>>& ScopeStack::get_stack() const { return m_stack; }
+size_t ScopeStack::size() const { return m_undo_log_marks.size(); }
 
-}
\ No newline at end of file
+}
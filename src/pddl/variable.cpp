@@ -24,76 +24,78 @@
 #include "loki/details/pddl/parameter.hpp"
 #include "loki/details/pddl/term.hpp"
 
+#include <vector>
+
 namespace loki
 {
-VariableImpl::VariableImpl(size_t index, std::string name) : m_index(index), m_name(std::move(name)) {}
+VariableImpl::VariableImpl(size_t index, std::string_view name) : m_index(index), m_name(name) {}
 
 size_t VariableImpl::get_index() const { return m_index; }
 
-const std::string& VariableImpl::get_name() const { return m_name; }
+std::string_view VariableImpl::get_name() const { return m_name; }
 
-static void collect_free_variables_recursively(const loki::ConditionImpl& condition, VariableSet& ref_quantified_variables, VariableSet& ref_free_variables)
+VariableSet collect_free_variables(const Condition& condition)
 {
-    if (const auto condition_literal = std::get_if<loki::ConditionLiteralImpl>(&condition))
+    auto quantified_variables = VariableSet {};
+    auto free_variables = VariableSet {};
+
+    // Visit the conditions in pre-order with an explicit stack, such that deeply nested conditions do not overflow the stack.
+    // The children are pushed in reverse order to visit them from left to right.
+    auto stack = std::vector<Condition> { condition };
+    while (!stack.empty())
     {
-        for (const auto& term : condition_literal->get_literal()->get_atom()->get_terms())
+        const auto current = stack.back();
+        stack.pop_back();
+
+        if (const auto condition_literal = get_if<ConditionLiteral>(current))
         {
-            if (const auto term_variable = std::get_if<loki::TermVariableImpl>(term))
+            for (const auto& term : condition_literal->get_literal()->get_atom()->get_terms())
             {
-                if (!ref_quantified_variables.count(term_variable->get_variable()))
+                if (const auto term_variable = std::get_if<loki::TermVariableImpl>(term))
                 {
-                    ref_free_variables.insert(term_variable->get_variable());
+                    if (!quantified_variables.count(term_variable->get_variable()))
+                    {
+                        free_variables.insert(term_variable->get_variable());
+                    }
                 }
             }
         }
-    }
-    else if (const auto condition_imply = std::get_if<loki::ConditionImplyImpl>(&condition))
-    {
-        collect_free_variables_recursively(*condition_imply->get_condition_left(), ref_quantified_variables, ref_free_variables);
-        collect_free_variables_recursively(*condition_imply->get_condition_right(), ref_quantified_variables, ref_free_variables);
-    }
-    else if (const auto condition_not = std::get_if<loki::ConditionNotImpl>(&condition))
-    {
-        collect_free_variables_recursively(*condition_not->get_condition(), ref_quantified_variables, ref_free_variables);
-    }
-    else if (const auto condition_and = std::get_if<loki::ConditionAndImpl>(&condition))
-    {
-        for (const auto& part : condition_and->get_conditions())
+        else if (const auto condition_imply = get_if<ConditionImply>(current))
         {
-            collect_free_variables_recursively(*part, ref_quantified_variables, ref_free_variables);
+            stack.push_back(condition_imply->get_condition_right());
+            stack.push_back(condition_imply->get_condition_left());
         }
-    }
-    else if (const auto condition_or = std::get_if<loki::ConditionOrImpl>(&condition))
-    {
-        for (const auto& part : condition_or->get_conditions())
+        else if (const auto condition_not = get_if<ConditionNot>(current))
         {
-            collect_free_variables_recursively(*part, ref_quantified_variables, ref_free_variables);
+            stack.push_back(condition_not->get_condition());
         }
-    }
-    else if (const auto condition_exists = std::get_if<loki::ConditionExistsImpl>(&condition))
-    {
-        for (const auto& parameter : condition_exists->get_parameters())
+        else if (const auto condition_and = get_if<ConditionAnd>(current))
         {
-            ref_quantified_variables.insert(parameter->get_variable());
+            const auto& parts = condition_and->get_conditions();
+            stack.insert(stack.end(), parts.rbegin(), parts.rend());
         }
-        collect_free_variables_recursively(*condition_exists->get_condition(), ref_quantified_variables, ref_free_variables);
-    }
-    else if (const auto condition_forall = std::get_if<loki::ConditionForallImpl>(&condition))
-    {
-        for (const auto& parameter : condition_forall->get_parameters())
+        else if (const auto condition_or = get_if<ConditionOr>(current))
+        {
+            const auto& parts = condition_or->get_conditions();
+            stack.insert(stack.end(), parts.rbegin(), parts.rend());
+        }
+        else if (const auto condition_exists = get_if<ConditionExists>(current))
         {
-            ref_quantified_variables.insert(parameter->get_variable());
+            for (const auto& parameter : condition_exists->get_parameters())
+            {
+                quantified_variables.insert(parameter->get_variable());
+            }
+            stack.push_back(condition_exists->get_condition());
+        }
+        else if (const auto condition_forall = get_if<ConditionForall>(current))
+        {
+            for (const auto& parameter : condition_forall->get_parameters())
+            {
+                quantified_variables.insert(parameter->get_variable());
+            }
+            stack.push_back(condition_forall->get_condition());
         }
-        collect_free_variables_recursively(*condition_forall->get_condition(), ref_quantified_variables, ref_free_variables);
     }
-}
-
-VariableSet collect_free_variables(const ConditionImpl& condition)
-{
-    auto quantified_variables = VariableSet {};
-    auto free_variables = VariableSet {};
-
-    collect_free_variables_recursively(condition, quantified_variables, free_variables);
 
     return free_variables;
 }
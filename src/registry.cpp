@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "loki/details/registry.hpp"
+
+#include "loki/details/pddl/factories.hpp"
+
+#include <cctype>
+#include <functional>
+#include <string_view>
+
+namespace loki
+{
+
+DomainRegistry::DomainRegistry(size_t memory_budget, const DomainParserOptions& options) :
+    m_memory_budget(memory_budget),
+    m_options(options),
+    m_mutex(),
+    m_entries(),
+    m_entry_by_hash(),
+    m_memory_usage(0),
+    m_num_hits(0),
+    m_num_misses(0)
+{
+}
+
+/// @brief Collapse each sequence of whitespace into a single space such that the layout of the text does not matter.
+static std::string collapse_whitespace(const std::string& source)
+{
+    auto result = std::string();
+    result.reserve(source.size());
+    for (const auto c : source)
+    {
+        if (std::isspace(static_cast<unsigned char>(c)))
+        {
+            if (!result.empty() && result.back() != ' ')
+            {
+                result.push_back(' ');
+            }
+        }
+        else
+        {
+            result.push_back(c);
+        }
+    }
+    if (!result.empty() && result.back() == ' ')
+    {
+        result.pop_back();
+    }
+    return result;
+}
+
+void DomainRegistry::evict()
+{
+    while (m_memory_usage > m_memory_budget && m_entries.size() > 1)
+    {
+        const auto& entry = m_entries.back();
+        m_memory_usage -= entry.memory_usage;
+        m_entry_by_hash.erase(entry.hash);
+        m_entries.pop_back();
+    }
+}
+
+std::shared_ptr<const DomainParser> DomainRegistry::get_or_parse(const fs::path& domain_file_path)
+{
+    auto source = read_file(domain_file_path);
+    auto text = collapse_whitespace(source);
+    const auto hash = std::hash<std::string_view>()(text);
+
+    {
+        auto lock = std::unique_lock<std::mutex>(m_mutex);
+        const auto it = m_entry_by_hash.find(hash);
+        // Compare the text to rule out hash collisions.
+        if (it != m_entry_by_hash.end() && it->second->text == text)
+        {
+            ++m_num_hits;
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+            return it->second->domain_parser;
+        }
+        ++m_num_misses;
+    }
+
+    // Parse without holding the lock such that other domains can be looked up in the meantime.
+    auto domain_parser = std::make_shared<DomainParser>(DomainParser(domain_file_path, std::move(source), m_options));
+    domain_parser->freeze(true);
+    const auto memory_usage = domain_parser->m_source.size() + text.size() + domain_parser->get_factories().get_estimated_memory_usage();
+
+    auto lock = std::unique_lock<std::mutex>(m_mutex);
+    const auto it = m_entry_by_hash.find(hash);
+    if (it != m_entry_by_hash.end())
+    {
+        if (it->second->text == text)
+        {
+            // Another thread cached the same domain in the meantime.
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+            return it->second->domain_parser;
+        }
+        // Replace the domain whose hash collides.
+        m_memory_usage -= it->second->memory_usage;
+        m_entries.erase(it->second);
+        m_entry_by_hash.erase(it);
+    }
+    m_entries.push_front(Entry { hash, std::move(text), domain_parser, memory_usage });
+    m_entry_by_hash.emplace(hash, m_entries.begin());
+    m_memory_usage += memory_usage;
+    evict();
+    return domain_parser;
+}
+
+size_t DomainRegistry::size() const
+{
+    auto lock = std::unique_lock<std::mutex>(m_mutex);
+    return m_entries.size();
+}
+
+size_t DomainRegistry::get_memory_usage() const
+{
+    auto lock = std::unique_lock<std::mutex>(m_mutex);
+    return m_memory_usage;
+}
+
+size_t DomainRegistry::get_num_hits() const
+{
+    auto lock = std::unique_lock<std::mutex>(m_mutex);
+    return m_num_hits;
+}
+
+size_t DomainRegistry::get_num_misses() const
+{
+    auto lock = std::unique_lock<std::mutex>(m_mutex);
+    return m_num_misses;
+}
+
+}
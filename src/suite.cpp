@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "loki/details/suite.hpp"
+
+#include "loki/details/pddl/factories.hpp"
+#include "loki/details/utils/memory.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <future>
+#include <iomanip>
+#include <system_error>
+
+namespace loki
+{
+
+std::vector<Benchmark> discover_benchmarks(const fs::path& directory)
+{
+    auto benchmarks = std::vector<Benchmark>();
+    for (const auto& entry : fs::recursive_directory_iterator(directory))
+    {
+        if (!entry.is_regular_file() || entry.path().filename() != "domain.pddl")
+        {
+            continue;
+        }
+        auto benchmark = Benchmark { entry.path(), {} };
+        for (const auto& file : fs::directory_iterator(entry.path().parent_path()))
+        {
+            const auto filename = file.path().filename().string();
+            if (file.is_regular_file() && file.path().extension() == ".pddl" && filename.find("domain") == std::string::npos)
+            {
+                benchmark.problem_files.push_back(file.path());
+            }
+        }
+        std::sort(benchmark.problem_files.begin(), benchmark.problem_files.end());
+        benchmarks.push_back(std::move(benchmark));
+    }
+    std::sort(benchmarks.begin(), benchmarks.end(), [](const auto& lhs, const auto& rhs) { return lhs.domain_file < rhs.domain_file; });
+    return benchmarks;
+}
+
+double ParseStatistics::megabytes_per_second() const { return (seconds > 0.) ? num_bytes / (1024. * 1024.) / seconds : 0.; }
+
+double ParseStatistics::atoms_per_second() const { return (seconds > 0.) ? num_atoms / seconds : 0.; }
+
+/// @brief Measure `parse_function` that returns the parser of the file and record an exception as the error of the statistics.
+template<typename Parser, typename ParseFunction>
+static std::optional<Parser> parse_and_measure(const fs::path& file_path, ParseStatistics& statistics, ParseFunction&& parse_function)
+{
+    statistics = ParseStatistics { file_path, false, "", 0., 0, 0, 0. };
+    try
+    {
+        statistics.num_bytes = fs::file_size(file_path);
+    }
+    catch (const fs::filesystem_error&)
+    {
+        // The parse reports the missing file.
+    }
+
+    auto result = std::optional<Parser>();
+    const auto start = std::chrono::high_resolution_clock::now();
+    try
+    {
+        result.emplace(parse_function());
+        statistics.success = true;
+    }
+    catch (const std::exception& e)
+    {
+        statistics.error = e.what();
+    }
+    const auto stop = std::chrono::high_resolution_clock::now();
+    statistics.seconds = std::chrono::duration<double>(stop - start).count();
+    if (result.has_value())
+    {
+        statistics.num_atoms = result->get_factories().template get_factory<AtomFactory>().size();
+    }
+    statistics.peak_resident_set = process_peak_mem_usage();
+    return result;
+}
+
+LoadedBenchmark load_benchmark(const Benchmark& benchmark, size_t num_threads, const DomainParserOptions& domain_options, const ProblemParserOptions& problem_options)
+{
+    auto result = LoadedBenchmark();
+    auto domain_parser =
+        parse_and_measure<DomainParser>(benchmark.domain_file, result.domain_statistics, [&] { return DomainParser(benchmark.domain_file, domain_options); });
+
+    result.problem_parsers.resize(benchmark.problem_files.size());
+    result.problem_statistics.resize(benchmark.problem_files.size());
+    if (!domain_parser.has_value())
+    {
+        for (size_t i = 0; i < benchmark.problem_files.size(); ++i)
+        {
+            result.problem_statistics[i] = ParseStatistics { benchmark.problem_files[i], false, "The domain failed to parse.", 0., 0, 0, 0. };
+        }
+        return result;
+    }
+    result.domain_parser = std::make_unique<DomainParser>(std::move(domain_parser.value()));
+    result.domain_parser->freeze();
+
+    {
+        auto thread_pool = ThreadPool(num_threads);
+        auto futures = std::vector<std::future<void>>();
+        futures.reserve(benchmark.problem_files.size());
+        for (size_t i = 0; i < benchmark.problem_files.size(); ++i)
+        {
+            futures.push_back(thread_pool.submit(
+                [&benchmark, &result, &problem_options, i]
+                {
+                    const auto& problem_file = benchmark.problem_files[i];
+                    result.problem_parsers[i] = parse_and_measure<ProblemParser>(problem_file,
+                                                                                 result.problem_statistics[i],
+                                                                                 [&] { return parse_problem(problem_file, *result.domain_parser, problem_options); });
+                }));
+        }
+        for (auto& future : futures)
+        {
+            future.get();
+        }
+    }
+    return result;
+}
+
+/// @brief Write the string as a JSON string literal.
+static void write_json_string(std::ostream& out, const std::string& str)
+{
+    out << '"';
+    for (const auto c : str)
+    {
+        switch (c)
+        {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+                }
+                else
+                {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+std::ostream& operator<<(std::ostream& out, const ParseStatistics& statistics)
+{
+    out << "{\"file\": ";
+    write_json_string(out, statistics.file_path.string());
+    out << ", \"success\": " << (statistics.success ? "true" : "false");
+    out << ", \"seconds\": " << statistics.seconds;
+    out << ", \"bytes\": " << statistics.num_bytes;
+    out << ", \"atoms\": " << statistics.num_atoms;
+    out << ", \"mb_per_second\": " << statistics.megabytes_per_second();
+    out << ", \"atoms_per_second\": " << statistics.atoms_per_second();
+    out << ", \"peak_rss_kb\": " << statistics.peak_resident_set;
+    out << ", \"error\": ";
+    write_json_string(out, statistics.error);
+    out << "}";
+    return out;
+}
+
+}
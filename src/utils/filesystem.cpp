@@ -20,47 +20,221 @@
 #include "loki/details/exceptions.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cctype>
 #include <fstream>
-#include <sstream>
 #include <string>
 
+#ifdef LOKI_WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef LOKI_WITH_LZMA
+#include <lzma.h>
+#endif
+
 namespace loki
 {
 
+// Size of the chunks in which files are read and decompressed.
+static constexpr size_t CHUNK_SIZE = 1 << 16;
+
+/// @brief `TextNormalizer` appends normalized text to the output chunk by chunk such that a line may span several chunks.
+class TextNormalizer
+{
+private:
+    std::string& m_output;
+
+    bool m_in_comment;
+    bool m_at_line_start;
+
+public:
+    explicit TextNormalizer(std::string& output) : m_output(output), m_in_comment(false), m_at_line_start(true) {}
+
+    void append(const char* data, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            const auto c = data[i];
+            m_at_line_start = false;
+            if (c == '\n')
+            {
+                m_output.push_back('\n');
+                m_in_comment = false;
+                m_at_line_start = true;
+            }
+            else if (m_in_comment)
+            {
+                // Strip comments
+                continue;
+            }
+            else if (c == ';')
+            {
+                m_in_comment = true;
+            }
+            else if (c == '\t')
+            {
+                // Replace tabs with four spaces
+                m_output.append(4, ' ');
+            }
+            else
+            {
+                // Convert to lowercase
+                m_output.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+            }
+        }
+    }
+
+    /// @brief Terminate the last line.
+    void finish()
+    {
+        if (!m_at_line_start)
+        {
+            m_output.push_back('\n');
+            m_at_line_start = true;
+        }
+    }
+};
+
+static void read_plain(std::ifstream& file, TextNormalizer& normalizer)
+{
+    auto buffer = std::array<char, CHUNK_SIZE>();
+    while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0)
+    {
+        normalizer.append(buffer.data(), file.gcount());
+    }
+}
+
+static void read_gzip(const fs::path& file_path, TextNormalizer& normalizer)
+{
+#ifdef LOKI_WITH_ZLIB
+    // gzread also decompresses files that consist of several concatenated gzip members.
+    const auto file = gzopen(file_path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        throw FileNotExistsError(std::string(file_path.c_str()));
+    }
+    gzbuffer(file, CHUNK_SIZE);
+    auto buffer = std::array<char, CHUNK_SIZE>();
+    int num_bytes;
+    while ((num_bytes = gzread(file, buffer.data(), buffer.size())) > 0)
+    {
+        normalizer.append(buffer.data(), num_bytes);
+    }
+    if (num_bytes < 0)
+    {
+        int error_code;
+        const auto message = std::string(gzerror(file, &error_code));
+        gzclose(file);
+        throw DecompressionError(std::string(file_path.c_str()), message);
+    }
+    gzclose(file);
+#else
+    static_cast<void>(normalizer);
+    throw NotImplementedError("Reading the gzip compressed file " + std::string(file_path.c_str()) + " requires Loki to be built with zlib.");
+#endif
+}
+
+static void read_xz(std::ifstream& file, const fs::path& file_path, TextNormalizer& normalizer)
+{
+#ifdef LOKI_WITH_LZMA
+    auto stream = lzma_stream(LZMA_STREAM_INIT);
+    if (lzma_stream_decoder(&stream, UINT64_MAX, LZMA_CONCATENATED) != LZMA_OK)
+    {
+        throw DecompressionError(std::string(file_path.c_str()), "failed to initialize the xz decoder");
+    }
+    auto input = std::array<uint8_t, CHUNK_SIZE>();
+    auto output = std::array<uint8_t, CHUNK_SIZE>();
+    auto action = LZMA_RUN;
+    while (true)
+    {
+        if (stream.avail_in == 0 && action == LZMA_RUN)
+        {
+            file.read(reinterpret_cast<char*>(input.data()), input.size());
+            stream.next_in = input.data();
+            stream.avail_in = file.gcount();
+            if (file.eof())
+            {
+                action = LZMA_FINISH;
+            }
+        }
+        stream.next_out = output.data();
+        stream.avail_out = output.size();
+        const auto result = lzma_code(&stream, action);
+        normalizer.append(reinterpret_cast<const char*>(output.data()), output.size() - stream.avail_out);
+        if (result == LZMA_STREAM_END)
+        {
+            break;
+        }
+        if (result != LZMA_OK)
+        {
+            lzma_end(&stream);
+            throw DecompressionError(std::string(file_path.c_str()), "corrupt or truncated xz data (error code " + std::to_string(result) + ")");
+        }
+    }
+    lzma_end(&stream);
+#else
+    static_cast<void>(file);
+    static_cast<void>(normalizer);
+    throw NotImplementedError("Reading the xz compressed file " + std::string(file_path.c_str()) + " requires Loki to be built with liblzma.");
+#endif
+}
+
 std::string read_file(const fs::path& file_path)
 {
-    std::ifstream file(file_path.c_str());
+    auto result = std::string();
+    read_file(file_path, result);
+    return result;
+}
+
+void read_file(const fs::path& file_path, std::string& result)
+{
+    result.clear();
+    std::ifstream file(file_path.c_str(), std::ios::binary);
     if (!file.is_open())
     {
         throw FileNotExistsError(std::string(file_path.c_str()));
     }
 
-    std::stringstream buffer;
-    std::string line;
+    // Detect the compression format by the magic bytes at the start of the file.
+    static constexpr auto gzip_magic = std::array<unsigned char, 2> { 0x1f, 0x8b };
+    static constexpr auto xz_magic = std::array<unsigned char, 6> { 0xfd, '7', 'z', 'X', 'Z', 0x00 };
+    auto magic = std::array<unsigned char, 6>();
+    file.read(reinterpret_cast<char*>(magic.data()), magic.size());
+    const auto num_magic_bytes = static_cast<size_t>(file.gcount());
+    file.clear();
+    file.seekg(0);
 
-    while (std::getline(file, line))
+    auto normalizer = TextNormalizer(result);
+    if (num_magic_bytes >= gzip_magic.size() && std::equal(gzip_magic.begin(), gzip_magic.end(), magic.begin()))
+    {
+        file.close();
+        read_gzip(file_path, normalizer);
+    }
+    else if (num_magic_bytes >= xz_magic.size() && std::equal(xz_magic.begin(), xz_magic.end(), magic.begin()))
+    {
+        read_xz(file, file_path, normalizer);
+    }
+    else
     {
-        // Strip comments
-        size_t commentPos = line.find(';');
-        if (commentPos != std::string::npos)
+        try
         {
-            line = line.substr(0, commentPos);
+            result.reserve(fs::file_size(file_path) + 1);
         }
-
-        // Replace tabs with four spaces
-        size_t tabPos = 0;
-        while ((tabPos = line.find('\t', tabPos)) != std::string::npos)
+        catch (const fs::filesystem_error&)
         {
-            line.replace(tabPos, 1, "    ");
-            tabPos += 4;  // Move past the new spaces
+            // The size is only a hint, e.g., a pipe has none.
         }
-
-        // Convert line to lowercase
-        std::transform(line.begin(), line.end(), line.begin(), [](unsigned char c) { return std::tolower(c); });
-
-        buffer << line << '\n';
+        read_plain(file, normalizer);
     }
-    return buffer.str();
+    normalizer.finish();
 }
 
-}
\ No newline at end of file
+std::string normalize_text(std::string_view text)
+{
+    auto result = std::string();
+    auto normalizer = TextNormalizer(result);
+    normalizer.append(text.data(), text.size());
+    return result;
+}
+
+}
@@ -23,6 +23,7 @@
 #include <ios>
 #include <iostream>
 #include <string>
+#include <sys/resource.h>
 #include <unistd.h>
 
 namespace loki
@@ -62,6 +63,17 @@ std::tuple<double, double> process_mem_usage()
     return std::make_tuple(vm_usage, resident_set);
 }
 
+double process_peak_mem_usage()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0.0;
+    }
+    // On Linux, ru_maxrss is given in KB.
+    return usage.ru_maxrss;
+}
+
 }
 
 #endif  // __linux__
@@ -71,6 +83,7 @@ std::tuple<double, double> process_mem_usage()
 #include "loki/details/utils/memory.hpp"
 
 #include <mach/mach.h>
+#include <sys/resource.h>
 
 namespace loki
 {
@@ -92,6 +105,17 @@ std::tuple<double, double> process_mem_usage()
     return std::make_tuple(vm_usage, resident_set);
 }
 
+double process_peak_mem_usage()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0.0;
+    }
+    // On macOS, ru_maxrss is given in bytes.
+    return usage.ru_maxrss / 1024.0;
+}
+
 }  // namespace utils
 
 #endif  // __APPLE__
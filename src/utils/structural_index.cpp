@@ -0,0 +1,312 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "loki/details/utils/structural_index.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define LOKI_STRUCTURAL_INDEX_X86
+#include <immintrin.h>
+#endif
+
+namespace loki
+{
+
+// The number of bytes that are classified at once, one bit per byte.
+static constexpr size_t BLOCK_SIZE = 64;
+
+/// @brief The classification of the bytes of a block, where bit i refers to byte i.
+struct BlockMasks
+{
+    uint64_t open;
+    uint64_t close;
+    uint64_t whitespace;
+    uint64_t colon;
+};
+
+static bool is_whitespace(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+static BlockMasks classify_scalar(const char* block)
+{
+    auto masks = BlockMasks { 0, 0, 0, 0 };
+    for (size_t i = 0; i < BLOCK_SIZE; ++i)
+    {
+        const auto bit = uint64_t { 1 } << i;
+        const auto c = block[i];
+        masks.open |= (c == '(') ? bit : 0;
+        masks.close |= (c == ')') ? bit : 0;
+        masks.whitespace |= is_whitespace(c) ? bit : 0;
+        masks.colon |= (c == ':') ? bit : 0;
+    }
+    return masks;
+}
+
+#ifdef LOKI_STRUCTURAL_INDEX_X86
+
+// SSE2 is part of x86-64, hence, it needs no runtime check.
+static inline BlockMasks classify_sse2(const char* block)
+{
+    const auto open = _mm_set1_epi8('(');
+    const auto close = _mm_set1_epi8(')');
+    const auto space = _mm_set1_epi8(' ');
+    const auto colon = _mm_set1_epi8(':');
+    const auto tab = _mm_set1_epi8('\t');
+    const auto control_range = _mm_set1_epi8('\r' - '\t');
+
+    auto masks = BlockMasks { 0, 0, 0, 0 };
+    for (size_t i = 0; i < BLOCK_SIZE; i += 16)
+    {
+        const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+        // The characters '\t' to '\r' are those whose unsigned distance to '\t' is at most '\r' - '\t'.
+        const auto distance = _mm_sub_epi8(chars, tab);
+        const auto is_control = _mm_cmpeq_epi8(_mm_min_epu8(distance, control_range), distance);
+        const auto is_whitespace = _mm_or_si128(_mm_cmpeq_epi8(chars, space), is_control);
+        masks.open |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, open)))) << i;
+        masks.close |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, close)))) << i;
+        masks.whitespace |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(is_whitespace))) << i;
+        masks.colon |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, colon)))) << i;
+    }
+    return masks;
+}
+
+__attribute__((target("avx2"))) static inline BlockMasks classify_avx2(const char* block)
+{
+    const auto open = _mm256_set1_epi8('(');
+    const auto close = _mm256_set1_epi8(')');
+    const auto space = _mm256_set1_epi8(' ');
+    const auto colon = _mm256_set1_epi8(':');
+    const auto tab = _mm256_set1_epi8('\t');
+    const auto control_range = _mm256_set1_epi8('\r' - '\t');
+
+    auto masks = BlockMasks { 0, 0, 0, 0 };
+    for (size_t i = 0; i < BLOCK_SIZE; i += 32)
+    {
+        const auto chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + i));
+        const auto distance = _mm256_sub_epi8(chars, tab);
+        const auto is_control = _mm256_cmpeq_epi8(_mm256_min_epu8(distance, control_range), distance);
+        const auto is_whitespace = _mm256_or_si256(_mm256_cmpeq_epi8(chars, space), is_control);
+        masks.open |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars, open)))) << i;
+        masks.close |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars, close)))) << i;
+        masks.whitespace |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(is_whitespace))) << i;
+        masks.colon |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars, colon)))) << i;
+    }
+    return masks;
+}
+
+#define LOKI_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define LOKI_ALWAYS_INLINE inline
+#endif
+
+/// @brief `OffsetWriter` appends offsets to a vector whose size is kept ahead of the number of appended offsets.
+///        Hence, the offsets of a block are written without growing the vector for each of them.
+class OffsetWriter
+{
+private:
+    std::vector<uint32_t>& m_offsets;
+    size_t m_size;
+
+public:
+    explicit OffsetWriter(std::vector<uint32_t>& offsets, size_t expected_size) : m_offsets(offsets), m_size(offsets.size())
+    {
+        m_offsets.resize(std::max(m_size + BLOCK_SIZE, expected_size));
+    }
+
+    /// @brief Append `offset` plus the position of each set bit.
+    LOKI_ALWAYS_INLINE void append(uint64_t bits, uint32_t offset)
+    {
+        if (m_size + BLOCK_SIZE > m_offsets.size())
+        {
+            m_offsets.resize(2 * m_offsets.size());
+        }
+        // Write the offsets in groups of four, where the surplus offsets of the last group are overwritten later.
+        auto* out = m_offsets.data() + m_size;
+        const auto count = static_cast<size_t>(std::popcount(bits));
+        for (size_t i = 0; i < count; i += 4)
+        {
+            out[i] = offset + static_cast<uint32_t>(std::countr_zero(bits));
+            bits &= bits - 1;
+            out[i + 1] = offset + static_cast<uint32_t>(std::countr_zero(bits));
+            bits &= bits - 1;
+            out[i + 2] = offset + static_cast<uint32_t>(std::countr_zero(bits));
+            bits &= bits - 1;
+            out[i + 3] = offset + static_cast<uint32_t>(std::countr_zero(bits));
+            bits &= bits - 1;
+        }
+        m_size += count;
+    }
+
+    /// @brief Drop the surplus offsets.
+    void finish() { m_offsets.resize(m_size); }
+};
+
+/// @brief Whether the token at the offset follows an opening parenthesis, possibly separated by whitespace.
+static bool follows_opening_parenthesis(std::string_view text, size_t offset)
+{
+    while (offset > 0 && is_whitespace(text[offset - 1]))
+    {
+        --offset;
+    }
+    return offset > 0 && text[offset - 1] == '(';
+}
+
+template<typename Classify>
+static LOKI_ALWAYS_INLINE void index_blocks(std::string_view text, StructuralIndex& index, Classify&& classify)
+{
+    // Whether the byte before the current block belongs to a token.
+    auto previous_is_token = uint64_t { 0 };
+    // Typical PDDL has a parenthesis every 8 bytes and a token every 6 bytes.
+    auto parentheses_writer = OffsetWriter(index.parentheses, text.size() / 8);
+    auto token_starts_writer = OffsetWriter(index.token_starts, text.size() / 6);
+    const auto process = [&](const BlockMasks& masks, uint32_t offset)
+    {
+        const auto parentheses = masks.open | masks.close;
+        const auto tokens = ~(parentheses | masks.whitespace);
+        const auto token_starts = tokens & ~((tokens << 1) | previous_is_token);
+        previous_is_token = tokens >> (BLOCK_SIZE - 1);
+
+        parentheses_writer.append(parentheses, offset);
+        token_starts_writer.append(token_starts, offset);
+        // Tokens starting with ':' are rare, hence, they are checked one by one.
+        for (auto candidates = token_starts & masks.colon; candidates != 0; candidates &= candidates - 1)
+        {
+            const auto keyword = offset + static_cast<uint32_t>(std::countr_zero(candidates));
+            if (follows_opening_parenthesis(text, keyword))
+            {
+                index.keywords.push_back(keyword);
+            }
+        }
+    };
+
+    const auto num_full_blocks = text.size() / BLOCK_SIZE;
+    for (size_t i = 0; i < num_full_blocks; ++i)
+    {
+        process(classify(text.data() + i * BLOCK_SIZE), static_cast<uint32_t>(i * BLOCK_SIZE));
+    }
+    // Pad the last block with whitespace, which starts no token.
+    const auto tail_size = text.size() % BLOCK_SIZE;
+    if (tail_size > 0)
+    {
+        auto tail = std::array<char, BLOCK_SIZE>();
+        tail.fill(' ');
+        std::memcpy(tail.data(), text.data() + num_full_blocks * BLOCK_SIZE, tail_size);
+        process(classify(tail.data()), static_cast<uint32_t>(num_full_blocks * BLOCK_SIZE));
+    }
+    parentheses_writer.finish();
+    token_starts_writer.finish();
+}
+
+static void index_structure_scalar(std::string_view text, StructuralIndex& index) { index_blocks(text, index, classify_scalar); }
+
+#ifdef LOKI_STRUCTURAL_INDEX_X86
+static void index_structure_sse2(std::string_view text, StructuralIndex& index) { index_blocks(text, index, classify_sse2); }
+
+__attribute__((target("avx2"))) static void index_structure_avx2(std::string_view text, StructuralIndex& index)
+{
+    index_blocks(text, index, classify_avx2);
+}
+#endif
+
+StructuralIndex index_structure(std::string_view text)
+{
+    auto index = StructuralIndex();
+    index_structure(text, index);
+    return index;
+}
+
+void index_structure(std::string_view text, StructuralIndex& result)
+{
+    if (text.size() > std::numeric_limits<uint32_t>::max())
+    {
+        throw std::length_error("index_structure: the text must have less than 2^32 bytes.");
+    }
+    result.parentheses.clear();
+    result.token_starts.clear();
+    result.keywords.clear();
+#ifdef LOKI_STRUCTURAL_INDEX_X86
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2)
+    {
+        index_structure_avx2(text, result);
+    }
+    else
+    {
+        index_structure_sse2(text, result);
+    }
+    static_cast<void>(index_structure_scalar);
+#else
+    index_structure_scalar(text, result);
+#endif
+}
+
+size_t StructuralIndex::find_closing_parenthesis(std::string_view text, size_t i) const
+{
+    size_t depth = 0;
+    for (; i < parentheses.size(); ++i)
+    {
+        if (text[parentheses[i]] == '(')
+        {
+            ++depth;
+        }
+        else if (--depth == 0)
+        {
+            return i;
+        }
+    }
+    return parentheses.size();
+}
+
+std::vector<StructuralIndex::Section> StructuralIndex::get_sections(std::string_view text) const
+{
+    auto sections = std::vector<Section>();
+    auto keyword = keywords.begin();
+    size_t depth = 0;
+    // Whether the form at depth 2 that is currently open is a section.
+    bool in_section = false;
+    for (const auto offset : parentheses)
+    {
+        if (text[offset] == '(')
+        {
+            if (++depth != 2)
+            {
+                continue;
+            }
+            // The keyword of a section is the first token after its opening parenthesis.
+            keyword = std::lower_bound(keyword, keywords.end(), offset);
+            in_section = keyword != keywords.end() && std::all_of(text.begin() + offset + 1, text.begin() + *keyword, is_whitespace);
+            if (in_section)
+            {
+                const auto keyword_end = std::find_if(text.begin() + *keyword, text.end(), [](char c) { return is_whitespace(c) || c == '(' || c == ')'; });
+                sections.push_back(Section { text.substr(*keyword, keyword_end - (text.begin() + *keyword)), offset, text.size() });
+            }
+        }
+        else if (depth > 0 && --depth == 1 && in_section)
+        {
+            sections.back().last = offset + 1;
+            in_section = false;
+        }
+    }
+    return sections;
+}
+
+}
@@ -15,8 +15,16 @@
  * along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include "temporary_file.hpp"
+
+#include <fstream>
 #include <gtest/gtest.h>
+#include <loki/details/exceptions.hpp>
 #include <loki/details/parser.hpp>
+#include <loki/details/pddl/atom.hpp>
+#include <loki/details/pddl/exceptions.hpp>
+#include <loki/details/pddl/problem.hpp>
+#include <sstream>
 
 namespace loki::domain::tests
 {
@@ -36,6 +44,520 @@ TEST(LokiTests, ParserTest)
     const auto problem = problem_parser.get_problem();
     EXPECT_EQ(problem->get_objects().size(), 4);
     EXPECT_EQ(problem->get_initial_literals().size(), 11);
+
+    // The flags can be passed positionally.
+    auto strict_domain_parser = DomainParser(domain_file, true, true);
+    const auto strict_problem_parser = ProblemParser(problem_file, strict_domain_parser, true);
+    EXPECT_EQ(strict_problem_parser.get_problem()->get_initial_literals().size(), 11);
+}
+
+TEST(LokiTests, ParserParseProblemsTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "woodworking-sat08-strips/domain.pddl");
+    auto problem_files = std::vector<fs::path>();
+    for (size_t i = 1; i <= 8; ++i)
+    {
+        problem_files.push_back(fs::path(std::string(DATA_DIR) + "woodworking-sat08-strips/p0" + std::to_string(i) + ".pddl"));
+    }
+    auto domain_parser = DomainParser(domain_file);
+
+    const auto single_threaded = parse_problems(problem_files, domain_parser, 1);
+    const auto multi_threaded = parse_problems(problem_files, domain_parser, 4);
+    ASSERT_EQ(single_threaded.size(), problem_files.size());
+    ASSERT_EQ(multi_threaded.size(), problem_files.size());
+
+    for (size_t i = 0; i < problem_files.size(); ++i)
+    {
+        const auto problem_single = single_threaded[i].get_problem();
+        const auto problem_multi = multi_threaded[i].get_problem();
+        EXPECT_EQ(problem_single->get_domain(), domain_parser.get_domain());
+        EXPECT_EQ(problem_multi->get_domain(), domain_parser.get_domain());
+
+        // The indices do not depend on the number of threads.
+        const auto& atoms_single = problem_single->get_positive_initial_atoms().get_atoms();
+        const auto& atoms_multi = problem_multi->get_positive_initial_atoms().get_atoms();
+        ASSERT_EQ(atoms_single.size(), atoms_multi.size());
+        for (size_t j = 0; j < atoms_single.size(); ++j)
+        {
+            EXPECT_EQ(atoms_single[j]->get_index(), atoms_multi[j]->get_index());
+        }
+
+        // The result is the same as parsing the problems one after another.
+        auto problem_parser = ProblemParser(problem_files[i], domain_parser);
+        auto expected = std::stringstream();
+        expected << *problem_parser.get_problem();
+        auto actual = std::stringstream();
+        actual << *problem_multi;
+        EXPECT_EQ(actual.str(), expected.str());
+    }
+}
+
+TEST(LokiTests, ParserParseDomainConcurrentlyTest)
+{
+    for (const auto domain_name : { "gripper", "miconic", "schedule", "woodworking-sat08-strips" })
+    {
+        const auto domain_file = fs::path(std::string(DATA_DIR) + domain_name + "/domain.pddl");
+        const auto sequential = DomainParser(domain_file);
+        const auto two_threads = DomainParser(domain_file, { .num_threads = 2 });
+        const auto four_threads = DomainParser(domain_file, { .num_threads = 4 });
+
+        // The actions stay in the order of the file.
+        const auto& actions_sequential = sequential.get_domain()->get_actions();
+        const auto& actions_two_threads = two_threads.get_domain()->get_actions();
+        const auto& actions_four_threads = four_threads.get_domain()->get_actions();
+        ASSERT_EQ(actions_sequential.size(), actions_four_threads.size());
+        ASSERT_EQ(actions_two_threads.size(), actions_four_threads.size());
+        for (size_t i = 0; i < actions_sequential.size(); ++i)
+        {
+            EXPECT_EQ(actions_sequential[i]->get_name(), actions_four_threads[i]->get_name());
+            // The indices do not depend on the number of threads.
+            EXPECT_EQ(actions_sequential[i]->get_index(), actions_four_threads[i]->get_index());
+            EXPECT_EQ(actions_two_threads[i]->get_index(), actions_four_threads[i]->get_index());
+            ASSERT_EQ(actions_sequential[i]->get_parameters().size(), actions_four_threads[i]->get_parameters().size());
+            for (size_t j = 0; j < actions_sequential[i]->get_parameters().size(); ++j)
+            {
+                EXPECT_EQ(actions_sequential[i]->get_parameters()[j]->get_index(), actions_four_threads[i]->get_parameters()[j]->get_index());
+                EXPECT_EQ(actions_sequential[i]->get_parameters()[j]->get_variable()->get_index(),
+                          actions_four_threads[i]->get_parameters()[j]->get_variable()->get_index());
+            }
+            ASSERT_EQ(actions_sequential[i]->get_condition().has_value(), actions_four_threads[i]->get_condition().has_value());
+            if (actions_sequential[i]->get_condition().has_value())
+            {
+                EXPECT_EQ(visit([](const auto& arg) { return arg->get_index(); }, actions_sequential[i]->get_condition().value()),
+                          visit([](const auto& arg) { return arg->get_index(); }, actions_four_threads[i]->get_condition().value()));
+            }
+            // The positions are merged.
+            EXPECT_EQ(sequential.get_position_cache().get(actions_sequential[i]).size(), four_threads.get_position_cache().get(actions_four_threads[i]).size());
+        }
+        const auto& axioms_sequential = sequential.get_domain()->get_axioms();
+        const auto& axioms_four_threads = four_threads.get_domain()->get_axioms();
+        ASSERT_EQ(axioms_sequential.size(), axioms_four_threads.size());
+        for (size_t i = 0; i < axioms_sequential.size(); ++i)
+        {
+            EXPECT_EQ(axioms_sequential[i]->get_index(), axioms_four_threads[i]->get_index());
+            ASSERT_EQ(axioms_sequential[i]->get_parameters().size(), axioms_four_threads[i]->get_parameters().size());
+            for (size_t j = 0; j < axioms_sequential[i]->get_parameters().size(); ++j)
+            {
+                EXPECT_EQ(axioms_sequential[i]->get_parameters()[j]->get_index(), axioms_four_threads[i]->get_parameters()[j]->get_index());
+            }
+        }
+
+        auto expected = std::stringstream();
+        expected << *sequential.get_domain();
+        auto actual = std::stringstream();
+        actual << *four_threads.get_domain();
+        EXPECT_EQ(actual.str(), expected.str());
+    }
+}
+
+TEST(LokiTests, ParserParseInitialConcurrentlyTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "woodworking-sat08-strips/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "woodworking-sat08-strips/p30.pddl");
+    auto domain_parser = DomainParser(domain_file);
+    // The sequential parse finds the PDDL objects that the concurrent parse merged into the factories of the domain.
+    auto concurrent = ProblemParser(problem_file, domain_parser, { .num_threads = 4 });
+    auto sequential = ProblemParser(problem_file, domain_parser);
+
+    // The initial literals stay in the order of the file.
+    const auto& literals_sequential = sequential.get_problem()->get_initial_literals();
+    const auto& literals_concurrent = concurrent.get_problem()->get_initial_literals();
+    ASSERT_EQ(literals_sequential.size(), literals_concurrent.size());
+    for (size_t i = 0; i < literals_sequential.size(); ++i)
+    {
+        EXPECT_EQ(literals_sequential[i], literals_concurrent[i]);
+        EXPECT_EQ(sequential.get_position_cache().get(literals_sequential[i]).size(), concurrent.get_position_cache().get(literals_concurrent[i]).size());
+    }
+    EXPECT_EQ(sequential.get_problem()->get_numeric_fluents(), concurrent.get_problem()->get_numeric_fluents());
+}
+
+TEST(LokiTests, ParserAsyncParserTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "woodworking-sat08-strips/domain.pddl");
+    auto problem_files = std::vector<fs::path>();
+    for (size_t i = 1; i <= 8; ++i)
+    {
+        problem_files.push_back(fs::path(std::string(DATA_DIR) + "woodworking-sat08-strips/p0" + std::to_string(i) + ".pddl"));
+    }
+
+    auto async_parser = AsyncParser(domain_file, 2);
+    auto futures = std::vector<std::future<ProblemParser>>();
+    for (const auto& problem_file : problem_files)
+    {
+        futures.push_back(async_parser.parse_problem(problem_file));
+    }
+    // p11 declares objects without names.
+    auto failing = async_parser.parse_problem(fs::path(std::string(DATA_DIR) + "woodworking-sat08-strips/p11.pddl"));
+
+    const auto domain_parser = async_parser.get_domain().get();
+    auto expected_domain_parser = DomainParser(domain_file);
+    for (size_t i = 0; i < problem_files.size(); ++i)
+    {
+        const auto problem_parser = futures[i].get();
+        EXPECT_EQ(problem_parser.get_problem()->get_domain(), domain_parser->get_domain());
+
+        auto expected_problem_parser = ProblemParser(problem_files[i], expected_domain_parser);
+        auto expected = std::stringstream();
+        expected << *expected_problem_parser.get_problem();
+        auto actual = std::stringstream();
+        actual << *problem_parser.get_problem();
+        EXPECT_EQ(actual.str(), expected.str());
+    }
+    EXPECT_THROW(failing.get(), SyntaxParserError);
+}
+
+TEST(LokiTests, ParserFreezeTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/p-2-0.pddl");
+    auto domain_parser = DomainParser(domain_file);
+    domain_parser.freeze(true);
+
+    // Problems are parsed into factories of their own.
+    const auto problem_parsers = parse_problems({ problem_file }, domain_parser, 1);
+    EXPECT_EQ(problem_parsers.front().get_problem()->get_initial_literals().size(), 11);
+
+    // Problems that share the frozen factories of the domain are rejected.
+    EXPECT_THROW(ProblemParser(problem_file, domain_parser), FrozenError);
+}
+
+TEST(LokiTests, ParserValidatorTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "woodworking-sat08-strips/domain.pddl");
+    auto domain_parser = DomainParser(domain_file);
+    domain_parser.freeze();
+
+    auto validator = Validator();
+    for (size_t i = 1; i <= 8; ++i)
+    {
+        validator.validate_domain(domain_file);
+        EXPECT_NO_THROW(validator.validate_problem(fs::path(std::string(DATA_DIR) + "woodworking-sat08-strips/p0" + std::to_string(i) + ".pddl"), domain_parser));
+    }
+    // p11 declares objects without names.
+    EXPECT_THROW(validator.validate_problem(fs::path(std::string(DATA_DIR) + "woodworking-sat08-strips/p11.pddl"), domain_parser), SyntaxParserError);
+
+    // Semantic errors are thrown as by the parsers.
+    const auto gripper_domain_parser = DomainParser(fs::path(std::string(DATA_DIR) + "gripper/domain.pddl"));
+    const auto temporary_problem_file = TemporaryFile();
+    const auto& problem_file = temporary_problem_file.get_path();
+    {
+        auto out = std::ofstream(problem_file);
+        out << "(define (problem p) (:domain gripper-strips) (:objects ball1) (:init (ball ball1) (ball ball2)) (:goal (at ball1 rooma)))";
+    }
+    EXPECT_THROW(validator.validate_problem(problem_file, gripper_domain_parser), UndefinedObjectError);
+    EXPECT_THROW(parse_problem(problem_file, gripper_domain_parser), UndefinedObjectError);
+
+    // The problems are valid for the gripper domain.
+    EXPECT_NO_THROW(validator.validate_problem(fs::path(std::string(DATA_DIR) + "gripper/p-2-0.pddl"), gripper_domain_parser));
+}
+
+TEST(LokiTests, ParserValidatorDiagnosticsTest)
+{
+    const auto gripper_domain_parser = DomainParser(fs::path(std::string(DATA_DIR) + "gripper/domain.pddl"));
+    auto validator = Validator();
+
+    // All errors are reported in one pass.
+    const auto temporary_problem_file = TemporaryFile();
+    const auto& problem_file = temporary_problem_file.get_path();
+    {
+        auto out = std::ofstream(problem_file);
+        out << "(define (problem p) (:domain gripper-strips)\n"
+               "(:objects ball1 ball2 ball1)\n"
+               "(:init (ball ball1) (ball ball3)\n"
+               "  (bal ball1) (at-robby rooma))\n"
+               "(:goal (and (at ball1 rooma) (carry ball1))))\n";
+    }
+    auto diagnostics = DiagnosticSink();
+    validator.diagnose_problem(problem_file, gripper_domain_parser, diagnostics);
+    ASSERT_EQ(diagnostics.get_num_errors(), 4);
+    EXPECT_FALSE(diagnostics.is_truncated());
+    const auto& problem_diagnostics = diagnostics.get_diagnostics();
+    EXPECT_EQ(problem_diagnostics[0].line, 2);
+    EXPECT_EQ(problem_diagnostics[0].column, 23);
+    EXPECT_EQ(problem_diagnostics[1].line, 3);
+    EXPECT_EQ(problem_diagnostics[2].line, 4);
+    EXPECT_EQ(problem_diagnostics[3].line, 5);
+    // The first diagnostic is the error that is thrown without a sink.
+    EXPECT_THROW(validator.validate_problem(problem_file, gripper_domain_parser), MultiDefinitionObjectError);
+
+    // Concurrent parsing records the same diagnostics in the same order.
+    auto concurrent_validator = Validator({ .num_threads = 4 }, { .num_threads = 4 });
+    const auto expect_same_diagnostics = [](const DiagnosticSink& lhs, const DiagnosticSink& rhs)
+    {
+        ASSERT_EQ(lhs.get_diagnostics().size(), rhs.get_diagnostics().size());
+        EXPECT_EQ(lhs.is_truncated(), rhs.is_truncated());
+        for (size_t i = 0; i < lhs.get_diagnostics().size(); ++i)
+        {
+            EXPECT_EQ(lhs.get_diagnostics()[i].severity, rhs.get_diagnostics()[i].severity);
+            EXPECT_EQ(lhs.get_diagnostics()[i].line, rhs.get_diagnostics()[i].line);
+            EXPECT_EQ(lhs.get_diagnostics()[i].column, rhs.get_diagnostics()[i].column);
+            EXPECT_EQ(lhs.get_diagnostics()[i].message, rhs.get_diagnostics()[i].message);
+        }
+    };
+    auto concurrent_diagnostics = DiagnosticSink();
+    concurrent_validator.diagnose_problem(problem_file, gripper_domain_parser, concurrent_diagnostics);
+    expect_same_diagnostics(diagnostics, concurrent_diagnostics);
+
+    // The number of diagnostics is bounded.
+    auto bounded_diagnostics = DiagnosticSink(2);
+    validator.diagnose_problem(problem_file, gripper_domain_parser, bounded_diagnostics);
+    EXPECT_EQ(bounded_diagnostics.get_diagnostics().size(), 2);
+    EXPECT_TRUE(bounded_diagnostics.is_truncated());
+    auto concurrent_bounded_diagnostics = DiagnosticSink(2);
+    concurrent_validator.diagnose_problem(problem_file, gripper_domain_parser, concurrent_bounded_diagnostics);
+    expect_same_diagnostics(bounded_diagnostics, concurrent_bounded_diagnostics);
+
+    // Warnings are reported alongside errors and only the offending literal or structure is skipped.
+    const auto temporary_domain_file = TemporaryFile();
+    const auto& domain_file = temporary_domain_file.get_path();
+    {
+        auto out = std::ofstream(domain_file);
+        out << "(define (domain d) (:requirements :strips)\n"
+               "(:predicates (p ?x) (p ?y))\n"
+               "(:action a :parameters (?x ?y) :precondition (and (p ?x) (q ?x)) :effect (p ?x))\n"
+               "(:action b :parameters (?x) :precondition (r ?x) :effect (p ?x)))\n";
+    }
+    diagnostics.clear();
+    validator.diagnose_domain(domain_file, diagnostics);
+    EXPECT_EQ(diagnostics.get_num_errors(), 3);
+    EXPECT_EQ(diagnostics.get_num_warnings(), 1);
+    concurrent_diagnostics.clear();
+    concurrent_validator.diagnose_domain(domain_file, concurrent_diagnostics);
+    expect_same_diagnostics(diagnostics, concurrent_diagnostics);
+
+    // Syntax errors stop the validation.
+    diagnostics.clear();
+    validator.diagnose_problem(fs::path(std::string(DATA_DIR) + "gripper/domain.pddl"), gripper_domain_parser, diagnostics);
+    EXPECT_EQ(diagnostics.get_num_errors(), 1);
+
+    // Valid files have no diagnostics.
+    diagnostics.clear();
+    validator.diagnose_problem(fs::path(std::string(DATA_DIR) + "gripper/p-2-0.pddl"), gripper_domain_parser, diagnostics);
+    EXPECT_TRUE(diagnostics.get_diagnostics().empty());
+}
+
+TEST(LokiTests, ParserTypeOrderTest)
+{
+    const auto temporary_domain_file = TemporaryFile();
+    const auto& domain_file = temporary_domain_file.get_path();
+    {
+        auto out = std::ofstream(domain_file);
+        out << "(define (domain d) (:requirements :typing)\n"
+               "(:types z y - x x w v u t - object))\n";
+    }
+    // Independent types keep the order of their first occurrence, and base types precede the types derived from them.
+    const auto domain_parser = DomainParser(domain_file);
+    auto type_names = std::vector<std::string> {};
+    for (const auto& type : domain_parser.get_domain()->get_types())
+    {
+        type_names.emplace_back(type->get_name());
+    }
+    EXPECT_EQ(type_names, (std::vector<std::string> { "object", "x", "w", "v", "u", "t", "z", "y" }));
+}
+
+TEST(LokiTests, ParserCyclicTypeHierarchyTest)
+{
+    const auto temporary_domain_file = TemporaryFile();
+    const auto& domain_file = temporary_domain_file.get_path();
+    {
+        auto out = std::ofstream(domain_file);
+        out << "(define (domain d) (:requirements :typing)\n"
+               "(:types a - object b - a c - b d - c a - d e - b)\n"
+               "(:predicates (p ?x - e)))\n";
+    }
+    try
+    {
+        const auto domain_parser = DomainParser(domain_file);
+        FAIL() << "Expected a CyclicTypeHierarchyError.";
+    }
+    catch (const CyclicTypeHierarchyError& error)
+    {
+        const auto message = std::string(error.what());
+        EXPECT_NE(message.find("\"a\""), std::string::npos);
+        EXPECT_NE(message.find("\"b\""), std::string::npos);
+        EXPECT_NE(message.find("\"c\""), std::string::npos);
+        EXPECT_NE(message.find("\"d\""), std::string::npos);
+        EXPECT_EQ(message.find("\"e\""), std::string::npos);
+    }
+
+    // With a diagnostic sink, the cycle is reported and broken such that parsing continues.
+    auto diagnostics = DiagnosticSink();
+    Validator().diagnose_domain(domain_file, diagnostics);
+    EXPECT_EQ(diagnostics.get_num_errors(), 1);
+}
+
+TEST(LokiTests, ParserDeepNestingTest)
+{
+    // Deeply nested goal descriptors and effects must not overflow the native stack.
+    const size_t depth = 20000;
+    const auto temporary_domain_file = TemporaryFile();
+    const auto& domain_file = temporary_domain_file.get_path();
+    {
+        auto out = std::ofstream(domain_file);
+        out << "(define (domain d) (:requirements :adl)\n"
+               "(:predicates (p ?x) (q ?x))\n"
+               "(:action a :parameters (?x)\n"
+               ":precondition ";
+        for (size_t i = 0; i < depth; ++i)
+        {
+            out << "(and (not (forall (?y" << i << ") ";
+        }
+        out << "(p ?x)";
+        for (size_t i = 0; i < depth; ++i)
+        {
+            out << ")))";
+        }
+        out << "\n:effect ";
+        for (size_t i = 0; i < depth; ++i)
+        {
+            out << "(and (when (p ?x) ";
+        }
+        out << "(q ?x)";
+        for (size_t i = 0; i < depth; ++i)
+        {
+            out << "))";
+        }
+        out << "))\n";
+    }
+
+    const auto domain_parser = DomainParser(domain_file);
+    const auto& action = domain_parser.get_domain()->get_actions().at(0);
+
+    size_t condition_depth = 0;
+    auto condition = action->get_condition().value();
+    while (holds_alternative<ConditionAnd>(condition))
+    {
+        const auto condition_not = get<ConditionNot>(get<ConditionAnd>(condition)->get_conditions().at(0));
+        condition = get<ConditionForall>(condition_not->get_condition())->get_condition();
+        ++condition_depth;
+    }
+    EXPECT_EQ(condition_depth, depth);
+    EXPECT_TRUE(holds_alternative<ConditionLiteral>(condition));
+
+    size_t effect_depth = 0;
+    auto effect = action->get_effect().value();
+    while (holds_alternative<EffectAnd>(effect))
+    {
+        effect = get<EffectConditionalWhen>(get<EffectAnd>(effect)->get_effects().at(0))->get_effect();
+        ++effect_depth;
+    }
+    EXPECT_EQ(effect_depth, depth);
+    EXPECT_TRUE(holds_alternative<EffectLiteral>(effect));
+}
+
+TEST(LokiTests, ParserReparseTest)
+{
+    auto domain_parser = DomainParser(fs::path(std::string(DATA_DIR) + "gripper/domain.pddl"));
+    const auto domain = domain_parser.get_domain();
+    const auto move = domain->get_actions().at(0);
+    const auto pick = domain->get_actions().at(1);
+    const auto drop = domain->get_actions().at(2);
+    const auto get_text = [&domain_parser](const auto& element)
+    {
+        const auto positions = domain_parser.get_position_cache().get(element);
+        EXPECT_FALSE(positions.empty());
+        const auto range = domain_parser.get_position_cache().get_error_handler().position_of(positions.back());
+        return std::string(range.begin(), range.end());
+    };
+
+    // Remove a precondition of the action move, which re-parses only the action move.
+    const auto removed_text = std::string(" (at-robby ?from)");
+    const auto position = domain_parser.get_source().find(removed_text, domain_parser.get_source().find("(:action move"));
+    domain_parser.reparse(position, position + removed_text.size(), "");
+    const auto edited_domain = domain_parser.get_domain();
+    EXPECT_NE(edited_domain, domain);
+    EXPECT_EQ(edited_domain->get_actions().size(), 3);
+    const auto edited_move = edited_domain->get_actions().at(0);
+    EXPECT_NE(edited_move, move);
+    EXPECT_EQ(get<ConditionAnd>(edited_move->get_condition().value())->get_conditions().size(), 2);
+    EXPECT_EQ(edited_domain->get_actions().at(1), pick);
+    EXPECT_EQ(edited_domain->get_actions().at(2), drop);
+    // The positions refer to the edited source.
+    EXPECT_EQ(get_text(edited_move).rfind("(:action move", 0), 0);
+    EXPECT_EQ(get_text(edited_move).find("(at-robby ?from))\n"), std::string::npos);
+    EXPECT_EQ(get_text(drop).rfind("(:action drop", 0), 0);
+    EXPECT_EQ(get_text(edited_domain).rfind("(define (domain gripper-strips)", 0), 0);
+
+    // Reverting the edit reuses the previous action and domain, also if the text differs before normalization.
+    domain_parser.reparse(position, position, " (AT-ROBBY ?from)");
+    EXPECT_EQ(domain_parser.get_domain(), domain);
+    EXPECT_EQ(get_text(move).rfind("(:action move", 0), 0);
+
+    // An edit of a section re-parses the whole source.
+    const auto predicates_end = domain_parser.get_source().find("(carry ?o ?g)") + std::string("(carry ?o ?g)").size();
+    domain_parser.reparse(predicates_end, predicates_end, " (unused ?x)");
+    EXPECT_EQ(domain_parser.get_domain()->get_predicates().size(), 8);
+    EXPECT_EQ(domain_parser.get_domain()->get_actions().at(1), pick);
+
+    // An edit that does not parse throws and leaves the parser unchanged.
+    const auto source = domain_parser.get_source();
+    const auto current_domain = domain_parser.get_domain();
+    const auto drop_position = source.find("(:action drop");
+    EXPECT_THROW(domain_parser.reparse(drop_position, drop_position, "(:action"), SyntaxParserError);
+    EXPECT_THROW(domain_parser.reparse(drop_position + 1, drop_position + 1, "(unknown ?x) "), SyntaxParserError);
+    const auto precondition_position = source.find("(ball ?obj)", drop_position);
+    EXPECT_THROW(domain_parser.reparse(precondition_position, precondition_position, "(unknown ?obj) "), UndefinedPredicateError);
+    EXPECT_EQ(domain_parser.get_source(), source);
+    EXPECT_EQ(domain_parser.get_domain(), current_domain);
+    EXPECT_EQ(get_text(drop).rfind("(:action drop", 0), 0);
+}
+
+TEST(LokiTests, ParserLazyTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto eager_domain_parser = DomainParser(domain_file);
+    auto lazy_domain_parser = DomainParser(domain_file, { .lazy = true });
+    const auto eager_domain = eager_domain_parser.get_domain();
+    const auto lazy_domain = lazy_domain_parser.get_domain();
+
+    // The signature is parsed eagerly.
+    ASSERT_EQ(lazy_domain->get_actions().size(), eager_domain->get_actions().size());
+    EXPECT_EQ(lazy_domain->get_predicates().size(), eager_domain->get_predicates().size());
+    for (size_t i = 0; i < lazy_domain->get_actions().size(); ++i)
+    {
+        const auto lazy_action = lazy_domain->get_actions()[i];
+        const auto eager_action = eager_domain->get_actions()[i];
+        EXPECT_TRUE(lazy_action->is_lazy());
+        EXPECT_FALSE(eager_action->is_lazy());
+        EXPECT_EQ(lazy_action->get_name(), eager_action->get_name());
+        EXPECT_EQ(lazy_action->get_parameters().size(), eager_action->get_parameters().size());
+    }
+
+    // The bodies are parsed on first access and equal those of the eager domain.
+    const auto pick = lazy_domain->get_actions().at(1);
+    EXPECT_EQ(get<ConditionAnd>(pick->get_condition().value())->get_conditions().size(), 6);
+    EXPECT_FALSE(lazy_domain_parser.get_position_cache().get(pick->get_condition().value()).empty());
+    lazy_domain_parser.materialize();
+    auto eager_out = std::stringstream();
+    auto lazy_out = std::stringstream();
+    eager_out << *eager_domain;
+    lazy_out << *lazy_domain;
+    EXPECT_EQ(lazy_out.str(), eager_out.str());
+    EXPECT_EQ(lazy_domain_parser.get_domain(), lazy_domain);
+
+    // Problems are parsed against the materialized domain.
+    const auto problem_parser = parse_problem(fs::path(std::string(DATA_DIR) + "gripper/p-2-0.pddl"), lazy_domain_parser);
+    EXPECT_EQ(problem_parser.get_problem()->get_objects().size(), 4);
+    auto async_parser = AsyncParser(domain_file, 1, { .lazy = true });
+    EXPECT_EQ(async_parser.parse_problem(fs::path(std::string(DATA_DIR) + "gripper/p-2-0.pddl")).get().get_problem()->get_objects().size(), 4);
+    EXPECT_TRUE(async_parser.get_domain().get()->get_domain()->get_actions().front()->is_lazy());
+
+    // Semantic errors in a body are thrown on access, and again on the next access.
+    const auto temporary_error_domain_file = TemporaryFile();
+    const auto& error_domain_file = temporary_error_domain_file.get_path();
+    {
+        auto out = std::ofstream(error_domain_file);
+        out << "(define (domain d) (:requirements :strips)\n"
+               "(:predicates (p ?x))\n"
+               "(:action a :parameters (?x) :precondition (p ?x) :effect (not (p ?x)))\n"
+               "(:action b :parameters (?x) :precondition (q ?x) :effect (p ?x)))\n";
+    }
+    EXPECT_THROW(DomainParser(error_domain_file, DomainParserOptions()), UndefinedPredicateError);
+    const auto error_domain_parser = DomainParser(error_domain_file, { .lazy = true });
+    const auto& actions = error_domain_parser.get_domain()->get_actions();
+    EXPECT_TRUE(actions.at(0)->get_effect().has_value());
+    EXPECT_THROW(actions.at(1)->get_condition(), UndefinedPredicateError);
+    EXPECT_THROW(actions.at(1)->get_effect(), UndefinedPredicateError);
 }
 
 }
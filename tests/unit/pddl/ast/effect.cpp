@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "../../../../src/ast/parser.hpp"
+
+#include <gtest/gtest.h>
+#include <loki/details/ast/ast.hpp>
+#include <loki/details/ast/parser_wrapper.hpp>
+#include <loki/details/ast/printer.hpp>
+
+namespace loki::domain::tests
+{
+
+TEST(LokiTests, PddlAstEffectTest)
+{
+    ast::Effect ast;
+
+    EXPECT_NO_THROW(parse_ast("(predicate1 ?var1)", effect(), ast));
+    EXPECT_EQ(ast.get().which(), 0);
+    EXPECT_NO_THROW(parse_ast("(increase (function1 ?var1) 1)", effect(), ast));
+    EXPECT_EQ(ast.get().which(), 0);
+    EXPECT_NO_THROW(parse_ast("(forall (?var1) (predicate1 ?var1))", effect(), ast));
+    EXPECT_EQ(ast.get().which(), 1);
+    EXPECT_NO_THROW(parse_ast("(when (predicate1 ?var1) (not (predicate2 ?var1)))", effect(), ast));
+    EXPECT_EQ(ast.get().which(), 1);
+    EXPECT_NO_THROW(parse_ast("(and (predicate1 ?var1) (when (predicate1 ?var1) (predicate2 ?var1)))", effect(), ast));
+    EXPECT_EQ(ast.get().which(), 2);
+
+    // Predicate names that start with a keyword are literals.
+    EXPECT_NO_THROW(parse_ast("(when-predicate ?var1)", effect(), ast));
+    EXPECT_EQ(ast.get().which(), 0);
+
+    EXPECT_ANY_THROW(parse_ast("(when (predicate1 ?var1))", effect(), ast));
+}
+
+TEST(LokiTests, PddlAstEffectDeepCopyTest)
+{
+    // Copying deeply nested effects must not overflow the native stack.
+    const size_t depth = 20000;
+    auto text = std::string();
+    for (size_t i = 0; i < depth; ++i)
+    {
+        text += "(and (predicate1 ?var1) (when (predicate1 ?var1) ";
+    }
+    text += "(predicate2 ?var1)";
+    for (size_t i = 0; i < depth; ++i)
+    {
+        text += "))";
+    }
+    ast::Effect ast;
+    ASSERT_NO_THROW(parse_ast(text, effect(), ast));
+
+    const auto copy = ast;
+    size_t copy_depth = 0;
+    const auto* node = &copy;
+    while (node->get().which() == 2)
+    {
+        const auto& effects = boost::get<std::vector<ast::Effect>>(node->get());
+        ASSERT_EQ(effects.size(), 2);
+        EXPECT_EQ(effects.at(0).get().which(), 0);
+        const auto& effect_conditional = boost::get<x3::forward_ast<ast::EffectConditional>>(effects.at(1).get()).get();
+        node = &boost::get<ast::EffectConditionalWhen>(effect_conditional.get()).effect;
+        ++copy_depth;
+    }
+    EXPECT_EQ(copy_depth, depth);
+    EXPECT_EQ(node->get().which(), 0);
+}
+
+TEST(LokiTests, PddlAstEffectRootTest)
+{
+    ast::EffectRoot ast;
+
+    EXPECT_NO_THROW(parse_ast("(predicate1 ?var1)", effect_root(), ast));
+    EXPECT_EQ(ast.get().which(), 0);
+    EXPECT_NO_THROW(parse_ast("(when (predicate1 ?var1) (predicate2 ?var1))", effect_root(), ast));
+    EXPECT_EQ(ast.get().which(), 1);
+    EXPECT_NO_THROW(parse_ast("(and (predicate1 ?var1) (increase (total-cost) 1))", effect_root(), ast));
+    EXPECT_EQ(ast.get().which(), 3);
+}
+
+}
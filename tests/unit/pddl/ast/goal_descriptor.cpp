@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "../../../../src/ast/parser.hpp"
+
+#include <gtest/gtest.h>
+#include <loki/details/ast/ast.hpp>
+#include <loki/details/ast/parser_wrapper.hpp>
+#include <loki/details/ast/printer.hpp>
+
+namespace loki::domain::tests
+{
+
+TEST(LokiTests, PddlAstGoalDescriptorTest)
+{
+    ast::GoalDescriptor ast;
+
+    EXPECT_NO_THROW(parse_ast("(predicate1 ?var1)", goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 0);
+    EXPECT_NO_THROW(parse_ast("(and (predicate1 ?var1) (predicate2 ?var2))", goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 2);
+    EXPECT_NO_THROW(parse_ast("( and (predicate1 ?var1))", goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 2);
+    EXPECT_NO_THROW(parse_ast("(or (predicate1 ?var1) (predicate2 ?var2))", goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 3);
+    EXPECT_NO_THROW(parse_ast("(not (predicate1 ?var1))", goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 4);
+    EXPECT_NO_THROW(parse_ast("(imply (predicate1 ?var1) (predicate2 ?var1))", goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 5);
+    EXPECT_NO_THROW(parse_ast("(exists (?var1) (predicate1 ?var1))", goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 6);
+    EXPECT_NO_THROW(parse_ast("(forall (?var1) (predicate1 ?var1))", goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 7);
+    EXPECT_NO_THROW(parse_ast("(< (function1) 1)", goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 8);
+    EXPECT_NO_THROW(parse_ast("(= ?var1 ?var2)", goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 0);
+
+    // Predicate names that start with a keyword are atoms.
+    EXPECT_NO_THROW(parse_ast("(and-predicate ?var1)", goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 0);
+    EXPECT_NO_THROW(parse_ast("(forall_predicate ?var1)", goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 0);
+
+    EXPECT_ANY_THROW(parse_ast("(and (predicate1 ?var1)", goal_descriptor(), ast));
+    EXPECT_ANY_THROW(parse_ast("(forall ?var1 (predicate1 ?var1))", goal_descriptor(), ast));
+}
+
+TEST(LokiTests, PddlAstGoalDescriptorDeepCopyTest)
+{
+    // Copying deeply nested goal descriptors must not overflow the native stack.
+    const size_t depth = 20000;
+    auto text = std::string();
+    for (size_t i = 0; i < depth; ++i)
+    {
+        text += "(and (not (forall (?var1) ";
+    }
+    text += "(predicate1 ?var1)";
+    for (size_t i = 0; i < depth; ++i)
+    {
+        text += ")))";
+    }
+    ast::GoalDescriptor ast;
+    ASSERT_NO_THROW(parse_ast(text, goal_descriptor(), ast));
+
+    const auto copy = ast;
+    auto copy_assigned = ast::GoalDescriptor();
+    copy_assigned = copy;
+    for (const auto* node : std::vector<const ast::GoalDescriptor*> { &copy, &copy_assigned })
+    {
+        size_t copy_depth = 0;
+        const auto* original = &ast;
+        while (node->get().which() == 2)
+        {
+            const auto& node_and = boost::get<x3::forward_ast<ast::GoalDescriptorAnd>>(node->get()).get();
+            const auto& original_and = boost::get<x3::forward_ast<ast::GoalDescriptorAnd>>(original->get()).get();
+            // The copy shares no nodes with the original.
+            EXPECT_NE(&node_and, &original_and);
+            EXPECT_EQ(node_and.id_first, original_and.id_first);
+            const auto& node_not = boost::get<x3::forward_ast<ast::GoalDescriptorNot>>(node_and.goal_descriptors.at(0).get()).get();
+            const auto& original_not = boost::get<x3::forward_ast<ast::GoalDescriptorNot>>(original_and.goal_descriptors.at(0).get()).get();
+            node = &boost::get<x3::forward_ast<ast::GoalDescriptorForall>>(node_not.goal_descriptor.get()).get().goal_descriptor;
+            original = &boost::get<x3::forward_ast<ast::GoalDescriptorForall>>(original_not.goal_descriptor.get()).get().goal_descriptor;
+            ++copy_depth;
+        }
+        EXPECT_EQ(copy_depth, depth);
+        EXPECT_EQ(node->get().which(), 0);
+    }
+}
+
+TEST(LokiTests, PddlAstPreconditionGoalDescriptorTest)
+{
+    ast::PreconditionGoalDescriptor ast;
+
+    EXPECT_NO_THROW(parse_ast("(predicate1 ?var1)", precondition_goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 0);
+    EXPECT_NO_THROW(parse_ast("(and (predicate1 ?var1) (not (predicate2 ?var2)))", precondition_goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 1);
+    EXPECT_NO_THROW(parse_ast("(preference pref1 (predicate1 ?var1))", precondition_goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 2);
+    EXPECT_NO_THROW(parse_ast("(forall (?var1) (predicate1 ?var1))", precondition_goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 3);
+    EXPECT_NO_THROW(parse_ast("(or (predicate1 ?var1) (predicate2 ?var2))", precondition_goal_descriptor(), ast));
+    EXPECT_EQ(ast.get().which(), 0);
+}
+
+}
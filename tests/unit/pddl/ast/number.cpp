@@ -15,12 +15,14 @@
  * along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include "../../../src/ast/parser.hpp"
+#include "../../../../src/ast/parser.hpp"
 
 #include <gtest/gtest.h>
 #include <loki/details/ast/ast.hpp>
 #include <loki/details/ast/parser_wrapper.hpp>
 #include <loki/details/ast/printer.hpp>
+#include <limits>
+#include <string>
 
 namespace loki::domain::tests
 {
@@ -43,4 +45,57 @@ TEST(LokiTests, PddlAstNumberTest)
     EXPECT_ANY_THROW(parse_ast("(5)", number(), ast));
 }
 
+TEST(LokiTests, PddlAstNumberValueTest)
+{
+    ast::Number ast;
+
+    // Integers
+    EXPECT_NO_THROW(parse_ast("0", number(), ast));
+    EXPECT_EQ(ast.value, 0.);
+    EXPECT_NO_THROW(parse_ast("-42", number(), ast));
+    EXPECT_EQ(ast.value, -42.);
+    EXPECT_NO_THROW(parse_ast("+42", number(), ast));
+    EXPECT_EQ(ast.value, 42.);
+    EXPECT_NO_THROW(parse_ast("999999999999999", number(), ast));
+    EXPECT_EQ(ast.value, 999999999999999.);
+    EXPECT_NO_THROW(parse_ast("12345678901234567890", number(), ast));
+    EXPECT_EQ(ast.value, 12345678901234567890.);
+
+    // Fractions and exponents are rounded correctly.
+    EXPECT_NO_THROW(parse_ast("0.1", number(), ast));
+    EXPECT_EQ(ast.value, 0.1);
+    EXPECT_NO_THROW(parse_ast("0.30000000000000004", number(), ast));
+    EXPECT_EQ(ast.value, 0.30000000000000004);
+    EXPECT_NO_THROW(parse_ast("2.2250738585072014e-308", number(), ast));
+    EXPECT_EQ(ast.value, 2.2250738585072014e-308);
+    EXPECT_NO_THROW(parse_ast("-2.5E3", number(), ast));
+    EXPECT_EQ(ast.value, -2500.);
+    EXPECT_NO_THROW(parse_ast(".5", number(), ast));
+    EXPECT_EQ(ast.value, 0.5);
+    EXPECT_NO_THROW(parse_ast("5.", number(), ast));
+    EXPECT_EQ(ast.value, 5.);
+    // An exponent without digits is not part of the number.
+    EXPECT_NO_THROW(parse_ast("7e", number(), ast));
+    EXPECT_EQ(ast.value, 7.);
+
+    // Numbers out of the range of double saturate as with x3::double_.
+    EXPECT_NO_THROW(parse_ast("1e400", number(), ast));
+    EXPECT_EQ(ast.value, std::numeric_limits<double>::infinity());
+    EXPECT_NO_THROW(parse_ast("-1e400", number(), ast));
+    EXPECT_EQ(ast.value, -std::numeric_limits<double>::infinity());
+    EXPECT_NO_THROW(parse_ast("1e-400", number(), ast));
+    EXPECT_EQ(ast.value, 0.);
+    EXPECT_NO_THROW(parse_ast("0.0001e-330", number(), ast));
+    EXPECT_EQ(ast.value, 0.);
+    EXPECT_NO_THROW(parse_ast("1000e306", number(), ast));
+    EXPECT_EQ(ast.value, std::numeric_limits<double>::infinity());
+    EXPECT_NO_THROW(parse_ast("1" + std::string(400, '0'), number(), ast));
+    EXPECT_EQ(ast.value, std::numeric_limits<double>::infinity());
+    EXPECT_NO_THROW(parse_ast("1e99999999999999999999", number(), ast));
+    EXPECT_EQ(ast.value, std::numeric_limits<double>::infinity());
+
+    EXPECT_ANY_THROW(parse_ast("-", number(), ast));
+    EXPECT_ANY_THROW(parse_ast("+-1", number(), ast));
+}
+
 }
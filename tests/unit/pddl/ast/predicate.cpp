@@ -15,7 +15,7 @@
  * along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include "../../../src/ast/parser.hpp"
+#include "../../../../src/ast/parser.hpp"
 
 #include <gtest/gtest.h>
 #include <loki/details/ast/ast.hpp>
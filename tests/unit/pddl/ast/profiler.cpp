@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <loki/details/ast/profiler.hpp>
+#include <loki/details/parser.hpp>
+#include <sstream>
+
+namespace loki::domain::tests
+{
+
+TEST(LokiTests, PddlAstProfilerTest)
+{
+    reset_parser_profiles();
+    const auto domain_parser = DomainParser(fs::path(std::string(DATA_DIR) + "gripper/domain.pddl"));
+    const auto profiles = get_parser_profiles();
+
+    if (!is_parser_profiling_enabled())
+    {
+        EXPECT_TRUE(profiles.empty());
+        return;
+    }
+
+    ASSERT_FALSE(profiles.empty());
+    for (size_t i = 0; i < profiles.size(); ++i)
+    {
+        const auto& profile = profiles[i];
+        EXPECT_GT(profile.num_invocations, 0);
+        EXPECT_EQ(profile.num_invocations, profile.num_successes + profile.num_backtracks + profile.num_exceptions);
+        EXPECT_LE(profile.self_time, profile.total_time);
+        if (i > 0)
+        {
+            EXPECT_GE(profiles[i - 1].self_time, profile.self_time);
+        }
+    }
+    const auto domain_profile = std::find_if(profiles.begin(), profiles.end(), [](const auto& profile) { return profile.name == "domain"; });
+    ASSERT_NE(domain_profile, profiles.end());
+    EXPECT_EQ(domain_profile->num_invocations, 1);
+    EXPECT_EQ(domain_profile->num_successes, 1);
+    // The connectives of nested formulas are parsed without invoking their rules but are still counted.
+    const auto and_profile =
+        std::find_if(profiles.begin(), profiles.end(), [](const auto& profile) { return profile.name == "precondition_goal_descriptor_and"; });
+    ASSERT_NE(and_profile, profiles.end());
+    EXPECT_EQ(and_profile->num_invocations, 3);
+    EXPECT_EQ(and_profile->num_successes, 3);
+
+    auto out = std::stringstream();
+    print_parser_profiles(out, profiles);
+    EXPECT_NE(out.str().find("domain"), std::string::npos);
+
+    reset_parser_profiles();
+    EXPECT_TRUE(get_parser_profiles().empty());
+}
+
+}
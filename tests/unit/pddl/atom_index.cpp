@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <loki/details/parser.hpp>
+#include <loki/details/pddl/atom.hpp>
+#include <loki/details/pddl/atom_index.hpp>
+#include <loki/details/pddl/literal.hpp>
+#include <loki/details/pddl/predicate.hpp>
+#include <loki/details/pddl/problem.hpp>
+
+namespace loki::domain::tests
+{
+
+TEST(LokiTests, PddlAtomIndexTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/p-2-0.pddl");
+    auto domain_parser = DomainParser(domain_file);
+    auto problem_parser = ProblemParser(problem_file, domain_parser);
+    const auto problem = problem_parser.get_problem();
+
+    EXPECT_EQ(problem->get_positive_initial_literals().size(), 11);
+    EXPECT_EQ(problem->get_negative_initial_literals().size(), 0);
+
+    const auto& positive_atoms = problem->get_positive_initial_atoms();
+    EXPECT_EQ(positive_atoms.size(), 11);
+    for (const auto& literal : problem->get_initial_literals())
+    {
+        EXPECT_TRUE(positive_atoms.contains(literal->get_atom()));
+        EXPECT_FALSE(problem->get_negative_initial_atoms().contains(literal->get_atom()));
+    }
+
+    size_t num_atoms = 0;
+    for (const auto& predicate : problem->get_domain()->get_predicates())
+    {
+        for (const auto& atom : positive_atoms.get_atoms(predicate))
+        {
+            EXPECT_EQ(atom->get_predicate(), predicate);
+            ++num_atoms;
+        }
+        if (predicate->get_name() == "ball")
+        {
+            EXPECT_EQ(positive_atoms.get_atoms(predicate).size(), 2);
+        }
+        else if (predicate->get_name() == "at")
+        {
+            EXPECT_EQ(positive_atoms.get_atoms(predicate).size(), 2);
+        }
+        else if (predicate->get_name() == "carry")
+        {
+            EXPECT_EQ(positive_atoms.get_atoms(predicate).size(), 0);
+        }
+    }
+    EXPECT_EQ(num_atoms, 11);
+}
+
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <loki/details/exceptions.hpp>
+#include <loki/details/pddl/factories.hpp>
+#include <thread>
+
+namespace loki::domain::tests
+{
+
+TEST(LokiTests, FactoriesFreezeTest)
+{
+    const size_t num_objects = 50;
+
+    auto factories = PDDLFactories();
+    const auto type = factories.get_or_create_type("object", TypeList {});
+    const auto parameters = ParameterList { factories.get_or_create_parameter(factories.get_or_create_variable("?x"), TypeList { type }),
+                                            factories.get_or_create_parameter(factories.get_or_create_variable("?y"), TypeList { type }) };
+    const auto predicate = factories.get_or_create_predicate("edge", parameters);
+    auto terms = TermList();
+    for (size_t i = 0; i < num_objects; ++i)
+    {
+        terms.push_back(factories.get_or_create_term_object(factories.get_or_create_object(std::string("o").append(std::to_string(i)), TypeList { type })));
+    }
+    auto atoms = AtomList();
+    for (size_t i = 0; i < num_objects; ++i)
+    {
+        for (size_t j = 0; j < num_objects; ++j)
+        {
+            atoms.push_back(factories.get_or_create_atom(predicate, TermList { terms[i], terms[j] }));
+        }
+    }
+
+    const auto& frozen = factories.freeze(true);
+    EXPECT_TRUE(frozen.is_frozen());
+    EXPECT_EQ(frozen.get_factory<AtomFactory>().size(), atoms.size());
+
+    // Existing PDDL objects are found, new PDDL objects are rejected.
+    EXPECT_EQ(factories.get_or_create_atom(predicate, TermList { terms[1], terms[2] }), atoms[num_objects + 2]);
+    EXPECT_EQ(factories.get_or_create_object("o3", TypeList { type }), std::get<TermObjectImpl>(*terms[3]).get_object());
+    EXPECT_THROW(factories.get_or_create_object("unknown", TypeList { type }), FrozenError);
+    EXPECT_THROW(factories.get_or_create_atom(predicate, TermList { terms[0] }), FrozenError);
+    EXPECT_EQ(frozen.get_factory<ObjectFactory>().size(), num_objects);
+
+    // Stress concurrent reads of the frozen factories, also through child factories that create new PDDL objects.
+    const size_t num_threads = 16;
+    auto num_errors = std::atomic<size_t>(0);
+    auto threads = std::vector<std::thread>();
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back(
+            [&, t]
+            {
+                auto child_factories = PDDLFactories(&frozen);
+                for (size_t round = 0; round < 20; ++round)
+                {
+                    size_t pos = 0;
+                    for (const auto& atom : frozen.get_factory<AtomFactory>())
+                    {
+                        const auto found = factories.get_or_create_atom(atom->get_predicate(), atom->get_terms());
+                        num_errors += (found != atoms[pos]) + (found->get_index() != pos);
+                        ++pos;
+                    }
+                    const auto object = child_factories.get_or_create_object(std::string("t").append(std::to_string(t)), TypeList { type });
+                    const auto atom = child_factories.get_or_create_atom(predicate, TermList { child_factories.get_or_create_term_object(object), terms[0] });
+                    num_errors += (atom->get_index() != atoms.size());
+                    num_errors += (child_factories.get_or_create_atom(predicate, TermList { terms[0], terms[1] }) != atoms[1]);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(num_errors, 0);
+    EXPECT_EQ(frozen.get_factory<AtomFactory>().size(), atoms.size());
+}
+
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <loki/details/parser.hpp>
+#include <loki/details/pddl/action.hpp>
+#include <loki/details/pddl/domain.hpp>
+#include <loki/details/pddl/literal.hpp>
+#include <loki/details/pddl/object.hpp>
+#include <loki/details/pddl/parameter.hpp>
+#include <loki/details/pddl/position.hpp>
+#include <loki/details/pddl/problem.hpp>
+
+namespace loki::domain::tests
+{
+
+static SourcePosition create_position(uint32_t offset) { return SourcePosition { offset, offset + 1 }; }
+
+TEST(LokiTests, PddlPositionStorageTest)
+{
+    auto storage = PositionStorage<ObjectImpl>();
+    storage.push_back(3, create_position(0));
+    storage.push_back(1, create_position(1));
+    storage.push_back(3, create_position(2));
+    EXPECT_EQ(storage.size(), 3);
+
+    const auto positions = storage.get(3);
+    EXPECT_EQ(positions.size(), 2);
+    EXPECT_EQ(positions[0], create_position(0));
+    EXPECT_EQ(positions[1], create_position(2));
+    EXPECT_EQ(storage.get(1).size(), 1);
+    EXPECT_TRUE(storage.get(0).empty());
+    EXPECT_TRUE(storage.get(100).empty());
+}
+
+TEST(LokiTests, PddlPositionStorageFirstOccurrenceOnlyTest)
+{
+    auto storage = PositionStorage<ObjectImpl>(true);
+    storage.push_back(3, create_position(0));
+    storage.push_back(3, create_position(1));
+    EXPECT_EQ(storage.size(), 1);
+
+    const auto positions = storage.get(3);
+    EXPECT_EQ(positions.size(), 1);
+    EXPECT_EQ(positions[0], create_position(0));
+
+    storage.transform([](const SourcePosition& position) { return SourcePosition { position.first + 10, position.last + 10 }; });
+    EXPECT_EQ(storage.get(3).at(0), create_position(10));
+    storage.erase_if([](const SourcePosition& position) { return position.first == 10; });
+    EXPECT_EQ(storage.size(), 0);
+    EXPECT_TRUE(storage.get(3).empty());
+}
+
+TEST(LokiTests, PddlPositionStorageIndexOffsetTest)
+{
+    auto storage = PositionStorage<ObjectImpl>(false, 10);
+    storage.push_back(12, create_position(0));
+    storage.push_back(3, create_position(1));
+    storage.push_back(12, create_position(2));
+    EXPECT_EQ(storage.size(), 3);
+    EXPECT_EQ(storage.get(12).size(), 2);
+    EXPECT_EQ(storage.get(3).size(), 1);
+    EXPECT_TRUE(storage.get(10).empty());
+    EXPECT_TRUE(storage.get(4).empty());
+
+    // Occurrences are visited ordered by index.
+    auto indices = std::vector<size_t>();
+    storage.for_each([&indices](size_t index, const SourcePosition&) { indices.push_back(index); });
+    EXPECT_EQ(indices, (std::vector<size_t> { 3, 12, 12 }));
+
+    storage.erase_if([](const SourcePosition& position) { return position.first == 0; });
+    EXPECT_EQ(storage.get(12).size(), 1);
+    EXPECT_EQ(storage.get(12)[0], create_position(2));
+    EXPECT_EQ(storage.get(3).size(), 1);
+
+    EXPECT_THROW(storage.set_index_offset(0), std::logic_error);
+}
+
+TEST(LokiTests, PddlPositionCacheTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    auto domain_parser = DomainParser(domain_file);
+    auto compact_domain_parser = DomainParser(domain_file, { .first_occurrence_only = true });
+
+    for (const auto& action : domain_parser.get_domain()->get_actions())
+    {
+        EXPECT_FALSE(domain_parser.get_position_cache().get(action->get_condition().value()).empty());
+    }
+    // Variables are referenced multiple times in the parameters, conditions, and effects.
+    for (const auto& parameter : domain_parser.get_domain()->get_actions().front()->get_parameters())
+    {
+        EXPECT_GT(domain_parser.get_position_cache().get<VariableImpl>(parameter->get_variable()).size(), 1);
+    }
+    for (const auto& parameter : compact_domain_parser.get_domain()->get_actions().front()->get_parameters())
+    {
+        EXPECT_EQ(compact_domain_parser.get_position_cache().get<VariableImpl>(parameter->get_variable()).size(), 1);
+    }
+
+    // The positions are byte offsets into the source, which remain valid after the matched positions of the parser were released.
+    const auto action_position = domain_parser.get_position_cache().get(domain_parser.get_domain()->get_actions().front()).front();
+    EXPECT_EQ(domain_parser.get_source().substr(action_position.first, 8), "(:action");
+    EXPECT_THROW(domain_parser.get_position_cache().get_error_handler().get_source_position(Position { 0, 1 }), std::out_of_range);
+
+    // The position cache of a problem does not allocate slots for the PDDL objects of the domain.
+    const auto num_domain_atoms = domain_parser.get_factories().get_next_index<AtomImpl>();
+    const auto problem_parser = ProblemParser(fs::path(std::string(DATA_DIR) + "gripper/p-2-0.pddl"), domain_parser);
+    EXPECT_EQ(problem_parser.get_position_cache().get_storage<AtomImpl>().get_index_offset(), num_domain_atoms);
+    for (const auto& literal : problem_parser.get_problem()->get_initial_literals())
+    {
+        EXPECT_FALSE(problem_parser.get_position_cache().get(literal->get_atom()).empty());
+    }
+}
+
+}
@@ -40,6 +40,19 @@ TEST(LokiTests, PddlReferenceTest)
     EXPECT_TRUE(references.exists(object_1));
     references.untrack(object_0);
     EXPECT_TRUE(!references.exists(object_0));
+
+    references.track(RequirementEnum::TYPING);
+    EXPECT_TRUE(references.exists(RequirementEnum::TYPING));
+    EXPECT_TRUE(!references.exists(RequirementEnum::ACTION_COSTS));
+
+    // Untracking in a copy is propagated by intersecting.
+    auto copy = references;
+    copy.untrack(object_1);
+    copy.track(object_0);
+    references.intersect(copy);
+    EXPECT_TRUE(!references.exists(object_0));
+    EXPECT_TRUE(!references.exists(object_1));
+    EXPECT_TRUE(references.exists(RequirementEnum::TYPING));
 }
 
 }
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+#include <loki/details/pddl/factories.hpp>
+#include <loki/details/pddl/scope.hpp>
+
+namespace loki::domain::tests
+{
+
+TEST(LokiTests, PddlScopeStackTest)
+{
+    const auto source = std::string("(define (domain scopes))");
+    const auto error_handler = PDDLErrorHandler(PDDLErrorHandler::position_cache(source.begin(), source.end()));
+    auto factories = PDDLFactories();
+    const auto variable_x = factories.get_or_create_variable("?x");
+    const auto variable_y = factories.get_or_create_variable("?y");
+    const auto object_a = factories.get_or_create_object("a", TypeList());
+
+    auto domain_scopes = ScopeStack(error_handler);
+    domain_scopes.open_scope();
+    domain_scopes.top().insert_object("a", object_a, {});
+
+    auto scopes = ScopeStack(error_handler, &domain_scopes);
+    scopes.open_scope();
+    EXPECT_EQ(std::get<0>(scopes.top().get_object("a").value()), object_a);
+    EXPECT_FALSE(scopes.top().get_variable("?x").has_value());
+
+    // Bindings of a scope are visible in nested scopes and removed when the scope is closed.
+    scopes.open_scope();
+    const auto* outer_scope = &scopes.top();
+    scopes.top().insert_variable("?x", variable_x, {});
+    scopes.open_scope();
+    scopes.top().insert_variable("?y", variable_y, {});
+    EXPECT_EQ(std::get<0>(scopes.top().get_variable("?x").value()), variable_x);
+    EXPECT_EQ(std::get<0>(scopes.top().get_variable("?y").value()), variable_y);
+    EXPECT_FALSE(outer_scope->get_variable("?y").has_value());
+    EXPECT_EQ(scopes.size(), 3);
+    scopes.close_scope();
+    EXPECT_FALSE(scopes.top().get_variable("?y").has_value());
+    EXPECT_EQ(std::get<0>(scopes.top().get_variable("?x").value()), variable_x);
+    scopes.close_scope();
+    EXPECT_FALSE(scopes.top().get_variable("?x").has_value());
+
+    // Reopening a scope reuses the pooled scope without its previous bindings.
+    scopes.open_scope();
+    EXPECT_EQ(&scopes.top(), outer_scope);
+    EXPECT_FALSE(scopes.top().get_variable("?x").has_value());
+    scopes.top().insert_variable("?y", variable_y, {});
+    EXPECT_EQ(std::get<0>(scopes.top().get_variable("?y").value()), variable_y);
+    scopes.close_scope();
+    EXPECT_EQ(scopes.size(), 1);
+}
+
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "temporary_file.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <loki/details/pddl/problem.hpp>
+#include <loki/details/registry.hpp>
+#include <limits>
+
+namespace loki::domain::tests
+{
+
+TEST(LokiTests, RegistryTest)
+{
+    const auto gripper_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto miconic_file = fs::path(std::string(DATA_DIR) + "miconic/domain.pddl");
+    const auto schedule_file = fs::path(std::string(DATA_DIR) + "schedule/domain.pddl");
+
+    // The copy differs only in a comment and in the case of its characters.
+    const auto temporary_gripper_copy_file = TemporaryFile();
+    const auto& gripper_copy_file = temporary_gripper_copy_file.get_path();
+    {
+        auto in = std::ifstream(gripper_file);
+        auto out = std::ofstream(gripper_copy_file);
+        out << "; A copy of gripper\n";
+        auto line = std::string();
+        while (std::getline(in, line))
+        {
+            std::transform(line.begin(), line.end(), line.begin(), [](unsigned char c) { return std::toupper(c); });
+            out << line << '\n';
+        }
+    }
+
+    auto registry = DomainRegistry(std::numeric_limits<size_t>::max());
+    const auto gripper = registry.get_or_parse(gripper_file);
+    EXPECT_EQ(registry.get_or_parse(gripper_copy_file), gripper);
+    EXPECT_EQ(registry.get_num_hits(), 1);
+    EXPECT_EQ(registry.get_num_misses(), 1);
+    EXPECT_TRUE(gripper->get_factories().is_frozen());
+
+    // Problems are parsed against the shared domain.
+    const auto problem_parser = parse_problem(fs::path(std::string(DATA_DIR) + "gripper/p-2-0.pddl"), *gripper);
+    EXPECT_EQ(problem_parser.get_problem()->get_domain(), gripper->get_domain());
+
+    // The budget fits only two of the three domains.
+    registry.get_or_parse(miconic_file);
+    registry.get_or_parse(schedule_file);
+    auto bounded_registry = DomainRegistry(registry.get_memory_usage() - 1);
+    bounded_registry.get_or_parse(gripper_file);
+    bounded_registry.get_or_parse(miconic_file);
+    bounded_registry.get_or_parse(gripper_file);
+    bounded_registry.get_or_parse(schedule_file);
+    EXPECT_EQ(bounded_registry.size(), 2);
+    EXPECT_LE(bounded_registry.get_memory_usage(), registry.get_memory_usage() - 1);
+    // The least recently used domain, miconic, was evicted.
+    const auto num_misses = bounded_registry.get_num_misses();
+    bounded_registry.get_or_parse(gripper_file);
+    EXPECT_EQ(bounded_registry.get_num_misses(), num_misses);
+    bounded_registry.get_or_parse(miconic_file);
+    EXPECT_EQ(bounded_registry.get_num_misses(), num_misses + 1);
+
+    // The most recently used domain is never evicted.
+    auto empty_registry = DomainRegistry(0);
+    empty_registry.get_or_parse(gripper_file);
+    EXPECT_EQ(empty_registry.size(), 1);
+    empty_registry.get_or_parse(miconic_file);
+    EXPECT_EQ(empty_registry.size(), 1);
+    EXPECT_EQ(gripper->get_domain()->get_name(), "gripper-strips");
+}
+
+}
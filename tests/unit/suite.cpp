@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <loki/details/pddl/problem.hpp>
+#include <loki/details/suite.hpp>
+#include <sstream>
+
+namespace loki::domain::tests
+{
+
+TEST(LokiTests, SuiteLoadBenchmarkTest)
+{
+    const auto benchmarks = discover_benchmarks(fs::path(std::string(DATA_DIR)));
+    const auto it =
+        std::find_if(benchmarks.begin(), benchmarks.end(), [](const auto& benchmark) { return benchmark.domain_file.parent_path().filename() == "woodworking-sat08-strips"; });
+    ASSERT_NE(it, benchmarks.end());
+    // The fixed domain is not a problem file.
+    EXPECT_EQ(it->problem_files.size(), 30);
+    EXPECT_TRUE(std::is_sorted(it->problem_files.begin(), it->problem_files.end()));
+
+    const auto loaded_benchmark = load_benchmark(*it, 2);
+    EXPECT_TRUE(loaded_benchmark.domain_statistics.success);
+    EXPECT_GT(loaded_benchmark.domain_statistics.num_bytes, 0);
+    EXPECT_GT(loaded_benchmark.domain_statistics.peak_resident_set, 0.);
+    for (size_t i = 0; i < it->problem_files.size(); ++i)
+    {
+        const auto& statistics = loaded_benchmark.problem_statistics[i];
+        EXPECT_EQ(statistics.file_path, it->problem_files[i]);
+        // p11 declares objects without names.
+        const auto expect_success = (statistics.file_path.filename() != "p11.pddl");
+        EXPECT_EQ(statistics.success, expect_success);
+        EXPECT_EQ(loaded_benchmark.problem_parsers[i].has_value(), expect_success);
+        if (expect_success)
+        {
+            EXPECT_GT(statistics.num_atoms, 0);
+            EXPECT_EQ(loaded_benchmark.problem_parsers[i]->get_problem()->get_domain(), loaded_benchmark.domain_parser->get_domain());
+        }
+        else
+        {
+            EXPECT_FALSE(statistics.error.empty());
+        }
+    }
+
+    auto json = std::stringstream();
+    json << loaded_benchmark.domain_statistics;
+    EXPECT_EQ(json.str().front(), '{');
+    EXPECT_NE(json.str().find("\"success\": true"), std::string::npos);
+}
+
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOKI_TESTS_UNIT_TEMPORARY_FILE_HPP_
+#define LOKI_TESTS_UNIT_TEMPORARY_FILE_HPP_
+
+#include <atomic>
+#include <loki/details/utils/filesystem.hpp>
+#include <random>
+#include <string>
+
+namespace loki::domain::tests
+{
+
+/// @brief A file with a unique name in the temporary directory that is removed when the TemporaryFile goes out of scope,
+///        also if an assertion of a test fails.
+///
+/// The name consists of a random prefix per process and a counter such that concurrent test runs do not collide.
+class TemporaryFile
+{
+private:
+    fs::path m_path;
+
+    static std::string get_unique_name()
+    {
+        static const auto prefix = std::to_string(std::random_device()()) + "_" + std::to_string(std::random_device()());
+        static auto counter = std::atomic_size_t { 0 };
+        return "loki_test_" + prefix + "_" + std::to_string(counter++);
+    }
+
+public:
+    /// @brief Reserves a unique file name with the given extension, e.g., ".pddl" or ".pddl.xz".
+    explicit TemporaryFile(const std::string& extension = ".pddl") : m_path(fs::temp_directory_path() / (get_unique_name() + extension)) {}
+
+    // delete copy and move to remove the file exactly once.
+    TemporaryFile(const TemporaryFile& other) = delete;
+    TemporaryFile& operator=(const TemporaryFile& other) = delete;
+    TemporaryFile(TemporaryFile&& other) = delete;
+    TemporaryFile& operator=(TemporaryFile&& other) = delete;
+
+    ~TemporaryFile()
+    {
+        try
+        {
+            fs::remove(m_path);
+        }
+        catch (...)
+        {
+        }
+    }
+
+    const fs::path& get_path() const { return m_path; }
+};
+
+}
+
+#endif
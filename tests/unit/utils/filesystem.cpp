@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "../temporary_file.hpp"
+
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <loki/details/exceptions.hpp>
+#include <loki/details/parser.hpp>
+#include <loki/details/pddl/problem.hpp>
+#include <loki/details/utils/filesystem.hpp>
+
+namespace loki::domain::tests
+{
+
+TEST(LokiTests, UtilsFilesystemReadFileTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/p-2-0.pddl");
+    const auto gzip_domain_file = fs::path(std::string(DATA_DIR) + "compressed/domain.pddl.gz");
+    const auto xz_problem_file = fs::path(std::string(DATA_DIR) + "compressed/p-2-0.pddl.xz");
+
+    try
+    {
+        EXPECT_EQ(read_file(gzip_domain_file), read_file(domain_file));
+        EXPECT_EQ(read_file(xz_problem_file), read_file(problem_file));
+    }
+    catch (const NotImplementedError&)
+    {
+        GTEST_SKIP() << "Loki was built without zlib or liblzma.";
+    }
+
+    auto domain_parser = DomainParser(gzip_domain_file);
+    auto problem_parser = ProblemParser(xz_problem_file, domain_parser);
+    EXPECT_EQ(problem_parser.get_problem()->get_initial_literals().size(), 11);
+
+    // Truncated compressed files are rejected.
+    const auto temporary_truncated_file = TemporaryFile(".pddl.xz");
+    const auto& truncated_file = temporary_truncated_file.get_path();
+    {
+        auto in = std::ifstream(xz_problem_file, std::ios::binary);
+        const auto bytes = std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        auto out = std::ofstream(truncated_file, std::ios::binary);
+        out << bytes.substr(0, bytes.size() / 2);
+    }
+    EXPECT_THROW(read_file(truncated_file), DecompressionError);
+}
+
+TEST(LokiTests, UtilsFilesystemNormalizeTest)
+{
+    const auto temporary_file = TemporaryFile();
+    const auto& file = temporary_file.get_path();
+    {
+        auto out = std::ofstream(file, std::ios::binary);
+        out << "(DEFINE ; comment (with parentheses)\n\t(Domain X)\n;\n)";
+    }
+    EXPECT_EQ(read_file(file), "(define \n    (domain x)\n\n)\n");
+}
+
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <loki/details/parser.hpp>
+#include <loki/details/pddl/action.hpp>
+#include <loki/details/pddl/domain.hpp>
+#include <loki/details/pddl/object.hpp>
+#include <loki/details/pddl/predicate.hpp>
+#include <loki/details/pddl/problem.hpp>
+
+namespace loki::domain::tests
+{
+
+TEST(LokiTests, NameIndexTest)
+{
+    const auto domain_file = fs::path(std::string(DATA_DIR) + "gripper/domain.pddl");
+    const auto problem_file = fs::path(std::string(DATA_DIR) + "gripper/p-2-0.pddl");
+    auto domain_parser = DomainParser(domain_file);
+    auto problem_parser = ProblemParser(problem_file, domain_parser);
+    const auto domain = domain_parser.get_domain();
+    const auto problem = problem_parser.get_problem();
+
+    for (const auto& predicate : domain->get_predicates())
+    {
+        EXPECT_EQ(domain->find_predicate(predicate->get_name()), predicate);
+    }
+    for (const auto& action : domain->get_actions())
+    {
+        EXPECT_EQ(domain->find_action(action->get_name()), action);
+    }
+    EXPECT_FALSE(domain->find_predicate("undefined").has_value());
+    EXPECT_FALSE(domain->find_action("undefined").has_value());
+    EXPECT_EQ(domain->find_action("pick").value()->get_name(), "pick");
+
+    for (const auto& object : problem->get_objects())
+    {
+        EXPECT_EQ(problem->find_object(object->get_name()), object);
+    }
+    // Domain constants are found through the problem.
+    EXPECT_EQ(problem->find_object("rooma"), domain->find_constant("rooma"));
+    EXPECT_TRUE(problem->find_object("rooma").has_value());
+    EXPECT_FALSE(problem->find_object("roomc").has_value());
+}
+
+}
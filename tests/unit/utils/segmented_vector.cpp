@@ -41,6 +41,17 @@ TEST(LokiTests, UtilsSegmentedVectorTest)
     EXPECT_EQ(vec.size(), 3);
     EXPECT_EQ(vec[2], 0);
     EXPECT_EQ(vec.capacity(), 6);
+
+    // Only the largest segment is kept.
+    vec.clear();
+    EXPECT_EQ(vec.size(), 0);
+    EXPECT_EQ(vec.num_segments(), 1);
+    EXPECT_EQ(vec.capacity(), 4);
+
+    vec.push_back(3);
+    EXPECT_EQ(vec.size(), 1);
+    EXPECT_EQ(vec[0], 3);
+    EXPECT_EQ(vec.capacity(), 4);
 }
 
 }
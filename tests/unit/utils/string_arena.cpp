@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <loki/details/pddl/factories.hpp>
+#include <loki/details/pddl/object.hpp>
+#include <loki/details/pddl/variable.hpp>
+#include <loki/details/utils/string_arena.hpp>
+
+namespace loki::domain::tests
+{
+
+TEST(LokiTests, StringArenaTest)
+{
+    auto arena = StringArena(8);
+    const auto name_0 = arena.get_or_create("woodworking-object-0");
+    const auto name_1 = arena.get_or_create("a");
+    const auto name_2 = arena.get_or_create(std::string("woodworking-object-0"));
+    EXPECT_EQ(name_0, "woodworking-object-0");
+    EXPECT_EQ(name_1, "a");
+    // Equal strings are stored once.
+    EXPECT_EQ(name_0.data(), name_2.data());
+    EXPECT_EQ(arena.size(), 2);
+    EXPECT_EQ(arena.num_bytes(), 21);
+
+    // Views remain valid after moving the arena.
+    auto moved_arena = std::move(arena);
+    EXPECT_EQ(name_0, "woodworking-object-0");
+    EXPECT_EQ(moved_arena.get_or_create("a").data(), name_1.data());
+}
+
+TEST(LokiTests, StringArenaFactoriesTest)
+{
+    auto factories = PDDLFactories();
+    auto name = std::string("object_with_a_long_name");
+    const auto object = factories.get_or_create_object(name, TypeList());
+    name.clear();
+    EXPECT_EQ(object->get_name(), "object_with_a_long_name");
+    EXPECT_EQ(factories.get_or_create_object("object_with_a_long_name", TypeList()), object);
+    EXPECT_EQ(factories.get_names().size(), 1);
+
+    // Child factories reuse the PDDL objects and names of the parent and store only new names.
+    auto child_factories = PDDLFactories(&factories);
+    EXPECT_EQ(child_factories.get_or_create_object("object_with_a_long_name", TypeList()), object);
+    EXPECT_EQ(child_factories.get_or_create_variable("object_with_a_long_name")->get_name().data(), object->get_name().data());
+    EXPECT_EQ(child_factories.get_names().size(), 0);
+    child_factories.get_or_create_object("another_object", TypeList());
+    EXPECT_EQ(child_factories.get_names().size(), 1);
+    EXPECT_FALSE(factories.get_names().find("another_object").has_value());
+}
+
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <loki/details/utils/filesystem.hpp>
+#include <loki/details/utils/structural_index.hpp>
+#include <cctype>
+#include <string>
+
+namespace loki::domain::tests
+{
+
+TEST(LokiTests, StructuralIndexTest)
+{
+    // Tokens and keywords cross the boundaries of the 64-byte blocks.
+    const auto text = std::string("(define (problem p)\n  ( :objects a b)\n") + std::string(22, ' ') + "(:init (at a) (=(cost a) 10))"
+                      + std::string(40, 'x') + "\n  (:goal (and (at b) (not(:weird)))))";
+    const auto index = index_structure(text);
+
+    auto parentheses = std::vector<uint32_t>();
+    auto token_starts = std::vector<uint32_t>();
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        const auto c = text[i];
+        if (c == '(' || c == ')')
+        {
+            parentheses.push_back(i);
+        }
+        else if (!std::isspace(static_cast<unsigned char>(c)) && (i == 0 || std::isspace(static_cast<unsigned char>(text[i - 1])) || text[i - 1] == '('
+                                                                  || text[i - 1] == ')'))
+        {
+            token_starts.push_back(i);
+        }
+    }
+    EXPECT_EQ(index.parentheses, parentheses);
+    EXPECT_EQ(index.token_starts, token_starts);
+    ASSERT_EQ(index.keywords.size(), 4);
+    EXPECT_EQ(text.substr(index.keywords[0], 8), ":objects");
+    EXPECT_EQ(text.substr(index.keywords[3], 6), ":weird");
+
+    // The closing parenthesis of the `(define ...)` is the last one.
+    EXPECT_EQ(index.find_closing_parenthesis(text, 0), parentheses.size() - 1);
+    EXPECT_EQ(index.find_closing_parenthesis(text, 1), 2);
+
+    const auto sections = index.get_sections(text);
+    ASSERT_EQ(sections.size(), 3);
+    EXPECT_EQ(sections[0].keyword, ":objects");
+    EXPECT_EQ(text.substr(sections[0].first, sections[0].last - sections[0].first), "( :objects a b)");
+    EXPECT_EQ(sections[1].keyword, ":init");
+    EXPECT_EQ(text.substr(sections[1].first, sections[1].last - sections[1].first), "(:init (at a) (=(cost a) 10))");
+    EXPECT_EQ(sections[2].keyword, ":goal");
+    EXPECT_EQ(sections[2].last, text.size() - 1);
+}
+
+TEST(LokiTests, StructuralIndexFileTest)
+{
+    const auto text = read_file(fs::path(std::string(DATA_DIR) + "gripper/domain.pddl"));
+    const auto index = index_structure(text);
+
+    auto keywords = std::vector<std::string_view>();
+    for (const auto& section : index.get_sections(text))
+    {
+        keywords.push_back(section.keyword);
+        EXPECT_EQ(text[section.first], '(');
+        EXPECT_EQ(text[section.last - 1], ')');
+    }
+    EXPECT_EQ(keywords, (std::vector<std::string_view> { ":requirements", ":constants", ":predicates", ":action", ":action", ":action" }));
+    EXPECT_TRUE(index_structure("").parentheses.empty());
+}
+
+}
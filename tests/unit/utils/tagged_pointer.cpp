@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <loki/details/pddl/conditions.hpp>
+#include <loki/details/pddl/factories.hpp>
+#include <loki/details/pddl/literal.hpp>
+#include <string>
+#include <variant>
+
+namespace loki::domain::tests
+{
+
+static_assert(sizeof(Condition) == sizeof(void*));
+static_assert(sizeof(Effect) == sizeof(void*));
+static_assert(sizeof(FunctionExpression) == sizeof(void*));
+
+TEST(LokiTests, TaggedPointerTest)
+{
+    auto factories = PDDLFactories();
+    const auto predicate = factories.get_or_create_predicate("p", ParameterList {});
+    const auto literal = factories.get_or_create_literal(false, factories.get_or_create_atom(predicate, TermList {}));
+    const auto condition_literal = factories.get_or_create_condition_literal(literal);
+    const auto condition_not = factories.get_or_create_condition_not(condition_literal);
+    const auto condition_and = factories.get_or_create_condition_and(ConditionList { condition_literal, condition_not });
+
+    EXPECT_EQ(condition_literal.index(), Condition::index_of<ConditionLiteral>);
+    EXPECT_EQ(condition_not.index(), Condition::index_of<ConditionNot>);
+    EXPECT_TRUE(holds_alternative<ConditionAnd>(condition_and));
+    EXPECT_FALSE(holds_alternative<ConditionOr>(condition_and));
+
+    EXPECT_EQ(get<ConditionNot>(condition_not)->get_condition(), condition_literal);
+    EXPECT_EQ(get<ConditionLiteral>(condition_literal)->get_literal(), literal);
+    EXPECT_THROW(get<ConditionAnd>(condition_not), std::bad_variant_access);
+    EXPECT_EQ(get_if<ConditionAnd>(condition_not), nullptr);
+    EXPECT_EQ(get_if<ConditionNot>(condition_not), get<ConditionNot>(condition_not));
+
+    const auto visitor = [](const auto& arg) -> std::string
+    {
+        using ArgType = std::decay_t<decltype(arg)>;
+        if constexpr (std::is_same_v<ArgType, ConditionAnd>)
+        {
+            return "and";
+        }
+        else if constexpr (std::is_same_v<ArgType, ConditionNot>)
+        {
+            return "not";
+        }
+        else
+        {
+            return "other";
+        }
+    };
+    EXPECT_EQ(visit(visitor, condition_and), "and");
+    EXPECT_EQ(visit(visitor, condition_not), "not");
+    EXPECT_EQ(visit(visitor, condition_literal), "other");
+
+    // Handles of the same condition are equal and distinct conditions are ordered.
+    EXPECT_EQ(factories.get_or_create_condition_not(condition_literal), condition_not);
+    EXPECT_NE(condition_not, condition_and);
+    EXPECT_NE(condition_not < condition_and, condition_and < condition_not);
+    EXPECT_EQ(std::hash<Condition>()(condition_not), std::hash<Condition>()(factories.get_or_create_condition_not(condition_literal)));
+}
+
+}
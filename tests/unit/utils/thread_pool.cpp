@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2023 Dominik Drexler
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <loki/details/utils/thread_pool.hpp>
+#include <stdexcept>
+
+namespace loki::domain::tests
+{
+
+TEST(LokiTests, UtilsThreadPoolTest)
+{
+    auto thread_pool = ThreadPool(4);
+    EXPECT_EQ(thread_pool.size(), 4);
+
+    auto futures = std::vector<std::future<size_t>>();
+    for (size_t i = 0; i < 100; ++i)
+    {
+        futures.push_back(thread_pool.submit([i] { return i * i; }));
+    }
+    for (size_t i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(futures[i].get(), i * i);
+    }
+
+    auto failing = thread_pool.submit([]() -> size_t { throw std::runtime_error("failure"); });
+    EXPECT_THROW(failing.get(), std::runtime_error);
+}
+
+}